@@ -0,0 +1,1253 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_bench.c
+*@brief     Bus efficiency benchmark of FM25 driver on simulated device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BENCH
+* @{ <!-- BEGIN GROUP -->
+*
+*     Benchmark sweeps access sizes from single byte to whole memory array
+*     and measures bus cost of each driver operation on simulated device.
+*
+*     Results are stored into machine readable baseline file (CSV). Each
+*     following run is compared against baseline and fails if any operation
+*     needs more framing bytes, chip select assertions or interface calls
+*     than before.
+*
+*     Compile with "FM25_BENCH_MAIN" defined for standalone executable.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "fm25_bench.h"
+#include "fm25_sim.h"
+#include "fm25_sim_dma.h"
+#include "../src/fm25_cache.h"
+#include "../src/fm25_crc.h"
+#include "../src/fm25_bd.h"
+#include "../src/fm25_ckpt.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Maximum number of benchmark results
+ */
+#define FM25_BENCH_RES_MAX              ( 1024U )
+
+/**
+ *     Allowed deviation of per operation overhead against baseline
+ */
+#define FM25_BENCH_TOLERANCE            ( 0.001 )
+
+/**
+ *     Telemetry scenario of cache benchmark
+ *
+ * @note    Counters are rewritten every round, cache is flushed every
+ *          "FM25_BENCH_CACHE_FLUSH" rounds.
+ */
+#define FM25_BENCH_CACHE_COUNTERS       ( 64U )
+#define FM25_BENCH_CACHE_ROUNDS         ( 100U )
+#define FM25_BENCH_CACHE_FLUSH          ( 10U )
+#define FM25_BENCH_CACHE_LINE_SIZE      ( 64U )
+#define FM25_BENCH_CACHE_LINES          ( 8U )
+
+/**
+ *     Number of CPU passes of integrity check benchmark
+ */
+#define FM25_BENCH_CRC_PASSES           ( 8U )
+
+/**
+ *     File append scenario of block device benchmark
+ */
+#define FM25_BENCH_BD_REC_NUM           ( 1024U )
+#define FM25_BENCH_BD_REC_SIZE          ( 64U )
+#define FM25_BENCH_BD_BLOCK_SIZE        ( 512U )
+#define FM25_BENCH_BD_FILE_SIZE         ( FM25_BENCH_BD_REC_NUM * FM25_BENCH_BD_REC_SIZE )
+
+/**
+ *     Checkpoint scenario: state size, checkpoints, changed fields per
+ *     checkpoint and write segments
+ */
+#define FM25_BENCH_CKPT_SIZE            ( 8192U )
+#define FM25_BENCH_CKPT_NUM             ( 100U )
+#define FM25_BENCH_CKPT_FIELDS          ( 12U )
+#define FM25_BENCH_CKPT_IOV_NUM         ( 16U )
+
+/**
+ *     Benchmarked operations
+ */
+typedef enum
+{
+    eFM25_BENCH_WRITE = 0,
+    eFM25_BENCH_READ,
+    eFM25_BENCH_ERASE,
+
+    eFM25_BENCH_NUM_OF
+} fm25_bench_op_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Operation names
+ */
+static const char * const gp_op_name[eFM25_BENCH_NUM_OF] =
+{
+    [eFM25_BENCH_WRITE] = "write",
+    [eFM25_BENCH_READ]  = "read",
+    [eFM25_BENCH_ERASE] = "erase",
+};
+
+/**
+ *     Benchmark results
+ */
+static fm25_bench_res_t g_res[FM25_BENCH_RES_MAX]   = { 0 };
+static uint32_t         g_res_num                   = 0U;
+
+/**
+ *     Simulated device
+ */
+static fm25_sim_t       g_sim                       = { 0 };
+
+/**
+ *     Interface of simulated device, segmented transfer can be disabled
+ */
+static fm25_if_t        g_bench_if                  = { 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t    fm25_bench_measure  (fm25_dev_t dev, const fm25_bench_op_t op, const uint32_t size, const uint32_t iterations, uint8_t * const p_buf, fm25_bench_res_t * const p_res);
+static fm25_status_t    fm25_bench_sweep    (const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num);
+static fm25_status_t    fm25_bench_fstrd    (const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num);
+static fm25_status_t    fm25_bench_cache    (const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num);
+static fm25_status_t    fm25_bench_crc_wall (const fm25_if_t * const p_if, fm25_sim_dma_t * const p_dma, const uint8_t addr_bit_num, uint32_t * const p_crc, double * const p_wall_ns);
+static fm25_status_t    fm25_bench_crc      (const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num);
+static fm25_status_t    fm25_bench_bd       (const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num);
+static fm25_status_t    fm25_bench_ckpt     (const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num);
+static void             fm25_bench_report   (FILE * const p_out, const fm25_bench_res_t * const p_res);
+static fm25_status_t    fm25_bench_compare  (const fm25_bench_cfg_t * const p_cfg);
+static fm25_status_t    fm25_bench_save     (const char * const p_file);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Measure bus cost of single operation
+*
+* @param[in]    dev         - Device handle
+* @param[in]    op          - Benchmarked operation
+* @param[in]    size        - Payload size per operation
+* @param[in]    iterations  - Number of operations
+* @param[in]    p_buf       - Pointer to data buffer
+* @param[out]   p_res       - Pointer to result
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_measure(fm25_dev_t dev, const fm25_bench_op_t op, const uint32_t size, const uint32_t iterations, uint8_t * const p_buf, fm25_bench_res_t * const p_res)
+{
+    fm25_status_t       status  = eFM25_OK;
+    fm25_sim_stats_t    stats   = { 0 };
+
+    fm25_sim_reset_stats( &g_sim );
+
+    for ( uint32_t i = 0U; i < iterations; i++ )
+    {
+        switch( op )
+        {
+            case eFM25_BENCH_WRITE: status |= fm25_write( dev, 0U, size, p_buf );  break;
+            case eFM25_BENCH_READ:  status |= fm25_read( dev, 0U, size, p_buf );   break;
+            case eFM25_BENCH_ERASE: status |= fm25_erase( dev, 0U, size );         break;
+            default:                status |= eFM25_ERROR;                          break;
+        }
+    }
+
+    fm25_sim_get_stats( &g_sim, &stats );
+
+    strncpy( p_res->op, gp_op_name[op], sizeof( p_res->op ) - 1U );
+    p_res->size         = size;
+    p_res->spi_bytes    = (double)( stats.tx_bytes + stats.rx_bytes ) / iterations;
+    p_res->cs           = (double) stats.cs_assert / iterations;
+    p_res->calls        = (double) stats.xfer_calls / iterations;
+    p_res->bus_ns       = (double) stats.bus_time_ns / iterations;
+
+    // Device shall not see any protocol violation
+    if ( 0U != stats.violations )
+    {
+        status |= eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Sweep access sizes of single device density
+*
+* @param[in]    p_cfg           - Pointer to benchmark configuration
+* @param[in]    addr_bit_num    - Number of address bits
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_sweep(const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num)
+{
+    fm25_status_t       status      = eFM25_OK;
+    fm25_sim_cfg_t      sim_cfg     = { 0 };
+    fm25_dev_t          dev         = NULL;
+    const uint32_t      mem_size    = ( 1UL << addr_bit_num );
+    uint8_t * const     p_buf       = malloc( mem_size );
+
+    const fm25_dev_cfg_t dev_cfg =
+    {
+        .p_if           = &g_bench_if,
+        .p_if_ctx       = &g_sim,
+        .addr_bit_num   = addr_bit_num,
+    };
+
+    fm25_sim_default_cfg( &sim_cfg, addr_bit_num );
+    sim_cfg.sck_hz      = p_cfg->sck_hz;
+    sim_cfg.t_call_ns   = p_cfg->t_call_ns;
+
+    if  (   ( NULL == p_buf )
+        ||  ( eFM25_OK != fm25_sim_open( &g_sim, &sim_cfg ))
+        ||  ( eFM25_OK != fm25_open( &dev, &dev_cfg )))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        memset( p_buf, 0xA5, mem_size );
+
+        for ( uint32_t size = 1U; ( size <= mem_size ) && ( eFM25_OK == status ); size <<= 1U )
+        {
+            for ( uint32_t op = 0U; ( op < eFM25_BENCH_NUM_OF ) && ( g_res_num < FM25_BENCH_RES_MAX ); op++ )
+            {
+                fm25_bench_res_t * const p_res = &g_res[g_res_num];
+
+                memset( p_res, 0, sizeof( fm25_bench_res_t ));
+                p_res->addr_bit_num = addr_bit_num;
+
+                status |= fm25_bench_measure( dev, (fm25_bench_op_t) op, size, p_cfg->iterations, p_buf, p_res );
+
+                fm25_bench_report( p_cfg->p_report, p_res );
+                g_res_num++;
+            }
+        }
+
+        status |= fm25_close( dev );
+    }
+
+    fm25_sim_close( &g_sim );
+    free( p_buf );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Compare read throughput of READ and FSTRD
+*
+* @note     Device limits READ command to "sck_hz". Driver is configured
+*           with automatic read selection, thus it picks READ at "sck_hz"
+*           and FSTRD at "fstrd_sck_hz". Simulator reports READ above its
+*           limit as violation. Results are not part of baseline.
+*
+* @param[in]    p_cfg           - Pointer to benchmark configuration
+* @param[in]    addr_bit_num    - Number of address bits
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_fstrd(const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num)
+{
+    fm25_status_t       status      = eFM25_OK;
+    const uint32_t      mem_size    = ( 1UL << addr_bit_num );
+    uint8_t * const     p_buf       = malloc( mem_size );
+    const uint32_t      sck_hz[2]   = { p_cfg->sck_hz, p_cfg->fstrd_sck_hz };
+    fm25_bench_res_t    res[2]      = { 0 };
+
+    for ( uint32_t size = 16U; ( size <= mem_size ) && ( NULL != p_buf ) && ( eFM25_OK == status ); size <<= 4U )
+    {
+        for ( uint32_t i = 0U; ( i < 2U ) && ( eFM25_OK == status ); i++ )
+        {
+            fm25_sim_cfg_t  sim_cfg = { 0 };
+            fm25_dev_t      dev     = NULL;
+
+            const fm25_dev_cfg_t dev_cfg =
+            {
+                .p_if           = &g_bench_if,
+                .p_if_ctx       = &g_sim,
+                .addr_bit_num   = addr_bit_num,
+                .read_mode      = eFM25_READ_AUTO,
+                .sck_hz         = sck_hz[i],
+                .read_max_hz    = p_cfg->sck_hz,
+            };
+
+            fm25_sim_default_cfg( &sim_cfg, addr_bit_num );
+            sim_cfg.sck_hz      = sck_hz[i];
+            sim_cfg.read_max_hz = p_cfg->sck_hz;
+            sim_cfg.t_call_ns   = p_cfg->t_call_ns;
+            sim_cfg.fstrd_en    = true;
+
+            if  (   ( eFM25_OK != fm25_sim_open( &g_sim, &sim_cfg ))
+                ||  ( eFM25_OK != fm25_open( &dev, &dev_cfg )))
+            {
+                status = eFM25_ERROR_INIT;
+            }
+            else
+            {
+                res[i].addr_bit_num = addr_bit_num;
+
+                status |= fm25_bench_measure( dev, eFM25_BENCH_READ, size, p_cfg->iterations, p_buf, &res[i] );
+                status |= fm25_close( dev );
+
+                if ( 1U == i )
+                {
+                    strncpy( res[i].op, "fstrd", sizeof( res[i].op ) - 1U );
+                }
+
+                fm25_bench_report( p_cfg->p_report, &res[i] );
+            }
+
+            fm25_sim_close( &g_sim );
+        }
+
+        if (( NULL != p_cfg->p_report ) && ( res[1].bus_ns > 0.0 ))
+        {
+            fprintf( p_cfg->p_report, "fstrd @ %u Hz vs read @ %u Hz, %u B: %.2fx throughput\n",
+                     p_cfg->fstrd_sck_hz, p_cfg->sck_hz, size, ( res[0].bus_ns / res[1].bus_ns ));
+        }
+    }
+
+    free( p_buf );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Compare telemetry rewrites with and without write-back cache
+*
+* @note     Counters of 4 bytes are rewritten every round, directly by
+*           "fm25_write()" or through cache with periodic flush. Results
+*           are not part of baseline.
+*
+* @param[in]    p_cfg           - Pointer to benchmark configuration
+* @param[in]    addr_bit_num    - Number of address bits
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_cache(const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num)
+{
+    fm25_status_t       status      = eFM25_OK;
+    fm25_sim_cfg_t      sim_cfg     = { 0 };
+    fm25_sim_stats_t    stats[2]    = { 0 };
+    fm25_cache_stats_t  cache_stats = { 0 };
+    fm25_dev_t          dev         = NULL;
+    fm25_cache_t        cache       = { 0 };
+    static uint8_t      arena[ FM25_CACHE_ARENA_SIZE( FM25_BENCH_CACHE_LINES, FM25_BENCH_CACHE_LINE_SIZE ) ];
+
+    const fm25_dev_cfg_t dev_cfg =
+    {
+        .p_if           = &g_bench_if,
+        .p_if_ctx       = &g_sim,
+        .addr_bit_num   = addr_bit_num,
+    };
+
+    fm25_sim_default_cfg( &sim_cfg, addr_bit_num );
+    sim_cfg.sck_hz      = p_cfg->sck_hz;
+    sim_cfg.t_call_ns   = p_cfg->t_call_ns;
+
+    if  (   ( eFM25_OK != fm25_sim_open( &g_sim, &sim_cfg ))
+        ||  ( eFM25_OK != fm25_open( &dev, &dev_cfg )))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        const fm25_cache_cfg_t cache_cfg =
+        {
+            .dev            = dev,
+            .p_arena        = arena,
+            .arena_size     = sizeof( arena ),
+            .line_size      = FM25_BENCH_CACHE_LINE_SIZE,
+            .deadline       = 0U,
+            .pf_get_tick    = NULL,
+        };
+
+        status = fm25_cache_init( &cache, &cache_cfg );
+
+        for ( uint32_t mode = 0U; ( mode < 2U ) && ( eFM25_OK == status ); mode++ )
+        {
+            fm25_sim_reset_stats( &g_sim );
+
+            for ( uint32_t round = 0U; round < FM25_BENCH_CACHE_ROUNDS; round++ )
+            {
+                for ( uint32_t i = 0U; i < FM25_BENCH_CACHE_COUNTERS; i++ )
+                {
+                    const uint32_t counter = ( round << 8U ) | i;
+
+                    if ( 0U == mode )
+                    {
+                        status |= fm25_write( dev, ( i * 4U ), 4U, (const uint8_t*) &counter );
+                    }
+                    else
+                    {
+                        status |= fm25_cache_write( &cache, ( i * 4U ), 4U, (const uint8_t*) &counter );
+                    }
+                }
+
+                if (( 1U == mode ) && ( 0U == (( round + 1U ) % FM25_BENCH_CACHE_FLUSH )))
+                {
+                    status |= fm25_cache_flush( &cache );
+                }
+            }
+
+            fm25_sim_get_stats( &g_sim, &stats[mode] );
+        }
+
+        status |= fm25_cache_get_stats( &cache, &cache_stats );
+        status |= fm25_close( dev );
+
+        if (( NULL != p_cfg->p_report ) && ( stats[1].bus_time_ns > 0U ))
+        {
+            fprintf( p_cfg->p_report, "cache: %u x %u B counters, %u rounds, flush every %u\n",
+                     FM25_BENCH_CACHE_COUNTERS, 4U, FM25_BENCH_CACHE_ROUNDS, FM25_BENCH_CACHE_FLUSH );
+            fprintf( p_cfg->p_report, "cache: direct spi_bytes %llu, calls %llu, bus %llu ns\n",
+                     (unsigned long long) ( stats[0].tx_bytes + stats[0].rx_bytes ),
+                     (unsigned long long) stats[0].xfer_calls, (unsigned long long) stats[0].bus_time_ns );
+            fprintf( p_cfg->p_report, "cache: cached spi_bytes %llu, calls %llu, bus %llu ns (%.1fx)\n",
+                     (unsigned long long) ( stats[1].tx_bytes + stats[1].rx_bytes ),
+                     (unsigned long long) stats[1].xfer_calls, (unsigned long long) stats[1].bus_time_ns,
+                     ((double) stats[0].bus_time_ns / stats[1].bus_time_ns ));
+            fprintf( p_cfg->p_report, "cache: wr_hit %u, wr_miss %u, rd_hit %u, rd_miss %u, evict %u, flush %u, flush_seg %u, flush_bytes %u\n",
+                     cache_stats.wr_hit, cache_stats.wr_miss, cache_stats.rd_hit, cache_stats.rd_miss,
+                     cache_stats.evict, cache_stats.flush, cache_stats.flush_seg, cache_stats.flush_bytes );
+        }
+    }
+
+    fm25_sim_close( &g_sim );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Measure wall time of region CRC over DMA engine
+*
+* @param[in]    p_if            - Pointer to interface of DMA engine
+* @param[in]    p_dma           - Pointer to opened DMA engine
+* @param[in]    addr_bit_num    - Number of address bits
+* @param[out]   p_crc           - CRC-32 of whole memory array
+* @param[out]   p_wall_ns       - Wall time of region CRC
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_crc_wall(const fm25_if_t * const p_if, fm25_sim_dma_t * const p_dma, const uint8_t addr_bit_num, uint32_t * const p_crc, double * const p_wall_ns)
+{
+    fm25_status_t       status      = eFM25_OK;
+    fm25_dev_t          dev         = NULL;
+    uint32_t            mem_size    = 0U;
+    struct timespec     t_start     = { 0 };
+    struct timespec     t_end       = { 0 };
+
+    const fm25_dev_cfg_t dev_cfg =
+    {
+        .p_if           = p_if,
+        .p_if_ctx       = p_dma,
+        .addr_bit_num   = addr_bit_num,
+    };
+
+    if  (   ( eFM25_OK != fm25_open( &dev, &dev_cfg ))
+        ||  ( eFM25_OK != fm25_get_size( dev, &mem_size )))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        *p_crc = FM25_CRC32_INIT;
+
+        clock_gettime( CLOCK_MONOTONIC, &t_start );
+
+        status = fm25_crc32_region( dev, 0U, mem_size, p_crc );
+
+        clock_gettime( CLOCK_MONOTONIC, &t_end );
+
+        *p_wall_ns = ((( t_end.tv_sec - t_start.tv_sec ) * 1e9 ) + ( t_end.tv_nsec - t_start.tv_nsec ));
+    }
+
+    status |= fm25_close( dev );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Measure boot time integrity check of whole memory array
+*
+* @note     Bus time is taken from simulated device, CPU time of CRC
+*           kernel is measured on host. Sequential and pipelined figures
+*           are wall time of "fm25_crc32_region()" on paced DMA engine,
+*           which holds each transfer for its bus time without using CPU.
+*           Sequential run has no non-blocking start functions, pipelined
+*           run reads next chunk while CRC of current one is calculated
+*           (requires "FM25_CFG_ASYNC_EN"). Results are informative and
+*           not part of baseline.
+*
+* @param[in]    p_cfg           - Pointer to benchmark configuration
+* @param[in]    addr_bit_num    - Number of address bits
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_crc(const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num)
+{
+    fm25_status_t       status      = eFM25_OK;
+    fm25_sim_cfg_t      sim_cfg     = { 0 };
+    fm25_sim_stats_t    stats       = { 0 };
+    fm25_sim_dma_t      dma         = { 0 };
+    fm25_if_t           seq_if      = g_fm25_sim_dma_if;
+    fm25_dev_t          dev         = NULL;
+    uint32_t            mem_size    = 0U;
+    uint32_t            crc         = FM25_CRC32_INIT;
+    uint32_t            cpu_crc     = FM25_CRC32_INIT;
+    uint32_t            seq_crc     = FM25_CRC32_INIT;
+    uint32_t            pipe_crc    = FM25_CRC32_INIT;
+    double              seq_ns      = 0.0;
+    double              pipe_ns     = 0.0;
+    struct timespec     t_start     = { 0 };
+    struct timespec     t_end       = { 0 };
+
+    const fm25_dev_cfg_t dev_cfg =
+    {
+        .p_if           = &g_bench_if,
+        .p_if_ctx       = &g_sim,
+        .addr_bit_num   = addr_bit_num,
+    };
+
+    // Sequential reference: blocking transfers only
+    seq_if.pf_transmit_start    = NULL;
+    seq_if.pf_receive_start     = NULL;
+
+    fm25_sim_default_cfg( &sim_cfg, addr_bit_num );
+    sim_cfg.sck_hz      = p_cfg->sck_hz;
+    sim_cfg.t_call_ns   = p_cfg->t_call_ns;
+
+    if  (   ( eFM25_OK != fm25_sim_open( &g_sim, &sim_cfg ))
+        ||  ( eFM25_OK != fm25_open( &dev, &dev_cfg ))
+        ||  ( eFM25_OK != fm25_get_size( dev, &mem_size )))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        const uint8_t * const p_mem = fm25_sim_get_mem( &g_sim );
+
+        fm25_sim_reset_stats( &g_sim );
+
+        status = fm25_crc32_region( dev, 0U, mem_size, &crc );
+
+        fm25_sim_get_stats( &g_sim, &stats );
+
+        status |= fm25_close( dev );
+
+        clock_gettime( CLOCK_MONOTONIC, &t_start );
+
+        for ( uint32_t pass = 0U; pass < FM25_BENCH_CRC_PASSES; pass++ )
+        {
+            cpu_crc = fm25_crc32( FM25_CRC32_INIT, p_mem, mem_size );
+        }
+
+        clock_gettime( CLOCK_MONOTONIC, &t_end );
+
+        if  (   ( eFM25_OK != fm25_sim_dma_open( &dma, &g_sim ))
+            ||  ( eFM25_OK != fm25_sim_dma_set_pace( &dma, true )))
+        {
+            status |= eFM25_ERROR_INIT;
+        }
+        else
+        {
+            status |= fm25_bench_crc_wall( &seq_if, &dma, addr_bit_num, &seq_crc, &seq_ns );
+            status |= fm25_bench_crc_wall( &g_fm25_sim_dma_if, &dma, addr_bit_num, &pipe_crc, &pipe_ns );
+        }
+
+        (void) fm25_sim_dma_close( &dma );
+
+        if  (   ( crc != cpu_crc )
+            ||  ( crc != seq_crc )
+            ||  ( crc != pipe_crc ))
+        {
+            status |= eFM25_ERROR;
+        }
+
+        if (( eFM25_OK == status ) && ( NULL != p_cfg->p_report ))
+        {
+            const double mb_scale   = ( 1048576.0 / mem_size );
+            const double bus_us     = ( stats.bus_time_ns * mb_scale / 1000.0 );
+            const double cpu_us     = (((( t_end.tv_sec - t_start.tv_sec ) * 1e9 ) + ( t_end.tv_nsec - t_start.tv_nsec )) / FM25_BENCH_CRC_PASSES * mb_scale / 1000.0 );
+
+            fprintf( p_cfg->p_report, "crc: %u B region, %u B chunks, kernel %s\n",
+                     mem_size, FM25_CFG_CRC_CHUNK_SIZE,
+                     (( 1 == FM25_CFG_CRC_HW_EN ) ? "hw" : (( 1 == FM25_CFG_CRC_SLICE8_EN ) ? "slice-by-8" : "nibble" )));
+            fprintf( p_cfg->p_report, "crc: per MB bus %.0f us, cpu %.0f us (host), wall sequential %.0f us, wall pipelined %.0f us\n",
+                     bus_us, cpu_us, ( seq_ns * mb_scale / 1000.0 ), ( pipe_ns * mb_scale / 1000.0 ));
+        }
+    }
+
+    fm25_sim_close( &g_sim );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Compare file append and read through block device against raw driver
+*
+* @note     Records are written and read one by one with raw driver. Block
+*           device path mimics filesystem with block sized cache: record
+*           is appended to cache and full block is programmed by single
+*           callback, file is read back block by block. Filesystem
+*           metadata is not modelled. Results are not part of baseline.
+*
+* @param[in]    p_cfg           - Pointer to benchmark configuration
+* @param[in]    addr_bit_num    - Number of address bits
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_bd(const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num)
+{
+    fm25_status_t       status      = eFM25_OK;
+    fm25_sim_cfg_t      sim_cfg     = { 0 };
+    fm25_sim_stats_t    stats[2][2] = { 0 };
+    fm25_dev_t          dev         = NULL;
+    fm25_bd_t           bd          = { 0 };
+    uint8_t             rec[FM25_BENCH_BD_REC_SIZE];
+    static uint8_t      block[FM25_BENCH_BD_BLOCK_SIZE];
+
+    const fm25_dev_cfg_t dev_cfg =
+    {
+        .p_if           = &g_bench_if,
+        .p_if_ctx       = &g_sim,
+        .addr_bit_num   = addr_bit_num,
+    };
+
+    fm25_sim_default_cfg( &sim_cfg, addr_bit_num );
+    sim_cfg.sck_hz      = p_cfg->sck_hz;
+    sim_cfg.t_call_ns   = p_cfg->t_call_ns;
+
+    if  (   ( eFM25_OK != fm25_sim_open( &g_sim, &sim_cfg ))
+        ||  ( eFM25_OK != fm25_open( &dev, &dev_cfg )))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        const fm25_bd_cfg_t bd_cfg =
+        {
+            .dev        = dev,
+            .addr       = 0U,
+            .block_size = FM25_BENCH_BD_BLOCK_SIZE,
+            .block_num  = 0U,
+            .read_size  = 1U,
+            .prog_size  = 1U,
+            .erase      = eFM25_BD_ERASE_NONE,
+        };
+
+        status = fm25_bd_init( &bd, &bd_cfg );
+
+        for ( uint32_t mode = 0U; ( mode < 2U ) && ( eFM25_OK == status ); mode++ )
+        {
+            const uint32_t rec_per_block = ( FM25_BENCH_BD_BLOCK_SIZE / FM25_BENCH_BD_REC_SIZE );
+
+            // Append
+            fm25_sim_reset_stats( &g_sim );
+
+            for ( uint32_t i = 0U; ( i < FM25_BENCH_BD_REC_NUM ) && ( eFM25_OK == status ); i++ )
+            {
+                const uint32_t addr = ( i * FM25_BENCH_BD_REC_SIZE );
+
+                memset( rec, (int)( i + mode ), sizeof( rec ));
+
+                if ( 0U == mode )
+                {
+                    status = fm25_write( dev, addr, FM25_BENCH_BD_REC_SIZE, rec );
+                }
+                else
+                {
+                    memcpy( &block[ addr % FM25_BENCH_BD_BLOCK_SIZE ], rec, FM25_BENCH_BD_REC_SIZE );
+
+                    if (( rec_per_block - 1U ) == ( i % rec_per_block ))
+                    {
+                        status = (( FM25_BD_OK == fm25_bd_prog( &bd, ( addr / FM25_BENCH_BD_BLOCK_SIZE ), 0U, block, FM25_BENCH_BD_BLOCK_SIZE )) ? eFM25_OK : eFM25_ERROR );
+                    }
+                }
+            }
+
+            fm25_sim_get_stats( &g_sim, &stats[mode][0] );
+
+            // Read back
+            fm25_sim_reset_stats( &g_sim );
+
+            for ( uint32_t i = 0U; ( i < FM25_BENCH_BD_REC_NUM ) && ( eFM25_OK == status ); i++ )
+            {
+                const uint32_t addr = ( i * FM25_BENCH_BD_REC_SIZE );
+
+                if ( 0U == mode )
+                {
+                    status = fm25_read( dev, addr, FM25_BENCH_BD_REC_SIZE, rec );
+                }
+                else
+                {
+                    if ( 0U == ( i % rec_per_block ))
+                    {
+                        status = (( FM25_BD_OK == fm25_bd_read( &bd, ( addr / FM25_BENCH_BD_BLOCK_SIZE ), 0U, block, FM25_BENCH_BD_BLOCK_SIZE )) ? eFM25_OK : eFM25_ERROR );
+                    }
+
+                    memcpy( rec, &block[ addr % FM25_BENCH_BD_BLOCK_SIZE ], FM25_BENCH_BD_REC_SIZE );
+                }
+
+                if ( rec[FM25_BENCH_BD_REC_SIZE - 1U] != (uint8_t)( i + mode ))
+                {
+                    status |= eFM25_ERROR;
+                }
+            }
+
+            fm25_sim_get_stats( &g_sim, &stats[mode][1] );
+        }
+
+        status |= fm25_close( dev );
+
+        if (( eFM25_OK == status ) && ( NULL != p_cfg->p_report ))
+        {
+            const double        mb          = ((double) FM25_BENCH_BD_REC_NUM * FM25_BENCH_BD_REC_SIZE / 1048576.0 );
+            const char * const  p_name[2]   = { "raw", "block" };
+
+            fprintf( p_cfg->p_report, "bd: %u x %u B records, %u B blocks\n",
+                     FM25_BENCH_BD_REC_NUM, FM25_BENCH_BD_REC_SIZE, FM25_BENCH_BD_BLOCK_SIZE );
+
+            for ( uint32_t mode = 0U; mode < 2U; mode++ )
+            {
+                fprintf( p_cfg->p_report, "bd: %-5s append %.3f MB/s, cs %llu, calls %llu; read %.3f MB/s, cs %llu, calls %llu\n",
+                         p_name[mode],
+                         ( mb * 1e9 / stats[mode][0].bus_time_ns ),
+                         (unsigned long long) stats[mode][0].cs_assert, (unsigned long long) stats[mode][0].xfer_calls,
+                         ( mb * 1e9 / stats[mode][1].bus_time_ns ),
+                         (unsigned long long) stats[mode][1].cs_assert, (unsigned long long) stats[mode][1].xfer_calls );
+            }
+        }
+    }
+
+    fm25_sim_close( &g_sim );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Compare delta checkpoint against full rewrite of state
+*
+* @note     Each checkpoint changes fixed set of 4 byte fields, some of
+*           them neighbours, and 16 byte record at moving offset. Same
+*           sequence of changes is checkpointed by full write and by
+*           delta checkpoint with different merge thresholds, using
+*           baseline image or block hashes. Results are not part of
+*           baseline.
+*
+* @param[in]    p_cfg           - Pointer to benchmark configuration
+* @param[in]    addr_bit_num    - Number of address bits
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_ckpt(const fm25_bench_cfg_t * const p_cfg, const uint8_t addr_bit_num)
+{
+    fm25_status_t       status  = eFM25_OK;
+    fm25_sim_cfg_t      sim_cfg = { 0 };
+    fm25_sim_stats_t    stats   = { 0 };
+    fm25_dev_t          dev     = NULL;
+    fm25_ckpt_t         ckpt    = { 0 };
+    fm25_ckpt_stats_t   ckpt_stats;
+    fm25_iov_t          iov[FM25_BENCH_CKPT_IOV_NUM];
+    uint32_t            hash[FM25_CKPT_HASH_NUM( FM25_BENCH_CKPT_SIZE )];
+    static uint8_t      state[FM25_BENCH_CKPT_SIZE];
+    static uint8_t      base[FM25_BENCH_CKPT_SIZE];
+
+    // Field offsets, some of them only few bytes apart
+    static const uint32_t field[FM25_BENCH_CKPT_FIELDS] =
+    {
+        0U, 4U, 8U, 20U, 256U, 264U, 1024U, 1040U, 2048U, 4096U, 4100U, 8000U
+    };
+
+    // Mode: 0 - full write, otherwise { merge gap, use hashes }
+    static const struct
+    {
+        const char *    p_name;
+        uint32_t        gap;
+        bool            is_hash;
+    } mode[] =
+    {
+        { "full",       0U,     false },
+        { "base/0",     0U,     false },
+        { "base/8",     8U,     false },
+        { "base/64",    64U,    false },
+        { "hash/0",     0U,     true  },
+    };
+
+    const fm25_dev_cfg_t dev_cfg =
+    {
+        .p_if           = &g_bench_if,
+        .p_if_ctx       = &g_sim,
+        .addr_bit_num   = addr_bit_num,
+    };
+
+    fm25_sim_default_cfg( &sim_cfg, addr_bit_num );
+    sim_cfg.sck_hz      = p_cfg->sck_hz;
+    sim_cfg.t_call_ns   = p_cfg->t_call_ns;
+
+    if  (   ( eFM25_OK != fm25_sim_open( &g_sim, &sim_cfg ))
+        ||  ( eFM25_OK != fm25_open( &dev, &dev_cfg )))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL != p_cfg->p_report )
+    {
+        fprintf( p_cfg->p_report, "ckpt: %u B state, %u checkpoints, %u fields + 16 B record changed each\n",
+                 FM25_BENCH_CKPT_SIZE, FM25_BENCH_CKPT_NUM, FM25_BENCH_CKPT_FIELDS );
+    }
+    else
+    {
+        // No action
+    }
+
+    for ( uint32_t m = 0U; ( m < ( sizeof( mode ) / sizeof( mode[0] ))) && ( eFM25_OK == status ); m++ )
+    {
+        const fm25_ckpt_cfg_t ckpt_cfg =
+        {
+            .dev        = dev,
+            .addr       = 0U,
+            .size       = FM25_BENCH_CKPT_SIZE,
+            .p_base     = ( true == mode[m].is_hash ) ? NULL : base,
+            .p_hash     = ( true == mode[m].is_hash ) ? hash : NULL,
+            .p_iov      = iov,
+            .iov_num    = FM25_BENCH_CKPT_IOV_NUM,
+            .gap        = mode[m].gap,
+        };
+
+        memset( state, 0, sizeof( state ));
+        status = fm25_write( dev, 0U, FM25_BENCH_CKPT_SIZE, state );
+
+        if (( eFM25_OK == status ) && ( m > 0U ))
+        {
+            status = fm25_ckpt_init( &ckpt, &ckpt_cfg, state );
+        }
+
+        fm25_sim_reset_stats( &g_sim );
+
+        for ( uint32_t n = 0U; ( n < FM25_BENCH_CKPT_NUM ) && ( eFM25_OK == status ); n++ )
+        {
+            for ( uint32_t f = 0U; f < FM25_BENCH_CKPT_FIELDS; f++ )
+            {
+                const uint32_t val = (( n + 1U ) * ( f + 1U ));
+
+                memcpy( &state[field[f]], &val, sizeof( val ));
+            }
+
+            memset( &state[ 512U + (( n * 40U ) % 2048U ) ], (int)( n + 1U ), 16U );
+
+            if ( 0U == m )
+            {
+                status = fm25_write( dev, 0U, FM25_BENCH_CKPT_SIZE, state );
+            }
+            else
+            {
+                status = fm25_ckpt_commit( &ckpt, state );
+            }
+        }
+
+        fm25_sim_get_stats( &g_sim, &stats );
+
+        // Device shall hold last state
+        for ( uint32_t i = 0U; ( i < FM25_BENCH_CKPT_SIZE ) && ( eFM25_OK == status ); i += FM25_BENCH_CKPT_IOV_NUM )
+        {
+            uint8_t data[FM25_BENCH_CKPT_IOV_NUM];
+
+            status = fm25_read( dev, i, FM25_BENCH_CKPT_IOV_NUM, data );
+
+            if ( 0 != memcmp( data, &state[i], FM25_BENCH_CKPT_IOV_NUM ))
+            {
+                status |= eFM25_ERROR;
+            }
+        }
+
+        if (( eFM25_OK == status ) && ( NULL != p_cfg->p_report ))
+        {
+            if ( 0U == m )
+            {
+                memset( &ckpt_stats, 0, sizeof( ckpt_stats ));
+                ckpt_stats.written  = ( FM25_BENCH_CKPT_SIZE * FM25_BENCH_CKPT_NUM );
+                ckpt_stats.run      = FM25_BENCH_CKPT_NUM;
+            }
+            else
+            {
+                status = fm25_ckpt_get_stats( &ckpt, &ckpt_stats );
+            }
+
+            fprintf( p_cfg->p_report, "ckpt: %-7s %.2f us, %.1f B written, %.1f B saved, %.2f writes per checkpoint\n",
+                     mode[m].p_name,
+                     ((double) stats.bus_time_ns / 1000.0 / FM25_BENCH_CKPT_NUM ),
+                     ((double) ckpt_stats.written / FM25_BENCH_CKPT_NUM ),
+                     ((double) ckpt_stats.saved / FM25_BENCH_CKPT_NUM ),
+                     ((double) ckpt_stats.run / FM25_BENCH_CKPT_NUM ));
+
+            // Gap histogram is same for all modes of baseline
+            if ( 1U == m )
+            {
+                fprintf( p_cfg->p_report, "ckpt: gap histogram" );
+
+                for ( uint32_t bucket = 0U; bucket < FM25_CKPT_GAP_NUM; bucket++ )
+                {
+                    fprintf( p_cfg->p_report, " %lu", (unsigned long) ckpt_stats.gap[bucket] );
+                }
+
+                fprintf( p_cfg->p_report, "\n" );
+            }
+        }
+    }
+
+    if ( NULL != dev )
+    {
+        status |= fm25_close( dev );
+    }
+
+    fm25_sim_close( &g_sim );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Print single benchmark result
+*
+* @param[in]    p_out   - Output stream
+* @param[in]    p_res   - Pointer to result
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_bench_report(FILE * const p_out, const fm25_bench_res_t * const p_res)
+{
+    if ( NULL != p_out )
+    {
+        const double ops_per_s  = ( p_res->bus_ns > 0.0 ) ? ( 1e9 / p_res->bus_ns ) : 0.0;
+        const double mb_per_s   = ( p_res->bus_ns > 0.0 ) ? ( p_res->size * 1e3 / p_res->bus_ns ) : 0.0;
+        const double eff        = ( p_res->spi_bytes > 0.0 ) ? ( 100.0 * p_res->size / p_res->spi_bytes ) : 0.0;
+
+        fprintf( p_out, "%-6s %5u %8u %12.1f %12.1f %7.2f%% %6.2f %6.2f %9.3f\n",
+                 p_res->op, p_res->addr_bit_num, p_res->size, ops_per_s, p_res->spi_bytes,
+                 eff, p_res->cs, p_res->calls, mb_per_s );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Compare results against baseline file
+*
+* @note     Operation is regressed if it needs more framing bytes,
+*           chip select assertions or interface calls than baseline.
+*
+* @param[in]    p_cfg   - Pointer to benchmark configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_compare(const fm25_bench_cfg_t * const p_cfg)
+{
+    fm25_status_t       status  = eFM25_OK;
+    FILE * const        p_file  = fopen( p_cfg->p_baseline, "r" );
+    fm25_bench_res_t    base    = { 0 };
+    unsigned int        bits    = 0U;
+    unsigned int        size    = 0U;
+    char                line[128];
+
+    if ( NULL != p_file )
+    {
+        while ( NULL != fgets( line, sizeof( line ), p_file ))
+        {
+            if ( 7 != sscanf( line, "%7[^,],%u,%u,%lf,%lf,%lf,%lf", base.op, &bits, &size, &base.spi_bytes, &base.cs, &base.calls, &base.bus_ns ))
+            {
+                continue;
+            }
+
+            for ( uint32_t i = 0U; i < g_res_num; i++ )
+            {
+                const fm25_bench_res_t * const p_res = &g_res[i];
+
+                if  (   ( 0 == strcmp( p_res->op, base.op ))
+                    &&  ( p_res->addr_bit_num == bits )
+                    &&  ( p_res->size == size ))
+                {
+                    if  (   (( p_res->spi_bytes - base.spi_bytes ) > FM25_BENCH_TOLERANCE )
+                        ||  (( p_res->cs - base.cs ) > FM25_BENCH_TOLERANCE )
+                        ||  (( p_res->calls - base.calls ) > FM25_BENCH_TOLERANCE ))
+                    {
+                        status = eFM25_ERROR;
+
+                        if ( NULL != p_cfg->p_report )
+                        {
+                            fprintf( p_cfg->p_report, "REGRESSION: %s %u-bit %u B: bytes %.2f->%.2f, cs %.2f->%.2f, calls %.2f->%.2f\n",
+                                     base.op, bits, size, base.spi_bytes, p_res->spi_bytes,
+                                     base.cs, p_res->cs, base.calls, p_res->calls );
+                        }
+                    }
+                }
+            }
+        }
+
+        fclose( p_file );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Store results into baseline file
+*
+* @param[in]    p_file  - Path to baseline file
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_save(const char * const p_file)
+{
+    fm25_status_t   status  = eFM25_OK;
+    FILE * const    p_out   = fopen( p_file, "w" );
+
+    if ( NULL != p_out )
+    {
+        fprintf( p_out, "op,addr_bits,size,spi_bytes,cs,calls,bus_ns\n" );
+
+        for ( uint32_t i = 0U; i < g_res_num; i++ )
+        {
+            fprintf( p_out, "%s,%u,%u,%.3f,%.3f,%.3f,%.1f\n",
+                     g_res[i].op, g_res[i].addr_bit_num, g_res[i].size, g_res[i].spi_bytes,
+                     g_res[i].cs, g_res[i].calls, g_res[i].bus_ns );
+        }
+
+        fclose( p_out );
+    }
+    else
+    {
+        status = eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BENCH
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 benchmark API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get default benchmark configuration
+*
+* @param[out]   p_cfg   - Pointer to benchmark configuration
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fm25_bench_default_cfg(fm25_bench_cfg_t * const p_cfg)
+{
+    if ( NULL != p_cfg )
+    {
+        p_cfg->p_baseline   = NULL;
+        p_cfg->p_report     = stdout;
+        p_cfg->sck_hz       = 20000000UL;
+        p_cfg->fstrd_sck_hz = 40000000UL;
+        p_cfg->t_call_ns    = 5000UL;
+        p_cfg->iterations   = 4U;
+        p_cfg->update       = false;
+        p_cfg->seg_en       = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Run benchmark
+*
+* @note     All densities from 9 to 19 address bits are swept, unless
+*           driver is pinned to single density by "FM25_CFG_ADDR_BIT_NUM".
+*
+*           Missing baseline file is created from current results.
+*
+* @param[in]    p_cfg   - Pointer to benchmark configuration
+* @return       status  - eFM25_OK if there is no regression against baseline
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bench_run(const fm25_bench_cfg_t * const p_cfg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_cfg ) || ( 0U == p_cfg->iterations ) || ( 0U == p_cfg->sck_hz ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        g_res_num   = 0U;
+        g_bench_if  = g_fm25_sim_if;
+
+        if ( false == p_cfg->seg_en )
+        {
+            g_bench_if.pf_transfer_seg = NULL;
+        }
+
+        if ( NULL != p_cfg->p_report )
+        {
+            fprintf( p_cfg->p_report, "%-6s %5s %8s %12s %12s %8s %6s %6s %9s\n",
+                     "op", "abits", "size", "ops/s", "spi_bytes", "eff", "cs/op", "if/op", "MB/s" );
+        }
+
+        #if ( 0 == FM25_CFG_ADDR_BIT_NUM )
+            for ( uint8_t addr_bit_num = 9U; ( addr_bit_num <= 19U ) && ( eFM25_OK == status ); addr_bit_num++ )
+            {
+                status = fm25_bench_sweep( p_cfg, addr_bit_num );
+            }
+        #else
+            status = fm25_bench_sweep( p_cfg, FM25_CFG_ADDR_BIT_NUM );
+        #endif
+
+        // Fast read gain on 1Mbit part or pinned density, 9-bit parts have no FSTRD
+        if  (   ( eFM25_OK == status )
+            &&  ( p_cfg->fstrd_sck_hz > p_cfg->sck_hz )
+            &&  ( 9 != FM25_CFG_ADDR_BIT_NUM ))
+        {
+            status = fm25_bench_fstrd( p_cfg, (( 0 == FM25_CFG_ADDR_BIT_NUM ) ? 17U : FM25_CFG_ADDR_BIT_NUM ));
+        }
+
+        // Write-back cache on telemetry rewrites
+        if ( eFM25_OK == status )
+        {
+            status = fm25_bench_cache( p_cfg, (( 0 == FM25_CFG_ADDR_BIT_NUM ) ? 14U : FM25_CFG_ADDR_BIT_NUM ));
+        }
+
+        // Boot time integrity check of whole memory array
+        if ( eFM25_OK == status )
+        {
+            status = fm25_bench_crc( p_cfg, (( 0 == FM25_CFG_ADDR_BIT_NUM ) ? 17U : FM25_CFG_ADDR_BIT_NUM ));
+        }
+
+        // File append through block device, skipped on pinned density smaller than file
+        if  (   ( eFM25_OK == status )
+            &&  (   ( 0 == FM25_CFG_ADDR_BIT_NUM )
+                ||  ( FM25_BENCH_BD_FILE_SIZE <= ( 1UL << FM25_CFG_ADDR_BIT_NUM ))))
+        {
+            status = fm25_bench_bd( p_cfg, (( 0 == FM25_CFG_ADDR_BIT_NUM ) ? 17U : FM25_CFG_ADDR_BIT_NUM ));
+        }
+
+        // Delta checkpoint of application state, skipped on pinned density smaller than state
+        if  (   ( eFM25_OK == status )
+            &&  (   ( 0 == FM25_CFG_ADDR_BIT_NUM )
+                ||  ( FM25_BENCH_CKPT_SIZE <= ( 1UL << FM25_CFG_ADDR_BIT_NUM ))))
+        {
+            status = fm25_bench_ckpt( p_cfg, (( 0 == FM25_CFG_ADDR_BIT_NUM ) ? 17U : FM25_CFG_ADDR_BIT_NUM ));
+        }
+
+        if (( eFM25_OK == status ) && ( NULL != p_cfg->p_baseline ))
+        {
+            FILE * const p_file = fopen( p_cfg->p_baseline, "r" );
+
+            if (( NULL == p_file ) || ( true == p_cfg->update ))
+            {
+                status = fm25_bench_save( p_cfg->p_baseline );
+            }
+            else
+            {
+                status = fm25_bench_compare( p_cfg );
+            }
+
+            if ( NULL != p_file )
+            {
+                fclose( p_file );
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined( FM25_BENCH_MAIN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Standalone benchmark executable
+*
+*           Usage: fm25_bench [baseline.csv] [-u] [-s]
+*
+*           -u  update baseline
+*           -s  disable segmented interface transfers
+*
+* @return   exit code - 0 if there is no regression against baseline
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+    fm25_bench_cfg_t cfg;
+
+    fm25_bench_default_cfg( &cfg );
+
+    for ( int i = 1; i < argc; i++ )
+    {
+        if ( 0 == strcmp( argv[i], "-u" ))
+        {
+            cfg.update = true;
+        }
+        else if ( 0 == strcmp( argv[i], "-s" ))
+        {
+            cfg.seg_en = false;
+        }
+        else
+        {
+            cfg.p_baseline = argv[i];
+        }
+    }
+
+    return (( eFM25_OK == fm25_bench_run( &cfg )) ? EXIT_SUCCESS : EXIT_FAILURE );
+}
+
+#endif
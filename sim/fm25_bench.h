@@ -0,0 +1,77 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_bench.h
+*@brief     Bus efficiency benchmark of FM25 driver on simulated device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BENCH
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_BENCH_H_
+#define FM25_BENCH_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "../src/fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Benchmark configuration
+ */
+typedef struct
+{
+    const char *    p_baseline;     /**<Path to baseline file, NULL to skip comparison */
+    FILE *          p_report;       /**<Report output stream, NULL for no report */
+    uint32_t        sck_hz;         /**<Simulated SPI clock */
+    uint32_t        fstrd_sck_hz;   /**<SPI clock of fast read comparison with READ limited to "sck_hz", 0 to skip */
+    uint32_t        t_call_ns;      /**<Simulated host driver setup time per interface call */
+    uint32_t        iterations;     /**<Number of operations per access size */
+    bool            update;         /**<Overwrite baseline file with current results */
+    bool            seg_en;         /**<Use segmented (single call) interface transfers */
+} fm25_bench_cfg_t;
+
+/**
+ *     Benchmark result of single access size
+ */
+typedef struct
+{
+    char        op[8];          /**<Operation name */
+    uint8_t     addr_bit_num;   /**<Number of address bits */
+    uint32_t    size;           /**<Payload size per operation */
+    double      spi_bytes;      /**<Total SPI bytes per operation */
+    double      cs;             /**<Chip select assertions per operation */
+    double      calls;          /**<Interface calls per operation */
+    double      bus_ns;         /**<Simulated bus time per operation */
+} fm25_bench_res_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+void            fm25_bench_default_cfg  (fm25_bench_cfg_t * const p_cfg);
+fm25_status_t   fm25_bench_run          (const fm25_bench_cfg_t * const p_cfg);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_BENCH_H_
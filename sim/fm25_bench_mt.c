@@ -0,0 +1,654 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_bench_mt.c
+*@brief     Multi-threaded lock and submission ring benchmark of FM25 driver
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BENCH_MT
+* @{ <!-- BEGIN GROUP -->
+*
+*     Host benchmark of interface lock hooks and submission ring on
+*     simulated device, with POSIX threads as RTOS tasks:
+*
+*       - uncontended lock cost, single byte read with and without
+*         pthread mutex lock hooks
+*       - contended writes, threads write and read back own pattern of
+*         the same block, every read back must be made of single pattern
+*       - ring latency, producer threads post writes to single driver
+*         thread, post to completion latency is reported
+*
+*     Compile with "FM25_BENCH_MT_MAIN" defined and "-pthread" for
+*     standalone executable.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "fm25_bench_mt.h"
+#include "fm25_sim.h"
+#include "../src/fm25_ring.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Maximum number of threads
+ */
+#define FM25_BENCH_MT_THREAD_MAX        ( 16U )
+
+/**
+ *     Size of contended block and of posted write
+ */
+#define FM25_BENCH_MT_BLOCK_SIZE        ( 256U )
+#define FM25_BENCH_MT_POST_SIZE         ( 16U )
+
+/**
+ *     Number of ring slots
+ */
+#define FM25_BENCH_MT_SLOT_NUM          ( 64U )
+
+/**
+ *     Ring consumer results
+ */
+typedef struct
+{
+    uint64_t    lat_sum;        /**<Sum of post to completion latency in ns */
+    uint32_t    done;           /**<Number of completed requests */
+    uint32_t    err;            /**<Number of failed requests */
+} fm25_bench_mt_ring_res_t;
+
+/**
+ *     Worker thread context
+ */
+typedef struct
+{
+    const fm25_bench_mt_cfg_t * p_cfg;      /**<Benchmark configuration */
+    fm25_dev_t                  dev;        /**<Device handle */
+    fm25_ring_t *               p_ring;     /**<Submission ring */
+    fm25_ring_req_t *           p_req;      /**<Request storage of producer */
+    fm25_bench_mt_ring_res_t *  p_res;      /**<Ring consumer results */
+    uint32_t                    id;         /**<Thread index */
+    uint32_t                    err;        /**<Number of failed operations */
+} fm25_bench_mt_worker_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Simulated device
+ */
+static fm25_sim_t       g_sim           = { 0 };
+
+/**
+ *     Bus lock
+ */
+static pthread_mutex_t  g_bus_mutex     = PTHREAD_MUTEX_INITIALIZER;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t    fm25_bench_mt_lock      (void * const p_ctx);
+static void             fm25_bench_mt_unlock    (void * const p_ctx);
+static uint32_t         fm25_bench_mt_tick      (void);
+static double           fm25_bench_mt_ns        (const struct timespec * const p_start, const struct timespec * const p_end);
+static fm25_status_t    fm25_bench_mt_open      (fm25_dev_t * const p_dev, const fm25_if_t * const p_if);
+static fm25_status_t    fm25_bench_mt_uncont    (const fm25_bench_mt_cfg_t * const p_cfg);
+static void *           fm25_bench_mt_writer    (void * p_arg);
+static fm25_status_t    fm25_bench_mt_cont      (const fm25_bench_mt_cfg_t * const p_cfg);
+static void             fm25_bench_mt_ring_cb   (fm25_ring_req_t * const p_req, const fm25_status_t status, void * const p_arg);
+static void *           fm25_bench_mt_producer  (void * p_arg);
+static fm25_status_t    fm25_bench_mt_ring      (const fm25_bench_mt_cfg_t * const p_cfg);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Lock hook, pthread mutex
+*
+* @param[in]    p_ctx   - Interface context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_mt_lock(void * const p_ctx)
+{
+    (void) p_ctx;
+
+    return (( 0 == pthread_mutex_lock( &g_bus_mutex )) ? eFM25_OK : eFM25_ERROR_BUSY );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Unlock hook, pthread mutex
+*
+* @param[in]    p_ctx   - Interface context
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_bench_mt_unlock(void * const p_ctx)
+{
+    (void) p_ctx;
+
+    (void) pthread_mutex_unlock( &g_bus_mutex );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Timestamp source of submission ring
+*
+* @return       tick    - Monotonic time in ns, wrapping
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_bench_mt_tick(void)
+{
+    struct timespec now = { 0 };
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    return (uint32_t)(( (uint64_t) now.tv_sec * 1000000000ULL ) + (uint64_t) now.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Elapsed time
+*
+* @param[in]    p_start - Start time
+* @param[in]    p_end   - End time
+* @return       ns      - Elapsed time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double fm25_bench_mt_ns(const struct timespec * const p_start, const struct timespec * const p_end)
+{
+    return ((( p_end->tv_sec - p_start->tv_sec ) * 1e9 ) + ( p_end->tv_nsec - p_start->tv_nsec ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open simulated device
+*
+* @param[out]   p_dev   - Device handle
+* @param[in]    p_if    - Interface of simulated device
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_mt_open(fm25_dev_t * const p_dev, const fm25_if_t * const p_if)
+{
+    fm25_status_t   status  = eFM25_OK;
+    fm25_sim_cfg_t  sim_cfg = { 0 };
+
+    const fm25_dev_cfg_t dev_cfg =
+    {
+        .p_if           = p_if,
+        .p_if_ctx       = &g_sim,
+        .addr_bit_num   = 15U,
+    };
+
+    fm25_sim_default_cfg( &sim_cfg, 15U );
+
+    status = fm25_sim_open( &g_sim, &sim_cfg );
+
+    if ( eFM25_OK == status )
+    {
+        status = fm25_open( p_dev, &dev_cfg );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Uncontended lock cost
+*
+* @param[in]    p_cfg   - Pointer to benchmark configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_mt_uncont(const fm25_bench_mt_cfg_t * const p_cfg)
+{
+    fm25_status_t   status      = eFM25_OK;
+    fm25_if_t       bench_if    = g_fm25_sim_if;
+    double          call_ns[2]  = { 0 };
+    uint8_t         byte        = 0U;
+
+    for ( uint32_t is_lock = 0U; is_lock < 2U; is_lock++ )
+    {
+        fm25_dev_t      dev     = NULL;
+        struct timespec t_start = { 0 };
+        struct timespec t_end   = { 0 };
+
+        bench_if.pf_lock    = ( 1U == is_lock ) ? fm25_bench_mt_lock : NULL;
+        bench_if.pf_unlock  = ( 1U == is_lock ) ? fm25_bench_mt_unlock : NULL;
+
+        status |= fm25_bench_mt_open( &dev, &bench_if );
+
+        if ( eFM25_OK == status )
+        {
+            // Warm-up
+            for ( uint32_t i = 0U; i < p_cfg->iterations; i++ )
+            {
+                status |= fm25_read( dev, ( i & 0x0FFFU ), 1U, &byte );
+            }
+
+            clock_gettime( CLOCK_MONOTONIC, &t_start );
+
+            for ( uint32_t i = 0U; i < p_cfg->iterations; i++ )
+            {
+                status |= fm25_read( dev, ( i & 0x0FFFU ), 1U, &byte );
+            }
+
+            clock_gettime( CLOCK_MONOTONIC, &t_end );
+
+            call_ns[is_lock] = fm25_bench_mt_ns( &t_start, &t_end ) / p_cfg->iterations;
+
+            status |= fm25_close( dev );
+        }
+
+        fm25_sim_close( &g_sim );
+    }
+
+    if (( eFM25_OK == status ) && ( NULL != p_cfg->p_report ))
+    {
+        fprintf( p_cfg->p_report, "lock: uncontended 1 B read %.1f ns, with lock hooks %.1f ns, lock cost %.1f ns\n",
+                 call_ns[0], call_ns[1], ( call_ns[1] - call_ns[0] ));
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Contended writer thread
+*
+* @param[in]    p_arg   - Worker context
+* @return       NULL
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void * fm25_bench_mt_writer(void * p_arg)
+{
+    fm25_bench_mt_worker_t * const p_worker = (fm25_bench_mt_worker_t*) p_arg;
+    uint8_t wr[FM25_BENCH_MT_BLOCK_SIZE];
+    uint8_t rd[FM25_BENCH_MT_BLOCK_SIZE];
+
+    memset( wr, (int)( p_worker->id + 1U ), sizeof( wr ));
+
+    for ( uint32_t i = 0U; i < p_worker->p_cfg->iterations; i++ )
+    {
+        if  (   ( eFM25_OK != fm25_write( p_worker->dev, 0U, sizeof( wr ), wr ))
+            ||  ( eFM25_OK != fm25_read( p_worker->dev, 0U, sizeof( rd ), rd )))
+        {
+            p_worker->err++;
+        }
+        else
+        {
+            // Block must be written by single writer as whole
+            for ( uint32_t b = 1U; b < sizeof( rd ); b++ )
+            {
+                if ( rd[b] != rd[0] )
+                {
+                    p_worker->err++;
+                    break;
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Contended writes under lock
+*
+* @param[in]    p_cfg   - Pointer to benchmark configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_mt_cont(const fm25_bench_mt_cfg_t * const p_cfg)
+{
+    fm25_status_t           status      = eFM25_OK;
+    fm25_if_t               bench_if    = g_fm25_sim_if;
+    fm25_dev_t              dev         = NULL;
+    fm25_sim_stats_t        stats       = { 0 };
+    fm25_bench_mt_worker_t  worker[FM25_BENCH_MT_THREAD_MAX];
+    pthread_t               thread[FM25_BENCH_MT_THREAD_MAX];
+    struct timespec         t_start     = { 0 };
+    struct timespec         t_end       = { 0 };
+    uint32_t                err         = 0U;
+
+    bench_if.pf_lock    = fm25_bench_mt_lock;
+    bench_if.pf_unlock  = fm25_bench_mt_unlock;
+
+    status = fm25_bench_mt_open( &dev, &bench_if );
+
+    if ( eFM25_OK == status )
+    {
+        fm25_sim_reset_stats( &g_sim );
+
+        clock_gettime( CLOCK_MONOTONIC, &t_start );
+
+        for ( uint32_t t = 0U; t < p_cfg->thread_num; t++ )
+        {
+            worker[t] = (fm25_bench_mt_worker_t) { .p_cfg = p_cfg, .dev = dev, .id = t };
+
+            (void) pthread_create( &thread[t], NULL, fm25_bench_mt_writer, &worker[t] );
+        }
+
+        for ( uint32_t t = 0U; t < p_cfg->thread_num; t++ )
+        {
+            (void) pthread_join( thread[t], NULL );
+
+            err += worker[t].err;
+        }
+
+        clock_gettime( CLOCK_MONOTONIC, &t_end );
+
+        fm25_sim_get_stats( &g_sim, &stats );
+
+        status |= fm25_close( dev );
+
+        if (( 0U != err ) || ( 0U != stats.violations ))
+        {
+            status |= eFM25_ERROR;
+        }
+
+        if ( NULL != p_cfg->p_report )
+        {
+            fprintf( p_cfg->p_report, "lock: %u threads, %u B write+read back %.1f us per pair, %u torn blocks, %llu bus violations\n",
+                     p_cfg->thread_num, FM25_BENCH_MT_BLOCK_SIZE,
+                     ( fm25_bench_mt_ns( &t_start, &t_end ) / 1000.0 / ( p_cfg->thread_num * p_cfg->iterations )),
+                     err, (unsigned long long) stats.violations );
+        }
+    }
+
+    fm25_sim_close( &g_sim );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Ring completion callback, driver thread context
+*
+* @param[in]    p_req   - Completed request
+* @param[in]    status  - Status of request
+* @param[in]    p_arg   - Ring consumer results
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_bench_mt_ring_cb(fm25_ring_req_t * const p_req, const fm25_status_t status, void * const p_arg)
+{
+    fm25_bench_mt_ring_res_t * const p_res = (fm25_bench_mt_ring_res_t*) p_arg;
+
+    p_res->lat_sum += (uint32_t)( fm25_bench_mt_tick() - p_req->tick );
+    p_res->done++;
+
+    if ( eFM25_OK != status )
+    {
+        p_res->err++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Ring producer thread
+*
+* @note     Full ring is retried after yield, as interrupt would retry at
+*           next event.
+*
+* @param[in]    p_arg   - Worker context
+* @return       NULL
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void * fm25_bench_mt_producer(void * p_arg)
+{
+    fm25_bench_mt_worker_t * const p_worker = (fm25_bench_mt_worker_t*) p_arg;
+    static const uint8_t data[FM25_BENCH_MT_POST_SIZE] = { 0 };
+
+    for ( uint32_t i = 0U; i < p_worker->p_cfg->iterations; i++ )
+    {
+        fm25_status_t status = eFM25_ERROR_BUSY;
+
+        while ( eFM25_ERROR_BUSY == status )
+        {
+            status = fm25_ring_write( p_worker->p_ring, &p_worker->p_req[i], ( p_worker->id * FM25_BENCH_MT_POST_SIZE ),
+                                      FM25_BENCH_MT_POST_SIZE, data, fm25_bench_mt_ring_cb, p_worker->p_res );
+
+            if ( eFM25_ERROR_BUSY == status )
+            {
+                (void) sched_yield();
+            }
+        }
+
+        if ( eFM25_OK != status )
+        {
+            p_worker->err++;
+        }
+    }
+
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Submission ring latency
+*
+* @note     Calling thread acts as driver task and polls the ring.
+*
+* @param[in]    p_cfg   - Pointer to benchmark configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bench_mt_ring(const fm25_bench_mt_cfg_t * const p_cfg)
+{
+    fm25_status_t               status      = eFM25_OK;
+    fm25_if_t                   bench_if    = g_fm25_sim_if;
+    fm25_dev_t                  dev         = NULL;
+    fm25_ring_t                 ring        = { 0 };
+    fm25_ring_stats_t           stats       = { 0 };
+    fm25_ring_slot_t            slot[FM25_BENCH_MT_SLOT_NUM];
+    fm25_bench_mt_ring_res_t    res         = { 0 };
+    fm25_bench_mt_worker_t      worker[FM25_BENCH_MT_THREAD_MAX];
+    pthread_t                   thread[FM25_BENCH_MT_THREAD_MAX];
+    fm25_ring_req_t *           p_req       = NULL;
+    const uint32_t              total       = ( p_cfg->thread_num * p_cfg->iterations );
+
+    bench_if.pf_lock    = fm25_bench_mt_lock;
+    bench_if.pf_unlock  = fm25_bench_mt_unlock;
+
+    p_req = calloc( total, sizeof( fm25_ring_req_t ));
+
+    if ( NULL == p_req )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_bench_mt_open( &dev, &bench_if );
+    }
+
+    if ( eFM25_OK == status )
+    {
+        const fm25_ring_cfg_t ring_cfg =
+        {
+            .dev            = dev,
+            .p_slot         = slot,
+            .slot_num       = FM25_BENCH_MT_SLOT_NUM,
+            .pf_get_tick    = fm25_bench_mt_tick,
+            .pf_notify      = NULL,
+        };
+
+        status = fm25_ring_init( &ring, &ring_cfg );
+
+        for ( uint32_t t = 0U; ( eFM25_OK == status ) && ( t < p_cfg->thread_num ); t++ )
+        {
+            worker[t] = (fm25_bench_mt_worker_t)
+            {
+                .p_cfg  = p_cfg,
+                .dev    = dev,
+                .p_ring = &ring,
+                .p_req  = &p_req[ t * p_cfg->iterations ],
+                .p_res  = &res,
+                .id     = t,
+            };
+
+            (void) pthread_create( &thread[t], NULL, fm25_bench_mt_producer, &worker[t] );
+        }
+
+        // Driver task
+        while (( eFM25_OK == status ) && ( res.done < total ))
+        {
+            (void) fm25_ring_process( &ring );
+            (void) sched_yield();
+        }
+
+        for ( uint32_t t = 0U; ( eFM25_OK == status ) && ( t < p_cfg->thread_num ); t++ )
+        {
+            (void) pthread_join( thread[t], NULL );
+
+            res.err += worker[t].err;
+        }
+
+        (void) fm25_ring_get_stats( &ring, &stats );
+
+        status |= fm25_close( dev );
+
+        if (( eFM25_OK == status ) && ( 0U != res.err ))
+        {
+            status = eFM25_ERROR;
+        }
+
+        if (( eFM25_OK == status ) && ( NULL != p_cfg->p_report ))
+        {
+            fprintf( p_cfg->p_report, "ring: %u producers, %u slots, %u requests, latency mean %.1f us, max %.1f us, %u full retries\n",
+                     p_cfg->thread_num, FM25_BENCH_MT_SLOT_NUM, res.done,
+                     ((double) res.lat_sum / res.done / 1000.0 ), ( stats.lat_max / 1000.0 ), stats.full );
+        }
+    }
+
+    fm25_sim_close( &g_sim );
+    free( p_req );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BENCH_MT
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 multi-threaded benchmark API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get default benchmark configuration
+*
+* @param[out]   p_cfg   - Pointer to benchmark configuration
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fm25_bench_mt_default_cfg(fm25_bench_mt_cfg_t * const p_cfg)
+{
+    if ( NULL != p_cfg )
+    {
+        p_cfg->p_report     = stdout;
+        p_cfg->thread_num   = 4U;
+        p_cfg->iterations   = 20000U;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Run benchmark
+*
+* @param[in]    p_cfg   - Pointer to benchmark configuration
+* @return       status  - eFM25_OK if no torn transaction or lost request was detected
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bench_mt_run(const fm25_bench_mt_cfg_t * const p_cfg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if  (   ( NULL == p_cfg )
+        ||  ( 0U == p_cfg->iterations )
+        ||  ( 0U == p_cfg->thread_num )
+        ||  ( p_cfg->thread_num > FM25_BENCH_MT_THREAD_MAX ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status |= fm25_bench_mt_uncont( p_cfg );
+        status |= fm25_bench_mt_cont( p_cfg );
+        status |= fm25_bench_mt_ring( p_cfg );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined( FM25_BENCH_MT_MAIN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Standalone benchmark executable
+*
+*           Usage: fm25_bench_mt [threads] [iterations]
+*
+* @return   exit code - 0 if no torn transaction or lost request was detected
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+    fm25_bench_mt_cfg_t cfg;
+
+    fm25_bench_mt_default_cfg( &cfg );
+
+    if ( argc > 1 )
+    {
+        cfg.thread_num = (uint32_t) strtoul( argv[1], NULL, 0 );
+    }
+
+    if ( argc > 2 )
+    {
+        cfg.iterations = (uint32_t) strtoul( argv[2], NULL, 0 );
+    }
+
+    return (( eFM25_OK == fm25_bench_mt_run( &cfg )) ? EXIT_SUCCESS : EXIT_FAILURE );
+}
+
+#endif
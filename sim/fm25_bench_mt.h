@@ -0,0 +1,58 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_bench_mt.h
+*@brief     Multi-threaded lock and submission ring benchmark of FM25 driver
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BENCH_MT
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_BENCH_MT_H_
+#define FM25_BENCH_MT_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "../src/fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Benchmark configuration
+ */
+typedef struct
+{
+    FILE *          p_report;       /**<Report output stream, NULL for no report */
+    uint32_t        thread_num;     /**<Number of concurrent writer/producer threads */
+    uint32_t        iterations;     /**<Number of operations per thread */
+} fm25_bench_mt_cfg_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+void            fm25_bench_mt_default_cfg   (fm25_bench_mt_cfg_t * const p_cfg);
+fm25_status_t   fm25_bench_mt_run           (const fm25_bench_mt_cfg_t * const p_cfg);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_BENCH_MT_H_
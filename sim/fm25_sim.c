@@ -0,0 +1,859 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_sim.c
+*@brief     Host side FM25 FRAM device simulator
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_SIM
+* @{ <!-- BEGIN GROUP -->
+*
+*     Byte level model of FM25 FRAM device for host (Linux) builds.
+*
+*     Simulator decodes instruction stream clocked inside each chip select
+*     window and keeps memory array inside mmap'd file so that content
+*     persists between runs. Every clocked byte, chip select assertion and
+*     interface call is accounted into simulated bus time.
+*
+*     Simulated device is attached to driver by "g_fm25_sim_if" interface
+*     with opened "fm25_sim_t" as interface context.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "fm25_sim.h"
+#include "../src/fm25_regdef.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Opcode bit carrying address bit A8 on 9-bit devices
+ */
+#define FM25_SIM_A8_OPCODE_BIT          ( 0x08U )
+
+/**
+ *     Writable status register bits (WPEN, BP1, BP0)
+ */
+#define FM25_SIM_SR_WR_MASK             ( 0x8CU )
+#define FM25_SIM_SR_WEL                 ( 0x02U )
+
+/**
+ *     Picoseconds per nanosecond
+ */
+#define FM25_SIM_PS_PER_NS              ( 1000ULL )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t  fm25_sim_addr_bytes     (const fm25_sim_t * const p_sim);
+static void     fm25_sim_cs_fall        (fm25_sim_t * const p_sim);
+static void     fm25_sim_cs_rise        (fm25_sim_t * const p_sim);
+static uint8_t  fm25_sim_clock_byte     (fm25_sim_t * const p_sim, const uint8_t mosi);
+static void     fm25_sim_decode_opcode  (fm25_sim_t * const p_sim, const uint8_t op);
+static bool     fm25_sim_is_protected   (const fm25_sim_t * const p_sim, const uint32_t addr);
+static void     fm25_sim_clock          (fm25_sim_t * const p_sim, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const bool cs_low_on_entry, const bool cs_high_on_exit);
+static void     fm25_sim_call           (fm25_sim_t * const p_sim);
+
+static fm25_status_t fm25_sim_if_init       (void * const p_ctx);
+static fm25_status_t fm25_sim_if_transmit   (void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+static fm25_status_t fm25_sim_if_receive    (void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+static fm25_status_t fm25_sim_if_transfer_seg   (void * const p_ctx, const fm25_if_seg_t * const p_seg, const uint32_t seg_num);
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Low level interface of simulated device
+ */
+const fm25_if_t g_fm25_sim_if =
+{
+    .pf_init        = fm25_sim_if_init,
+    .pf_deinit      = NULL,
+    .pf_transmit    = fm25_sim_if_transmit,
+    .pf_receive     = fm25_sim_if_receive,
+
+    // Single call segmented transfer, as DMA descriptor chain
+    .pf_transfer_seg    = fm25_sim_if_transfer_seg,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get number of address bytes in command frame
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @return       bytes   - Number of address bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t fm25_sim_addr_bytes(const fm25_sim_t * const p_sim)
+{
+    uint8_t bytes = 3U;
+
+    if ( 9U == p_sim->cfg.addr_bit_num )
+    {
+        bytes = 1U;
+    }
+    else if ( p_sim->cfg.addr_bit_num <= 16U )
+    {
+        bytes = 2U;
+    }
+    else
+    {
+        // No actions...
+    }
+
+    return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Chip select falling edge
+*
+* @note     Falling edge wakes device from sleep mode. Device ignores
+*           whole CS window that wakes it up or starts before recovery
+*           time elapses.
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_sim_cs_fall(fm25_sim_t * const p_sim)
+{
+    p_sim->cs_low   = true;
+    p_sim->ignore   = false;
+    p_sim->idx      = 0U;
+    p_sim->op       = 0U;
+    p_sim->hdr      = 0U;
+    p_sim->addr     = 0U;
+
+    p_sim->stats.cs_assert++;
+    p_sim->now_ps += ((uint64_t) p_sim->cfg.t_cs_ns * FM25_SIM_PS_PER_NS );
+
+    if ( true == p_sim->sleep )
+    {
+        p_sim->sleep    = false;
+        p_sim->wake_ps  = p_sim->now_ps + ((uint64_t) p_sim->cfg.t_rec_ns * FM25_SIM_PS_PER_NS );
+        p_sim->ignore   = true;
+    }
+    else if ( p_sim->now_ps < p_sim->wake_ps )
+    {
+        p_sim->ignore = true;
+        p_sim->stats.violations++;
+    }
+    else
+    {
+        // No actions...
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Chip select rising edge
+*
+* @note     Completed WRITE and WRSR commands clear WEL flag.
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_sim_cs_rise(fm25_sim_t * const p_sim)
+{
+    p_sim->cs_low = false;
+
+    if (( false == p_sim->ignore ) && ( p_sim->idx > 0U ))
+    {
+        switch( p_sim->op )
+        {
+            case eFM25_ISA_WREN:
+                p_sim->sr |= FM25_SIM_SR_WEL;
+                break;
+
+            case eFM25_ISA_WRDI:
+                p_sim->sr &= ~FM25_SIM_SR_WEL;
+                break;
+
+            case eFM25_ISA_WRITE:
+            case eFM25_ISA_WRSR:
+                p_sim->sr &= ~FM25_SIM_SR_WEL;
+                break;
+
+            case eFM25_ISA_SLEEP:
+                p_sim->sleep = p_sim->cfg.sleep_en;
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Decode opcode of CS window
+*
+* @note     9-bit devices encode address bit A8 into bit 3 of READ
+*           and WRITE opcode.
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @param[in]    op      - Opcode
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_sim_decode_opcode(fm25_sim_t * const p_sim, const uint8_t op)
+{
+    p_sim->op = op;
+
+    if ( 9U == p_sim->cfg.addr_bit_num )
+    {
+        const uint8_t op_no_a8 = ( op & ~FM25_SIM_A8_OPCODE_BIT );
+
+        if  (   ( eFM25_ISA_READ == op_no_a8 )
+            ||  ( eFM25_ISA_WRITE == op_no_a8 ))
+        {
+            p_sim->op   = op_no_a8;
+            p_sim->addr = (( op & FM25_SIM_A8_OPCODE_BIT ) ? 0x100U : 0U );
+        }
+    }
+
+    switch( p_sim->op )
+    {
+        case eFM25_ISA_READ:
+            p_sim->hdr = 1U + fm25_sim_addr_bytes( p_sim );
+            p_sim->stats.read++;
+
+            if  (   ( 0U != p_sim->cfg.read_max_hz )
+                &&  ( p_sim->cfg.sck_hz > p_sim->cfg.read_max_hz ))
+            {
+                p_sim->stats.violations++;
+            }
+            break;
+
+        case eFM25_ISA_FSTRD:
+            p_sim->hdr = 2U + fm25_sim_addr_bytes( p_sim );
+            p_sim->stats.read++;
+
+            if ( false == p_sim->cfg.fstrd_en )
+            {
+                p_sim->ignore = true;
+                p_sim->stats.violations++;
+            }
+            break;
+
+        case eFM25_ISA_WRITE:
+            p_sim->hdr = 1U + fm25_sim_addr_bytes( p_sim );
+            p_sim->stats.write++;
+
+            // Write without WEL set is ignored by device
+            if ( 0U == ( p_sim->sr & FM25_SIM_SR_WEL ))
+            {
+                p_sim->ignore = true;
+                p_sim->stats.violations++;
+            }
+            break;
+
+        case eFM25_ISA_WREN:
+            p_sim->stats.wren++;
+            break;
+
+        case eFM25_ISA_RDSR:
+            p_sim->stats.rdsr++;
+            break;
+
+        case eFM25_ISA_RDID:
+        case eFM25_ISA_SNR:
+        case eFM25_ISA_SLEEP:
+        case eFM25_ISA_WRDI:
+        case eFM25_ISA_WRSR:
+            p_sim->stats.other++;
+            break;
+
+        default:
+            p_sim->ignore = true;
+            p_sim->stats.other++;
+            p_sim->stats.violations++;
+            break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check block protection of address
+*
+* @param[in]    p_sim       - Pointer to simulated device
+* @param[in]    addr        - Memory address
+* @return       protected   - True if address is write protected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_sim_is_protected(const fm25_sim_t * const p_sim, const uint32_t addr)
+{
+    const uint8_t bp = (( p_sim->sr >> 2U ) & 0x03U );
+    bool is_prot = false;
+
+    switch( bp )
+    {
+        case 1U:    is_prot = ( addr >= (( p_sim->size / 4U ) * 3U ));  break;
+        case 2U:    is_prot = ( addr >= ( p_sim->size / 2U ));          break;
+        case 3U:    is_prot = true;                                     break;
+        default:                                                        break;
+    }
+
+    return is_prot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Clock single byte through device
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @param[in]    mosi    - Byte on MOSI line
+* @return       miso    - Byte on MISO line
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t fm25_sim_clock_byte(fm25_sim_t * const p_sim, const uint8_t mosi)
+{
+    uint8_t miso = 0xFFU;
+
+    if (( false == p_sim->cs_low ) || ( true == p_sim->ignore ))
+    {
+        // Device not selected or ignoring window
+    }
+    else if ( 0U == p_sim->idx )
+    {
+        fm25_sim_decode_opcode( p_sim, mosi );
+    }
+    else
+    {
+        switch( p_sim->op )
+        {
+            case eFM25_ISA_READ:
+            case eFM25_ISA_FSTRD:
+            case eFM25_ISA_WRITE:
+
+                // Address phase
+                if ( p_sim->idx <= fm25_sim_addr_bytes( p_sim ))
+                {
+                    if ( 9U == p_sim->cfg.addr_bit_num )
+                    {
+                        p_sim->addr = (( p_sim->addr & 0x100U ) | mosi );
+                    }
+                    else
+                    {
+                        p_sim->addr = ((( p_sim->addr << 8U ) | mosi ) & ( p_sim->size - 1U ));
+                    }
+                }
+
+                // Data phase
+                else if ( p_sim->idx >= p_sim->hdr )
+                {
+                    if ( eFM25_ISA_WRITE == p_sim->op )
+                    {
+                        if ( false == fm25_sim_is_protected( p_sim, p_sim->addr ))
+                        {
+                            p_sim->p_mem[ p_sim->addr ] = mosi;
+                        }
+                    }
+                    else
+                    {
+                        miso = p_sim->p_mem[ p_sim->addr ];
+                    }
+
+                    // Device wraps around at end of array
+                    p_sim->addr = (( p_sim->addr + 1U ) & ( p_sim->size - 1U ));
+                }
+
+                // FSTRD dummy byte
+                else
+                {
+                    // No actions...
+                }
+                break;
+
+            case eFM25_ISA_RDSR:
+                miso = p_sim->sr;
+                break;
+
+            case eFM25_ISA_WRSR:
+                if (( 1U == p_sim->idx ) && ( 0U != ( p_sim->sr & FM25_SIM_SR_WEL )))
+                {
+                    p_sim->sr = (( p_sim->sr & ~FM25_SIM_SR_WR_MASK ) | ( mosi & FM25_SIM_SR_WR_MASK ));
+                }
+                break;
+
+            case eFM25_ISA_RDID:
+                miso = ( p_sim->idx <= p_sim->cfg.id_size ) ? p_sim->cfg.id[ p_sim->idx - 1U ] : 0x00U;
+                break;
+
+            case eFM25_ISA_SNR:
+                miso = (( true == p_sim->cfg.sn_en ) && ( p_sim->idx <= FM25_SIM_SN_SIZE )) ? p_sim->cfg.sn[ p_sim->idx - 1U ] : 0x00U;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    p_sim->idx++;
+
+    return miso;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Initialize simulated interface
+*
+* @note     Simulated device shall be opened by "fm25_sim_open()" before.
+*
+* @param[in]    p_ctx   - Pointer to simulated device
+* @return       status  - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_if_init(void * const p_ctx)
+{
+    fm25_status_t               status  = eFM25_OK;
+    const fm25_sim_t * const    p_sim   = (const fm25_sim_t*) p_ctx;
+
+    if (( NULL == p_sim ) || ( false == p_sim->is_open ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Clock bytes through simulated device
+*
+* @param[in]    p_sim           - Pointer to simulated device
+* @param[in]    p_tx            - Transmit data, NULL for dummy bytes
+* @param[out]   p_rx            - Receive data, NULL to drop
+* @param[in]    size            - Number of bytes
+* @param[in]    cs_low_on_entry - Assert chip select before transfer
+* @param[in]    cs_high_on_exit - De-assert chip select after transfer
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_sim_clock(fm25_sim_t * const p_sim, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const bool cs_low_on_entry, const bool cs_high_on_exit)
+{
+    if ( true == cs_low_on_entry )
+    {
+        fm25_sim_cs_fall( p_sim );
+    }
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        const uint8_t mosi = ( NULL != p_tx ) ? p_tx[i] : 0x00U;
+        const uint8_t miso = fm25_sim_clock_byte( p_sim, mosi );
+
+        if ( NULL != p_rx )
+        {
+            p_rx[i] = miso;
+        }
+    }
+
+    if ( true == cs_high_on_exit )
+    {
+        fm25_sim_cs_rise( p_sim );
+    }
+
+    // Bus accounting
+    p_sim->stats.sck_cycles += ( 8ULL * size );
+
+    if ( NULL != p_tx )
+    {
+        p_sim->stats.tx_bytes += size;
+    }
+    else
+    {
+        p_sim->stats.rx_bytes += size;
+    }
+
+    p_sim->now_ps += ((( 8ULL * size ) * 1000000000000ULL ) / p_sim->cfg.sck_hz );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Account host driver setup of single interface call
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_sim_call(fm25_sim_t * const p_sim)
+{
+    p_sim->stats.xfer_calls++;
+    p_sim->now_ps += ((uint64_t) p_sim->cfg.t_call_ns * FM25_SIM_PS_PER_NS );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write bytes to simulated device
+*
+* @param[in]    p_ctx       - Pointer to simulated device
+* @param[in]    p_data      - Pointer to transmit data
+* @param[in]    size        - Size of transmit data
+* @param[in]    cs_action   - Chip select action
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_if_transmit(void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action)
+{
+    return fm25_sim_transfer((fm25_sim_t*) p_ctx, p_data, NULL, size,
+                              ( 0U != ( cs_action & eFM25_CS_LOW_ON_ENTRY )),
+                              ( 0U != ( cs_action & eFM25_CS_HIGH_ON_EXIT )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read bytes from simulated device
+*
+* @param[in]    p_ctx       - Pointer to simulated device
+* @param[out]   p_data      - Pointer to receive data
+* @param[in]    size        - Size of received data
+* @param[in]    cs_action   - Chip select action
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_if_receive(void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action)
+{
+    return fm25_sim_transfer((fm25_sim_t*) p_ctx, NULL, p_data, size,
+                              ( 0U != ( cs_action & eFM25_CS_LOW_ON_ENTRY )),
+                              ( 0U != ( cs_action & eFM25_CS_HIGH_ON_EXIT )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Transfer segments to/from simulated device in single call
+*
+* @param[in]    p_ctx       - Pointer to simulated device
+* @param[in]    p_seg       - Pointer to segments
+* @param[in]    seg_num     - Number of segments
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_if_transfer_seg(void * const p_ctx, const fm25_if_seg_t * const p_seg, const uint32_t seg_num)
+{
+    fm25_status_t       status  = eFM25_OK;
+    fm25_sim_t * const  p_sim   = (fm25_sim_t*) p_ctx;
+
+    if (( NULL != p_sim ) && ( true == p_sim->is_open ) && ( NULL != p_seg ))
+    {
+        for ( uint32_t i = 0U; i < seg_num; i++ )
+        {
+            fm25_sim_clock( p_sim, p_seg[i].p_tx, p_seg[i].p_rx, p_seg[i].size,
+                            ( 0U != ( p_seg[i].cs_action & eFM25_CS_LOW_ON_ENTRY )),
+                            ( 0U != ( p_seg[i].cs_action & eFM25_CS_HIGH_ON_EXIT )));
+        }
+
+        fm25_sim_call( p_sim );
+    }
+    else
+    {
+        status = eFM25_ERROR_SPI;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_SIM
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 simulator API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get default configuration of simulated device
+*
+* @note     Devices with 14 or more address bits are modelled as FM25V
+*           family members supporting RDID, FSTRD and SLEEP commands.
+*
+* @param[out]   p_cfg           - Pointer to configuration
+* @param[in]    addr_bit_num    - Number of address bits
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fm25_sim_default_cfg(fm25_sim_cfg_t * const p_cfg, const uint8_t addr_bit_num)
+{
+    if ( NULL != p_cfg )
+    {
+        memset( p_cfg, 0, sizeof( fm25_sim_cfg_t ));
+
+        p_cfg->p_file       = NULL;
+        p_cfg->addr_bit_num = addr_bit_num;
+        p_cfg->sck_hz       = 20000000UL;
+        p_cfg->read_max_hz  = 0UL;
+        p_cfg->t_cs_ns      = 60UL;
+        p_cfg->t_call_ns    = 0UL;
+        p_cfg->t_rec_ns     = 400000UL;
+
+        if ( addr_bit_num >= 14U )
+        {
+            p_cfg->fstrd_en = true;
+            p_cfg->sleep_en = true;
+            p_cfg->id_size  = FM25_SIM_ID_SIZE_MAX;
+
+            // Continuation code, Cypress manufacturer ID, family/density, sub/revision
+            memset( p_cfg->id, 0x7F, 6U );
+            p_cfg->id[6] = 0xC2U;
+            p_cfg->id[7] = (uint8_t)( 0x20U + addr_bit_num - 13U );
+            p_cfg->id[8] = 0x08U;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open simulated device
+*
+* @param[out]   p_sim   - Pointer to simulated device
+* @param[in]    p_cfg   - Pointer to device configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_sim_open(fm25_sim_t * const p_sim, const fm25_sim_cfg_t * const p_cfg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if  (   ( NULL == p_sim )
+        ||  ( NULL == p_cfg )
+        ||  ( p_cfg->addr_bit_num < 9U )
+        ||  ( p_cfg->addr_bit_num > 19U )
+        ||  ( 0U == p_cfg->sck_hz )
+        ||  ( p_cfg->id_size > FM25_SIM_ID_SIZE_MAX ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        memset( p_sim, 0, sizeof( fm25_sim_t ));
+
+        p_sim->cfg  = *p_cfg;
+        p_sim->size = ( 1UL << p_cfg->addr_bit_num );
+        p_sim->fd   = -1;
+
+        if ( NULL != p_cfg->p_file )
+        {
+            p_sim->fd = open( p_cfg->p_file, ( O_RDWR | O_CREAT ), 0644 );
+
+            if  (   ( p_sim->fd < 0 )
+                ||  ( 0 != ftruncate( p_sim->fd, (off_t) p_sim->size )))
+            {
+                status = eFM25_ERROR_INIT;
+            }
+            else
+            {
+                p_sim->p_mem = mmap( NULL, p_sim->size, ( PROT_READ | PROT_WRITE ), MAP_SHARED, p_sim->fd, 0 );
+            }
+        }
+        else
+        {
+            p_sim->p_mem = mmap( NULL, p_sim->size, ( PROT_READ | PROT_WRITE ), ( MAP_PRIVATE | MAP_ANONYMOUS ), -1, 0 );
+        }
+
+        if (( eFM25_OK == status ) && ( MAP_FAILED != p_sim->p_mem ))
+        {
+            p_sim->is_open = true;
+        }
+        else
+        {
+            if ( p_sim->fd >= 0 )
+            {
+                close( p_sim->fd );
+            }
+
+            p_sim->p_mem    = NULL;
+            p_sim->fd       = -1;
+            status          = eFM25_ERROR_INIT;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Close simulated device
+*
+* @note     Memory array content is flushed to backing file.
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_sim_close(fm25_sim_t * const p_sim)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL != p_sim ) && ( true == p_sim->is_open ))
+    {
+        if ( p_sim->fd >= 0 )
+        {
+            if ( 0 != msync( p_sim->p_mem, p_sim->size, MS_SYNC ))
+            {
+                status = eFM25_ERROR;
+            }
+        }
+
+        munmap( p_sim->p_mem, p_sim->size );
+
+        if ( p_sim->fd >= 0 )
+        {
+            close( p_sim->fd );
+        }
+
+        p_sim->p_mem    = NULL;
+        p_sim->fd       = -1;
+        p_sim->is_open  = false;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Transfer bytes to/from simulated device
+*
+* @note     Either of p_tx or p_rx may be NULL. Without transmit buffer
+*           dummy bytes are clocked to device.
+*
+* @param[in]    p_sim           - Pointer to simulated device
+* @param[in]    p_tx            - Pointer to transmit data
+* @param[out]   p_rx            - Pointer to receive data
+* @param[in]    size            - Size of transfer
+* @param[in]    cs_low_on_entry - Assert chip select before transfer
+* @param[in]    cs_high_on_exit - De-assert chip select after transfer
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_sim_transfer(fm25_sim_t * const p_sim, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const bool cs_low_on_entry, const bool cs_high_on_exit)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL != p_sim ) && ( true == p_sim->is_open ))
+    {
+        fm25_sim_clock( p_sim, p_tx, p_rx, size, cs_low_on_entry, cs_high_on_exit );
+        fm25_sim_call( p_sim );
+    }
+    else
+    {
+        status = eFM25_ERROR_SPI;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Advance simulated time without bus activity
+*
+* @param[in]    p_sim       - Pointer to simulated device
+* @param[in]    delay_ns    - Delay time
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fm25_sim_delay(fm25_sim_t * const p_sim, const uint32_t delay_ns)
+{
+    if ( NULL != p_sim )
+    {
+        p_sim->now_ps += ((uint64_t) delay_ns * FM25_SIM_PS_PER_NS );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get simulated bus statistics
+*
+* @note     Bus time accounts SCK cycles at configured clock, chip select
+*           deselect time and host driver setup time of each interface call.
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @param[out]   p_stats - Pointer to statistics
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fm25_sim_get_stats(const fm25_sim_t * const p_sim, fm25_sim_stats_t * const p_stats)
+{
+    if (( NULL != p_sim ) && ( NULL != p_stats ))
+    {
+        *p_stats = p_sim->stats;
+
+        p_stats->bus_time_ns    = ((( p_sim->stats.sck_cycles * 1000000000ULL ) / p_sim->cfg.sck_hz )
+                                + ( p_sim->stats.cs_assert * p_sim->cfg.t_cs_ns )
+                                + ( p_sim->stats.xfer_calls * p_sim->cfg.t_call_ns ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Reset simulated bus statistics
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fm25_sim_reset_stats(fm25_sim_t * const p_sim)
+{
+    if ( NULL != p_sim )
+    {
+        memset( &p_sim->stats, 0, sizeof( fm25_sim_stats_t ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get direct access to simulated memory array
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @return       p_mem   - Pointer to memory array
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint8_t * fm25_sim_get_mem(const fm25_sim_t * const p_sim)
+{
+    uint8_t * p_mem = NULL;
+
+    if ( NULL != p_sim )
+    {
+        p_mem = p_sim->p_mem;
+    }
+
+    return p_mem;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
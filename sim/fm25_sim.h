@@ -0,0 +1,136 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_sim.h
+*@brief     Host side FM25 FRAM device simulator
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_SIM
+* @{ <!-- BEGIN GROUP -->
+*
+*     Byte level model of FM25 FRAM device for host (Linux) builds.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_SIM_H_
+#define FM25_SIM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../src/fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Maximum size of device ID and serial number
+ */
+#define FM25_SIM_ID_SIZE_MAX            ( 9U )
+#define FM25_SIM_SN_SIZE                ( 8U )
+
+/**
+ *     Simulated device configuration
+ */
+typedef struct
+{
+    const char *    p_file;                         /**<Backing file of memory array, NULL for volatile memory */
+    uint8_t         addr_bit_num;                   /**<Number of address bits (9-19) */
+    uint32_t        sck_hz;                         /**<SPI clock frequency */
+    uint32_t        read_max_hz;                    /**<Maximum SPI clock for READ command, 0 for no limit */
+    uint32_t        t_cs_ns;                        /**<Chip select deselect time between transactions */
+    uint32_t        t_call_ns;                      /**<Host driver setup time per interface call */
+    uint32_t        t_rec_ns;                       /**<Recovery time from sleep mode */
+    bool            fstrd_en;                       /**<Device supports FSTRD command */
+    bool            sleep_en;                       /**<Device supports SLEEP command */
+    bool            sn_en;                          /**<Device supports SNR command */
+    uint8_t         id[FM25_SIM_ID_SIZE_MAX];       /**<Device ID returned by RDID */
+    uint8_t         id_size;                        /**<Size of device ID, 0 when RDID is not supported */
+    uint8_t         sn[FM25_SIM_SN_SIZE];           /**<Serial number returned by SNR */
+} fm25_sim_cfg_t;
+
+/**
+ *     Simulated bus statistics
+ */
+typedef struct
+{
+    uint64_t    sck_cycles;     /**<Number of SPI clock cycles */
+    uint64_t    cs_assert;      /**<Number of chip select assertions */
+    uint64_t    tx_bytes;       /**<Bytes clocked by transmit calls */
+    uint64_t    rx_bytes;       /**<Bytes clocked by receive calls */
+    uint64_t    xfer_calls;     /**<Number of interface transfer calls */
+    uint64_t    bus_time_ns;    /**<Simulated bus time */
+    uint64_t    wren;           /**<Number of WREN commands */
+    uint64_t    read;           /**<Number of READ/FSTRD commands */
+    uint64_t    write;          /**<Number of WRITE commands */
+    uint64_t    rdsr;           /**<Number of RDSR commands */
+    uint64_t    other;          /**<Number of other commands */
+    uint64_t    violations;     /**<Protocol or timing violations */
+} fm25_sim_stats_t;
+
+/**
+ *     Simulated device
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_sim_cfg_t      cfg;        /**<Device configuration */
+    fm25_sim_stats_t    stats;      /**<Bus statistics */
+    uint8_t *           p_mem;      /**<Memory array */
+    uint32_t            size;       /**<Size of memory array in bytes */
+    int                 fd;         /**<Backing file descriptor */
+    uint64_t            now_ps;     /**<Simulated time */
+    uint64_t            wake_ps;    /**<End of sleep recovery */
+    uint32_t            idx;        /**<Byte index inside CS window */
+    uint32_t            addr;       /**<Current memory address */
+    uint8_t             op;         /**<Opcode of current CS window */
+    uint8_t             hdr;        /**<Header size of current command */
+    uint8_t             sr;         /**<Status register */
+    bool                cs_low;     /**<Chip select state */
+    bool                ignore;     /**<Ignore current CS window */
+    bool                sleep;      /**<Device is in sleep mode */
+    bool                is_open;    /**<Device is opened */
+} fm25_sim_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Low level interface of simulated device
+ *
+ * @note    Interface context shall point to opened "fm25_sim_t".
+ */
+extern const fm25_if_t g_fm25_sim_if;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+void            fm25_sim_default_cfg    (fm25_sim_cfg_t * const p_cfg, const uint8_t addr_bit_num);
+fm25_status_t   fm25_sim_open           (fm25_sim_t * const p_sim, const fm25_sim_cfg_t * const p_cfg);
+fm25_status_t   fm25_sim_close          (fm25_sim_t * const p_sim);
+fm25_status_t   fm25_sim_transfer       (fm25_sim_t * const p_sim, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const bool cs_low_on_entry, const bool cs_high_on_exit);
+void            fm25_sim_delay          (fm25_sim_t * const p_sim, const uint32_t delay_ns);
+void            fm25_sim_get_stats      (const fm25_sim_t * const p_sim, fm25_sim_stats_t * const p_stats);
+void            fm25_sim_reset_stats    (fm25_sim_t * const p_sim);
+uint8_t *       fm25_sim_get_mem        (const fm25_sim_t * const p_sim);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_SIM_H_
@@ -0,0 +1,457 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_sim_dma.c
+*@brief     Simulated DMA engine for FM25 device simulator
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_SIM_DMA
+* @{ <!-- BEGIN GROUP -->
+*
+*     Non-blocking interface for simulated device. Started transfers are
+*     executed by worker thread which then reports completion, the same
+*     way as SPI/DMA completion interrupt does on target.
+*
+*     Paced engine holds each transfer for its simulated bus time in
+*     real time without using CPU, thus wall time of host code measures
+*     overlap of bus transfers and processing.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <sys/prctl.h>
+
+#include "fm25_sim_dma.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void *           fm25_sim_dma_worker     (void * p_arg);
+static fm25_status_t    fm25_sim_dma_xfer       (fm25_sim_dma_t * const p_dma, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const fm25_cs_action_t cs_action);
+static fm25_status_t    fm25_sim_dma_start      (fm25_sim_dma_t * const p_dma, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg);
+static fm25_status_t    fm25_sim_dma_run        (fm25_sim_dma_t * const p_dma, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const fm25_cs_action_t cs_action, uint64_t * const p_bus_ns);
+static void             fm25_sim_dma_pace       (const struct timespec * const p_start, const uint64_t bus_ns);
+
+static fm25_status_t    fm25_sim_dma_if_transmit        (void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+static fm25_status_t    fm25_sim_dma_if_receive         (void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+static fm25_status_t    fm25_sim_dma_if_transmit_start  (void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg);
+static fm25_status_t    fm25_sim_dma_if_receive_start   (void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg);
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Low level interface with non-blocking transfers
+ */
+const fm25_if_t g_fm25_sim_dma_if =
+{
+    .pf_init            = NULL,
+    .pf_deinit          = NULL,
+    .pf_transmit        = fm25_sim_dma_if_transmit,
+    .pf_receive         = fm25_sim_dma_if_receive,
+    .pf_transmit_start  = fm25_sim_dma_if_transmit_start,
+    .pf_receive_start   = fm25_sim_dma_if_receive_start,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        DMA worker thread
+*
+* @note     Completion is reported outside of lock so that next transfer
+*           can be started directly from completion callback.
+*
+* @param[in]    p_arg   - Pointer to DMA engine
+* @return       NULL
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void * fm25_sim_dma_worker(void * p_arg)
+{
+    fm25_sim_dma_t * const p_dma = (fm25_sim_dma_t*) p_arg;
+
+    pthread_mutex_lock( &p_dma->mutex );
+
+    while ( true == p_dma->run )
+    {
+        if ( true == p_dma->pending )
+        {
+            const pf_fm25_if_done_t pf_done = p_dma->pf_done;
+            void * const            p_done  = p_dma->p_arg;
+            const bool              is_pace = p_dma->is_pace;
+            uint64_t                bus_ns  = 0U;
+            struct timespec         t_start;
+
+            clock_gettime( CLOCK_MONOTONIC, &t_start );
+
+            const fm25_status_t status = fm25_sim_dma_run( p_dma, p_dma->p_tx, p_dma->p_rx, p_dma->size, p_dma->cs_action, &bus_ns );
+
+            p_dma->pending = false;
+
+            pthread_mutex_unlock( &p_dma->mutex );
+
+            if ( true == is_pace )
+            {
+                fm25_sim_dma_pace( &t_start, bus_ns );
+            }
+
+            pf_done( p_done, status );
+
+            pthread_mutex_lock( &p_dma->mutex );
+        }
+        else
+        {
+            pthread_cond_wait( &p_dma->cond, &p_dma->mutex );
+        }
+    }
+
+    pthread_mutex_unlock( &p_dma->mutex );
+
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Blocking transfer
+*
+* @param[in]    p_dma       - Pointer to DMA engine
+* @param[in]    p_tx        - Pointer to transmit data
+* @param[out]   p_rx        - Pointer to receive data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_dma_xfer(fm25_sim_dma_t * const p_dma, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const fm25_cs_action_t cs_action)
+{
+    fm25_status_t   status  = eFM25_OK;
+    bool            is_pace = false;
+    uint64_t        bus_ns  = 0U;
+    struct timespec t_start;
+
+    clock_gettime( CLOCK_MONOTONIC, &t_start );
+
+    pthread_mutex_lock( &p_dma->mutex );
+
+    status  = fm25_sim_dma_run( p_dma, p_tx, p_rx, size, cs_action, &bus_ns );
+    is_pace = p_dma->is_pace;
+
+    pthread_mutex_unlock( &p_dma->mutex );
+
+    if ( true == is_pace )
+    {
+        fm25_sim_dma_pace( &t_start, bus_ns );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Execute transfer on simulated device
+*
+* @note     Called with engine mutex held.
+*
+* @param[in]    p_dma       - Pointer to DMA engine
+* @param[in]    p_tx        - Pointer to transmit data
+* @param[out]   p_rx        - Pointer to receive data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @param[out]   p_bus_ns    - Simulated bus time of transfer
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_dma_run(fm25_sim_dma_t * const p_dma, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const fm25_cs_action_t cs_action, uint64_t * const p_bus_ns)
+{
+    fm25_status_t       status  = eFM25_OK;
+    fm25_sim_stats_t    before;
+    fm25_sim_stats_t    after;
+
+    fm25_sim_get_stats( p_dma->p_sim, &before );
+
+    status = fm25_sim_transfer( p_dma->p_sim, p_tx, p_rx, size,
+                                ( 0U != ( cs_action & eFM25_CS_LOW_ON_ENTRY )),
+                                ( 0U != ( cs_action & eFM25_CS_HIGH_ON_EXIT )));
+
+    fm25_sim_get_stats( p_dma->p_sim, &after );
+
+    *p_bus_ns = ( after.bus_time_ns - before.bus_time_ns );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Hold transfer for its simulated bus time
+*
+* @note     Sleeps, thus CPU is free for other threads as it is during
+*           DMA transfer on target.
+*
+* @param[in]    p_start     - Real time at start of transfer
+* @param[in]    bus_ns      - Simulated bus time of transfer
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_sim_dma_pace(const struct timespec * const p_start, const uint64_t bus_ns)
+{
+    struct timespec t_end = *p_start;
+
+    // Default timer slack of 50 us is comparable to chunk transfer
+    (void) prctl( PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL );
+
+    t_end.tv_sec   += (time_t)( bus_ns / 1000000000ULL );
+    t_end.tv_nsec  += (long)( bus_ns % 1000000000ULL );
+
+    if ( t_end.tv_nsec >= 1000000000L )
+    {
+        t_end.tv_sec++;
+        t_end.tv_nsec -= 1000000000L;
+    }
+
+    while ( 0 != clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &t_end, NULL ))
+    {
+        // Interrupted by signal, sleep remainder
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Start non-blocking transfer
+*
+* @param[in]    p_dma       - Pointer to DMA engine
+* @param[in]    p_tx        - Pointer to transmit data
+* @param[out]   p_rx        - Pointer to receive data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @param[in]    pf_done     - Completion function
+* @param[in]    p_arg       - Completion argument
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_dma_start(fm25_sim_dma_t * const p_dma, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    pthread_mutex_lock( &p_dma->mutex );
+
+    if  (   ( true == p_dma->pending )
+        ||  ( false == p_dma->run )
+        ||  ( NULL == pf_done ))
+    {
+        status = eFM25_ERROR_SPI;
+    }
+    else
+    {
+        p_dma->p_tx         = p_tx;
+        p_dma->p_rx         = p_rx;
+        p_dma->size         = size;
+        p_dma->cs_action    = cs_action;
+        p_dma->pf_done      = pf_done;
+        p_dma->p_arg        = p_arg;
+        p_dma->pending      = true;
+
+        pthread_cond_signal( &p_dma->cond );
+    }
+
+    pthread_mutex_unlock( &p_dma->mutex );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write bytes to simulated device
+*
+* @param[in]    p_ctx       - Pointer to DMA engine
+* @param[in]    p_data      - Pointer to transmit data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_dma_if_transmit(void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action)
+{
+    return fm25_sim_dma_xfer((fm25_sim_dma_t*) p_ctx, p_data, NULL, size, cs_action );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read bytes from simulated device
+*
+* @param[in]    p_ctx       - Pointer to DMA engine
+* @param[out]   p_data      - Pointer to receive data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_dma_if_receive(void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action)
+{
+    return fm25_sim_dma_xfer((fm25_sim_dma_t*) p_ctx, NULL, p_data, size, cs_action );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Start non-blocking write to simulated device
+*
+* @param[in]    p_ctx       - Pointer to DMA engine
+* @param[in]    p_data      - Pointer to transmit data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @param[in]    pf_done     - Completion function
+* @param[in]    p_arg       - Completion argument
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_dma_if_transmit_start(void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg)
+{
+    return fm25_sim_dma_start((fm25_sim_dma_t*) p_ctx, p_data, NULL, size, cs_action, pf_done, p_arg );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Start non-blocking read from simulated device
+*
+* @param[in]    p_ctx       - Pointer to DMA engine
+* @param[out]   p_data      - Pointer to receive data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @param[in]    pf_done     - Completion function
+* @param[in]    p_arg       - Completion argument
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_sim_dma_if_receive_start(void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg)
+{
+    return fm25_sim_dma_start((fm25_sim_dma_t*) p_ctx, NULL, p_data, size, cs_action, pf_done, p_arg );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_SIM_DMA
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of simulated DMA engine API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open simulated DMA engine
+*
+* @param[out]   p_dma   - Pointer to DMA engine
+* @param[in]    p_sim   - Pointer to opened simulated device
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_sim_dma_open(fm25_sim_dma_t * const p_dma, fm25_sim_t * const p_sim)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_dma ) || ( NULL == p_sim ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        memset( p_dma, 0, sizeof( fm25_sim_dma_t ));
+
+        p_dma->p_sim    = p_sim;
+        p_dma->run      = true;
+
+        pthread_mutex_init( &p_dma->mutex, NULL );
+        pthread_cond_init( &p_dma->cond, NULL );
+
+        if ( 0 != pthread_create( &p_dma->thread, NULL, fm25_sim_dma_worker, p_dma ))
+        {
+            p_dma->run  = false;
+            status      = eFM25_ERROR_INIT;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Close simulated DMA engine
+*
+* @param[in]    p_dma   - Pointer to DMA engine
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_sim_dma_close(fm25_sim_dma_t * const p_dma)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL != p_dma ) && ( true == p_dma->run ))
+    {
+        pthread_mutex_lock( &p_dma->mutex );
+        p_dma->run = false;
+        pthread_cond_signal( &p_dma->cond );
+        pthread_mutex_unlock( &p_dma->mutex );
+
+        pthread_join( p_dma->thread, NULL );
+
+        pthread_mutex_destroy( &p_dma->mutex );
+        pthread_cond_destroy( &p_dma->cond );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Enable/Disable real time pacing of transfers
+*
+* @param[in]    p_dma   - Pointer to DMA engine
+* @param[in]    is_pace - Hold each transfer for its simulated bus time
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_sim_dma_set_pace(fm25_sim_dma_t * const p_dma, const bool is_pace)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL != p_dma ) && ( true == p_dma->run ))
+    {
+        pthread_mutex_lock( &p_dma->mutex );
+        p_dma->is_pace = is_pace;
+        pthread_mutex_unlock( &p_dma->mutex );
+    }
+    else
+    {
+        status = eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,82 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_sim_dma.h
+*@brief     Simulated DMA engine for FM25 device simulator
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_SIM_DMA
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_SIM_DMA_H_
+#define FM25_SIM_DMA_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "fm25_sim.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Simulated DMA engine
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_sim_t *        p_sim;      /**<Simulated device */
+    pthread_t           thread;     /**<Worker thread completing transfers */
+    pthread_mutex_t     mutex;      /**<Guards transfer job and device */
+    pthread_cond_t      cond;       /**<Signals new transfer job */
+    const uint8_t *     p_tx;       /**<Transmit data of pending job */
+    uint8_t *           p_rx;       /**<Receive data of pending job */
+    uint32_t            size;       /**<Size of pending job */
+    fm25_cs_action_t    cs_action;  /**<Chip select action of pending job */
+    pf_fm25_if_done_t   pf_done;    /**<Completion of pending job */
+    void *              p_arg;      /**<Completion argument */
+    bool                pending;    /**<Job is pending */
+    bool                run;        /**<Worker thread is running */
+    bool                is_pace;    /**<Transfers last their simulated bus time in real time */
+} fm25_sim_dma_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Low level interface with non-blocking transfers
+ *
+ * @note    Interface context shall point to opened "fm25_sim_dma_t".
+ */
+extern const fm25_if_t g_fm25_sim_dma_if;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_sim_dma_open     (fm25_sim_dma_t * const p_dma, fm25_sim_t * const p_sim);
+fm25_status_t fm25_sim_dma_close    (fm25_sim_dma_t * const p_dma);
+fm25_status_t fm25_sim_dma_set_pace (fm25_sim_dma_t * const p_dma, const bool is_pace);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_SIM_DMA_H_
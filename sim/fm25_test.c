@@ -0,0 +1,4548 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_test.c
+*@brief     Host tests of FM25 driver on simulated device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*     Functional tests of driver paths that benchmark does not cover.
+*     Each test group runs on its own simulated device and compares
+*     device memory against simple model.
+*
+*     Compile with "FM25_TEST_MAIN" defined for standalone executable.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+
+#include "fm25_test.h"
+#include "fm25_sim.h"
+#include "fm25_sim_dma.h"
+#include "../src/fm25_log.h"
+#include "../src/fm25_blob.h"
+#include "../src/fm25_counter.h"
+#include "../src/fm25_bitmap.h"
+#include "../src/fm25_kv.h"
+#include "../src/fm25_queue.h"
+#include "../src/fm25_par.h"
+#include "../src/fm25_bd.h"
+#include "../src/fm25_ckpt.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Check condition and report failure with line number
+ */
+#define FM25_TEST_CHECK(cond)           fm25_test_check(( cond ), #cond, __LINE__ )
+
+/**
+ *     Timeout of waiting for asynchronous completion in ms
+ */
+#define FM25_TEST_TIMEOUT_MS            ( 2000U )
+
+/**
+ *     Size of tested device
+ *
+ * @note    Density pinned by configuration is tested as is, otherwise
+ *          groups run on 16 kB device, the smallest simulated part with
+ *          SLEEP command. Group regions fit into smallest 9-bit device.
+ */
+#if ( 0 == FM25_CFG_ADDR_BIT_NUM )
+    #define FM25_TEST_ADDR_BIT_NUM      ( 14U )
+#else
+    #define FM25_TEST_ADDR_BIT_NUM      ( FM25_CFG_ADDR_BIT_NUM )
+#endif
+
+#define FM25_TEST_MEM_SIZE              ( 1UL << FM25_TEST_ADDR_BIT_NUM )
+
+/**
+ *     Sleep governor: simulated time per tick, idle time before sleep,
+ *     recovery time in ticks equal to tREC of simulated part and smallest
+ *     simulated part with SLEEP command
+ */
+#define FM25_TEST_SLEEP_TICK_NS         ( 1000U )
+#define FM25_TEST_SLEEP_IDLE            ( 100U )
+#define FM25_TEST_SLEEP_WAKE_TIME       ( 400U )
+#define FM25_TEST_SLEEP_ADDR_BIT_MIN    ( 14U )
+
+/**
+ *     Sleep test: accessed range
+ */
+#define FM25_TEST_SLEEP_ADDR            ( 0x050U )
+#define FM25_TEST_SLEEP_SIZE            ( 8U )
+
+/**
+ *     Asynchronous test: number of requests
+ */
+#define FM25_TEST_ASYNC_REQ_NUM         ( 12U )
+
+/**
+ *     Log test: region, commit period, maximum record payload, number
+ *     of appends, remount period and number of appends cut at each byte
+ */
+#define FM25_TEST_LOG_ADDR              ( 0x010U )
+#define FM25_TEST_LOG_SIZE              (( 2U * FM25_LOG_SB_SIZE ) + 400U )
+#define FM25_TEST_LOG_COMMIT_NUM        ( 4U )
+#define FM25_TEST_LOG_REC_SIZE_MAX      ( 48U )
+#define FM25_TEST_LOG_APPEND_NUM        ( 100U )
+#define FM25_TEST_LOG_REMOUNT_NUM       ( 3U )
+#define FM25_TEST_LOG_CUT_NUM           ( 16U )
+
+/**
+ *     Blob test: region, maximum blob size and number of commits
+ *
+ * @note    Commits span more than one wrap of 8-bit sequence number.
+ */
+#define FM25_TEST_BLOB_ADDR             ( 0x100U )
+#define FM25_TEST_BLOB_SIZE             ( 64U )
+#define FM25_TEST_BLOB_COMMIT_NUM       ( 300U )
+
+/**
+ *     Counter test: device address
+ */
+#define FM25_TEST_COUNTER_ADDR          ( 0x040U )
+
+/**
+ *     Bitmap test: region, number of units (not multiple of 8, more than
+ *     one scan chunk) and number of random operations
+ */
+#define FM25_TEST_BITMAP_ADDR           ( 0x100U )
+#define FM25_TEST_BITMAP_BIT_NUM        ( 301U )
+#define FM25_TEST_BITMAP_OP_NUM         ( 3000U )
+
+/**
+ *     Key-value test: region of eight buckets, maximum value size,
+ *     number of keys, random operations and remount period
+ *
+ * @note    Keys outnumber buckets, thus store gets full.
+ */
+#define FM25_TEST_KV_ADDR               ( 0x010U )
+#define FM25_TEST_KV_VALUE_MAX          ( 16U )
+#define FM25_TEST_KV_BUCKET_NUM         ( 8U )
+#define FM25_TEST_KV_SIZE               ( sizeof( fm25_kv_hdr_t ) + ( FM25_TEST_KV_BUCKET_NUM * ( sizeof( uint32_t ) + FM25_KV_REC_SIZE + FM25_TEST_KV_VALUE_MAX )))
+#define FM25_TEST_KV_KEY_NUM            ( 24U )
+#define FM25_TEST_KV_OP_NUM             ( 2000U )
+#define FM25_TEST_KV_REMOUNT_NUM        ( 50U )
+
+/**
+ *     Index entry of deleted bucket as stored on device
+ */
+#define FM25_TEST_KV_TOMB               ( 0xFFFFFFFFUL )
+
+/**
+ *     Queue test: requests per round, maximum request size, merge buffer
+ *     size, address window of random requests and number of rounds
+ */
+#define FM25_TEST_QUEUE_REQ_NUM         ( 16U )
+#define FM25_TEST_QUEUE_SIZE_MAX        ( 32U )
+#define FM25_TEST_QUEUE_BUF_SIZE        ( 64U )
+#define FM25_TEST_QUEUE_WINDOW          ( 256U )
+#define FM25_TEST_QUEUE_ROUND_NUM       ( 50U )
+
+/**
+ *     Copy test range and number of device setups
+ *
+ * @note    Copy runs through bounce buffer and, with RAM shadow enabled,
+ *          once more straight from shadow.
+ */
+#define FM25_TEST_COPY_ADDR             ( 0x020U )
+#define FM25_TEST_COPY_SIZE             ( 300U )
+#define FM25_TEST_COPY_MODE_NUM         ( 1U + FM25_CFG_SHADOW_EN )
+
+/**
+ *     Vectored transfer test: size of fixed segments, maximum number
+ *     and size of random segments, window of random segments at end of
+ *     memory and number of random rounds
+ */
+#define FM25_TEST_IOV_ADDR              ( 0x040U )
+#define FM25_TEST_IOV_SIZE              ( 16U )
+#define FM25_TEST_IOV_SEG_NUM           ( 8U )
+#define FM25_TEST_IOV_SEG_SIZE          ( 24U )
+#define FM25_TEST_IOV_WINDOW            ( 256U )
+#define FM25_TEST_IOV_ROUND_NUM         ( 200U )
+
+/**
+ *     Size of read/write command frame, longest read gap bridged inside
+ *     single command
+ */
+#define FM25_TEST_IOV_CMD_SIZE          (( 9U == FM25_TEST_ADDR_BIT_NUM ) ? 2U : (( FM25_TEST_ADDR_BIT_NUM <= 16U ) ? 3U : 4U ))
+
+/**
+ *     Fill test: start address of ranges and erase value of driver
+ */
+#define FM25_TEST_FILL_ADDR             ( 0x011U )
+#define FM25_TEST_ERASE_VALUE           ( 0xFFU )
+
+/**
+ *     Block device test: region start, block size, read and program size
+ */
+#define FM25_TEST_BD_ADDR               ( 0x013U )
+#define FM25_TEST_BD_BLOCK_SIZE         ( 64U )
+#define FM25_TEST_BD_READ_SIZE          ( 4U )
+#define FM25_TEST_BD_PROG_SIZE          ( 8U )
+
+/**
+ *     Checkpoint test: state address and size (not multiple of hash
+ *     block), number of write segments, merge threshold and number of
+ *     random rounds
+ */
+#define FM25_TEST_CKPT_ADDR             ( 0x021U )
+#define FM25_TEST_CKPT_SIZE             ( 300U )
+#define FM25_TEST_CKPT_IOV_NUM          ( 4U )
+#define FM25_TEST_CKPT_GAP              ( 8U )
+#define FM25_TEST_CKPT_ROUND_NUM        ( 200U )
+
+/**
+ *     Shadow test: address of pointer check, maximum size of operation,
+ *     number of operation kinds (asynchronous write being last one),
+ *     number of random rounds and of busy polls of asynchronous write
+ */
+#define FM25_TEST_SHADOW_ADDR           ( 0x030U )
+#define FM25_TEST_SHADOW_SIZE_MAX       ( 64U )
+#define FM25_TEST_SHADOW_KIND_NUM       ( 6U + FM25_CFG_ASYNC_EN )
+#define FM25_TEST_SHADOW_ROUND_NUM      ( 500U )
+#define FM25_TEST_SHADOW_POLL_NUM       ( 1000000UL )
+
+/**
+ *     Verify test range
+ *
+ * @note    Range of "2 * FM25_CFG_VERIFY_SAMPLE_NUM - 1" chunks, last one
+ *          partial, is sampled at every even chunk, thus sampled mode
+ *          skips second chunk.
+ */
+#define FM25_TEST_VERIFY_ADDR           ( 0x010U )
+#define FM25_TEST_VERIFY_SIZE           ((( 2U * FM25_CFG_VERIFY_SAMPLE_NUM - 1U ) * FM25_CFG_VERIFY_CHUNK_SIZE ) - 1U )
+#define FM25_TEST_VERIFY_NO_FAULT       ( 0xFFFFFFFFUL )
+
+#if ( 1 == FM25_CFG_PAR_EN )
+
+    /**
+     *     Parameter table layouts other than current one
+     *
+     * @note    Layouts are derived from "FM25_PAR_LIST", thus they differ
+     *          from any configured table: one parameter appended and all
+     *          parameters stored one byte wider.
+     */
+    #define FM25_TEST_PAR_APPEND_LIST(X)                            FM25_PAR_LIST( X ) X( test_append, uint8_t, 0U, 0U, 0U )
+    #define FM25_TEST_PAR_WIDE_MEMBER(name, type, def, min, max)    uint8_t name[sizeof( type ) + 1U];
+    #define FM25_TEST_PAR_APPEND_ITEM(name, type, def, min, max)    FM25_PAR_SIG_TERM( fm25_test_par_append_t, name, type )
+    #define FM25_TEST_PAR_WIDE_ITEM(name, type, def, min, max)      FM25_PAR_SIG_TERM( fm25_test_par_wide_t, name, type )
+
+    /**
+     *     Default values and comparison of parameter tables
+     */
+    #define FM25_TEST_PAR_DEFAULT(name, type, def, min, max)        .name = ( def ),
+    #define FM25_TEST_PAR_IS_EQUAL(name, type, def, min, max)       && ( 0 == memcmp( &p_a->name, &p_b->name, sizeof( type )))
+
+    /**
+     *     Byte of table content written by previous layout
+     */
+    #define FM25_TEST_PAR_OLD_BYTE                                  ( 0xA5U )
+
+#endif
+
+/**
+ *     Test group
+ */
+typedef struct
+{
+    const char *    p_name;         /**<Name of group */
+    void            (*pf_test)(void);   /**<Test function */
+} fm25_test_group_t;
+
+#if ( 1 == FM25_CFG_ASYNC_EN )
+
+    /**
+     *     Asynchronous test request
+     */
+    typedef struct
+    {
+        fm25_async_t    req;                /**<Request storage */
+        bool            is_write;           /**<Write request */
+        uint32_t        addr;               /**<Start address */
+        uint32_t        size;               /**<Size in bytes */
+        uint8_t         data[256];          /**<Write data or read buffer */
+        uint8_t         expect[256];        /**<Expected read data */
+        fm25_status_t   status;             /**<Status reported by callback */
+        fm25_status_t   sync_status;        /**<Status of sync call from callback */
+        uint32_t        order;              /**<Completion order */
+        bool            is_done;            /**<Callback called */
+    } fm25_test_async_req_t;
+
+#endif
+
+/**
+ *     Model of log content
+ *
+ * @note    Record payload is function of its sequence number.
+ */
+typedef struct
+{
+    uint32_t    first;      /**<Sequence number of oldest record */
+    uint32_t    next;       /**<Sequence number of next record */
+    uint32_t    used;       /**<Bytes taken by records, headers included */
+    uint32_t    tail;       /**<Ring offset of next record */
+} fm25_test_log_model_t;
+
+/**
+ *     Model of key-value store key
+ */
+typedef struct
+{
+    uint8_t     data[FM25_TEST_KV_VALUE_MAX];   /**<Value */
+    uint32_t    size;                           /**<Size of value */
+    bool        is_set;                         /**<Key is present */
+} fm25_test_kv_model_t;
+
+/**
+ *     Queue test request
+ */
+typedef struct
+{
+    fm25_queue_req_t    req;                                /**<Request storage */
+    uint8_t             data[FM25_TEST_QUEUE_SIZE_MAX];     /**<Write data or read buffer */
+    uint8_t             expect[FM25_TEST_QUEUE_SIZE_MAX];   /**<Expected read data */
+    uint32_t            size;                               /**<Size in bytes */
+    uint32_t            order;                              /**<Completion order */
+    fm25_status_t       status;                             /**<Status reported by callback */
+    bool                is_write;                           /**<Write request */
+    bool                is_done;                            /**<Callback called */
+} fm25_test_queue_req_t;
+
+#if ( 1 == FM25_CFG_PAR_EN )
+
+    /**
+     *     Packed images of other parameter table layouts
+     */
+    typedef struct
+    {
+        FM25_TEST_PAR_APPEND_LIST( FM25_PAR_IMAGE_MEMBER )
+    } fm25_test_par_append_t;
+
+    typedef struct
+    {
+        FM25_PAR_LIST( FM25_TEST_PAR_WIDE_MEMBER )
+    } fm25_test_par_wide_t;
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void             fm25_test_check     (const bool is_ok, const char * const p_expr, const uint32_t line);
+static fm25_status_t    fm25_test_open      (fm25_sim_t * const p_sim, fm25_dev_t * const p_dev, const fm25_if_t * const p_if, void * const p_if_ctx, const bool is_sleep);
+static fm25_status_t    fm25_test_open_cfg  (fm25_sim_t * const p_sim, fm25_dev_t * const p_dev, fm25_dev_cfg_t * const p_cfg, const uint8_t * const p_image);
+static uint32_t         fm25_test_tick      (void);
+static fm25_status_t    fm25_test_power_transmit(void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+static fm25_status_t    fm25_test_power_receive (void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+static fm25_status_t    fm25_test_power_open    (fm25_sim_t * const p_sim, fm25_dev_t * const p_dev);
+static fm25_status_t    fm25_test_reboot        (fm25_sim_t * const p_sim, fm25_dev_t * const p_dev, const uint8_t * const p_image);
+static void             fm25_test_power_cut     (const uint32_t byte_num);
+static uint8_t          fm25_test_log_byte      (const uint32_t seq, const uint32_t idx);
+static uint32_t         fm25_test_log_rec_size  (const uint32_t seq);
+static bool             fm25_test_log_model_add (fm25_test_log_model_t * const p_model);
+static fm25_status_t    fm25_test_log_mount     (fm25_log_t * const p_log, fm25_dev_t dev);
+static fm25_status_t    fm25_test_log_add       (fm25_log_t * const p_log, const uint32_t seq);
+static bool             fm25_test_log_scan      (fm25_log_t * const p_log, uint32_t * const p_first, uint32_t * const p_next);
+static void             fm25_test_log           (void);
+static uint8_t          fm25_test_blob_byte     (const uint32_t gen, const uint32_t idx);
+static uint32_t         fm25_test_blob_data_size(const uint32_t gen);
+static uint32_t         fm25_test_blob_data_addr(const uint8_t slot);
+static fm25_status_t    fm25_test_blob_open     (fm25_blob_t * const p_blob, fm25_dev_t dev);
+static fm25_status_t    fm25_test_blob_commit   (fm25_blob_t * const p_blob, const uint32_t gen);
+static bool             fm25_test_blob_is_gen   (fm25_blob_t * const p_blob, const uint32_t gen);
+static bool             fm25_test_blob_is_slot  (const fm25_sim_t * const p_sim, const uint8_t slot, const uint32_t gen);
+static void             fm25_test_blob          (void);
+static void             fm25_test_counter       (void);
+static bool             fm25_test_bitmap_is_model(fm25_bitmap_t * const p_bitmap, const uint8_t * const p_mem, const bool * const p_model);
+static void             fm25_test_bitmap        (void);
+static void             fm25_test_kv_key        (const uint32_t n, char * const p_key);
+static uint32_t         fm25_test_kv_entry      (const fm25_sim_t * const p_sim, const uint32_t idx);
+static fm25_status_t    fm25_test_kv_open       (fm25_kv_t * const p_kv, fm25_dev_t dev, uint32_t * const p_index, const bool is_format);
+static bool             fm25_test_kv_is_key     (fm25_kv_t * const p_kv, const uint32_t n, const fm25_test_kv_model_t * const p_model);
+static bool             fm25_test_kv_is_model   (fm25_kv_t * const p_kv, const fm25_test_kv_model_t * const p_model);
+static fm25_status_t    fm25_test_kv_set        (fm25_kv_t * const p_kv, const uint32_t n, const uint32_t size, const uint32_t seed, fm25_test_kv_model_t * const p_model);
+static void             fm25_test_kv            (void);
+static void             fm25_test_queue_cb      (fm25_queue_req_t * const p_req, const fm25_status_t status, void * const p_arg);
+static uint32_t         fm25_test_queue_tick    (void);
+static fm25_status_t    fm25_test_queue_init    (fm25_queue_t * const p_queue, fm25_dev_t dev, const bool is_merge, const bool is_budget);
+static fm25_status_t    fm25_test_queue_submit  (fm25_queue_t * const p_queue, const uint32_t idx, const bool is_write, const uint8_t prio, const uint32_t addr, const uint32_t size, uint8_t * const p_model);
+static bool             fm25_test_queue_is_done (const uint32_t num);
+static void             fm25_test_queue         (void);
+static void             fm25_test_copy          (void);
+static void             fm25_test_iov           (void);
+static void             fm25_test_fill          (void);
+static void             fm25_test_bd            (void);
+static void             fm25_test_ckpt          (void);
+
+#if ( 1 == FM25_CFG_STATS_EN )
+    static uint32_t     fm25_test_lat_num       (const fm25_stats_t * const p_stats, const fm25_stats_op_t op);
+#endif
+
+#if ( 1 == FM25_CFG_PAR_EN )
+    static bool         fm25_test_par_is_equal  (const fm25_par_t * const p_a, const fm25_par_t * const p_b);
+    static void         fm25_test_par_old       (uint8_t * const p_mem, const uint32_t sig);
+    static void         fm25_test_par           (void);
+#endif
+
+#if ( 1 == FM25_CFG_SHADOW_EN )
+    static void         fm25_test_shadow        (void);
+#endif
+
+#if ( 1 == FM25_CFG_VERIFY_EN )
+    static fm25_status_t fm25_test_stuck_transmit(void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+    static void         fm25_test_verify        (void);
+#endif
+
+#if ( 1 == FM25_CFG_SLEEP_EN )
+    static uint32_t     fm25_test_sleep_tick    (void);
+    static bool         fm25_test_sleep_enter   (fm25_dev_t dev, const fm25_sim_t * const p_sim);
+    static void         fm25_test_sleep         (void);
+#endif
+
+#if ( 1 == FM25_CFG_ASYNC_EN )
+    static bool         fm25_test_wait      (const uint32_t * const p_cnt, const uint32_t num);
+    static void         fm25_test_async_cb  (fm25_dev_t dev, const fm25_status_t status, void * const p_arg);
+    static void         fm25_test_async     (void);
+    static fm25_status_t fm25_test_lock     (void * const p_ctx);
+    static void         fm25_test_unlock    (void * const p_ctx);
+    static void         fm25_test_unlock_isr(void * const p_ctx);
+    static fm25_status_t fm25_test_tx_start (void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg);
+    static fm25_status_t fm25_test_rx_start (void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg);
+    static void         fm25_test_lock_cb   (fm25_dev_t dev, const fm25_status_t status, void * const p_arg);
+    static void         fm25_test_async_lock(void);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Report stream and check counters
+ */
+static FILE *       gp_report       = NULL;
+static uint32_t     g_check_num     = 0U;
+static uint32_t     g_fail_num      = 0U;
+
+/**
+ *     Interface with power fail injection
+ *
+ * @note    Armed interface lets through given number of transmitted
+ *          bytes, power then fails in the middle of transfer and all
+ *          following transfers fail until reboot.
+ */
+static fm25_if_t    g_power_if          = { 0 };
+static uint32_t     g_power_budget      = 0U;
+static bool         g_power_is_armed    = false;
+static bool         g_power_is_off      = false;
+
+/**
+ *     Timestamp of latency histograms
+ */
+static uint32_t     g_test_tick         = 0U;
+
+#if ( 1 == FM25_CFG_VERIFY_EN )
+
+    /**
+     *     Interface with memory cell stuck at zero
+     */
+    static fm25_if_t    g_stuck_if          = { 0 };
+    static uint32_t     g_stuck_addr        = FM25_TEST_VERIFY_NO_FAULT;
+
+#endif
+
+/**
+ *     Queue test requests, completion count and timestamp
+ */
+static fm25_test_queue_req_t    g_queue_req[FM25_TEST_QUEUE_REQ_NUM];
+static uint32_t                 g_queue_done    = 0U;
+static uint32_t                 g_queue_tick    = 0U;
+
+#if ( 1 == FM25_CFG_SLEEP_EN )
+
+    /**
+     *     Simulated device and timestamp of sleep governor
+     */
+    static fm25_sim_t * gp_sleep_sim    = NULL;
+    static uint32_t     g_sleep_tick    = 0U;
+
+#endif
+
+#if ( 1 == FM25_CFG_ASYNC_EN )
+
+    /**
+     *     Asynchronous test state
+     */
+    static fm25_test_async_req_t    g_async_req[FM25_TEST_ASYNC_REQ_NUM];
+    static uint32_t                 g_async_queued  = 0U;
+    static uint32_t                 g_async_done    = 0U;
+
+    /**
+     *     Bus lock of asynchronous lock test
+     */
+    static bool         g_lock_held         = false;
+    static bool         g_lock_fail         = false;
+    static uint32_t     g_lock_num          = 0U;
+    static uint32_t     g_unlock_num        = 0U;
+    static uint32_t     g_unlock_isr_num    = 0U;
+    static uint32_t     g_lock_miss_num     = 0U;
+    static fm25_async_t g_lock_next;
+
+#endif
+
+/**
+ *     Test groups
+ */
+static const fm25_test_group_t g_test_group[] =
+{
+#if ( 1 == FM25_CFG_ASYNC_EN )
+    { "async",      fm25_test_async },
+    { "lock",       fm25_test_async_lock },
+#endif
+    { "log",        fm25_test_log },
+    { "blob",       fm25_test_blob },
+    { "counter",    fm25_test_counter },
+    { "bitmap",     fm25_test_bitmap },
+    { "kv",         fm25_test_kv },
+    { "queue",      fm25_test_queue },
+    { "copy",       fm25_test_copy },
+    { "iov",        fm25_test_iov },
+    { "fill",       fm25_test_fill },
+    { "bd",         fm25_test_bd },
+    { "ckpt",       fm25_test_ckpt },
+#if ( 1 == FM25_CFG_SHADOW_EN )
+    { "shadow",     fm25_test_shadow },
+#endif
+#if ( 1 == FM25_CFG_SLEEP_EN )
+    { "sleep",      fm25_test_sleep },
+#endif
+#if ( 1 == FM25_CFG_VERIFY_EN )
+    { "verify",     fm25_test_verify },
+#endif
+#if ( 1 == FM25_CFG_PAR_EN )
+    { "par",        fm25_test_par },
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Count check and report failure
+*
+* @param[in]    is_ok   - Result of check
+* @param[in]    p_expr  - Checked expression
+* @param[in]    line    - Line of check
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_check(const bool is_ok, const char * const p_expr, const uint32_t line)
+{
+    g_check_num++;
+
+    if ( false == is_ok )
+    {
+        g_fail_num++;
+
+        if ( NULL != gp_report )
+        {
+            fprintf( gp_report, "  FAIL %s:%u: %s\n", __FILE__, line, p_expr );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open simulated device and driver on top of it
+*
+* @note     Simulated memory is volatile and zeroed. Sleep governor runs
+*           on simulated time of opened device.
+*
+* @param[out]   p_sim       - Pointer to simulated device
+* @param[out]   p_dev       - Pointer to device handle
+* @param[in]    p_if        - Interface of driver
+* @param[in]    p_if_ctx    - Interface context, NULL for simulated device
+* @param[in]    is_sleep    - Enable sleep governor
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_open(fm25_sim_t * const p_sim, fm25_dev_t * const p_dev, const fm25_if_t * const p_if, void * const p_if_ctx, const bool is_sleep)
+{
+    fm25_dev_cfg_t dev_cfg =
+    {
+        .p_if       = p_if,
+        .p_if_ctx   = p_if_ctx,
+    };
+
+    #if ( 1 == FM25_CFG_SLEEP_EN )
+        if ( true == is_sleep )
+        {
+            dev_cfg.pf_get_tick = fm25_test_sleep_tick;
+            dev_cfg.sleep_idle  = FM25_TEST_SLEEP_IDLE;
+            dev_cfg.wake_time   = FM25_TEST_SLEEP_WAKE_TIME;
+
+            gp_sleep_sim    = p_sim;
+            g_sleep_tick    = 0U;
+        }
+    #else
+        (void) is_sleep;
+    #endif
+
+    return fm25_test_open_cfg( p_sim, p_dev, &dev_cfg, NULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open simulated device with given memory content and driver
+*        configuration
+*
+* @note     Memory content is in place before driver opens, thus it is
+*           also what RAM shadow loads.
+*
+* @param[out]   p_sim       - Pointer to simulated device
+* @param[out]   p_dev       - Pointer to device handle
+* @param[in]    p_cfg       - Driver configuration, interface context and
+*                             density are completed for simulated device
+* @param[in]    p_image     - Memory content, NULL for zeroed memory
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_open_cfg(fm25_sim_t * const p_sim, fm25_dev_t * const p_dev, fm25_dev_cfg_t * const p_cfg, const uint8_t * const p_image)
+{
+    fm25_status_t   status  = eFM25_OK;
+    fm25_sim_cfg_t  sim_cfg = { 0 };
+
+    fm25_sim_default_cfg( &sim_cfg, FM25_TEST_ADDR_BIT_NUM );
+
+    status = fm25_sim_open( p_sim, &sim_cfg );
+
+    if ( eFM25_OK == status )
+    {
+        if ( NULL == p_cfg->p_if_ctx )
+        {
+            p_cfg->p_if_ctx = p_sim;
+        }
+
+        p_cfg->addr_bit_num = FM25_TEST_ADDR_BIT_NUM;
+
+        if ( NULL != p_image )
+        {
+            memcpy( fm25_sim_get_mem( p_sim ), p_image, FM25_TEST_MEM_SIZE );
+        }
+        else
+        {
+            memset( fm25_sim_get_mem( p_sim ), 0, FM25_TEST_MEM_SIZE );
+        }
+
+        status = fm25_open( p_dev, p_cfg );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Timestamp of latency histograms
+*
+* @note     Advances by one tick per call.
+*
+* @return       tick    - Timestamp in ticks
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_test_tick(void)
+{
+    g_test_tick++;
+
+    return g_test_tick;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Transmit to simulated device unless power failed
+*
+* @param[in]    p_ctx       - Pointer to simulated device
+* @param[in]    p_data      - Pointer to transmit data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @return       status      - "eFM25_ERROR_SPI" once power failed
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_power_transmit(void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if ( true == g_power_is_off )
+    {
+        status = eFM25_ERROR_SPI;
+    }
+    else if (( true == g_power_is_armed ) && ( g_power_budget < size ))
+    {
+        // Device sees only bytes clocked before power fails
+        if ( 0U < g_power_budget )
+        {
+            (void) fm25_sim_transfer((fm25_sim_t*) p_ctx, p_data, NULL, g_power_budget, ( 0U != ( cs_action & eFM25_CS_LOW_ON_ENTRY )), false );
+        }
+
+        g_power_is_off  = true;
+        status          = eFM25_ERROR_SPI;
+    }
+    else
+    {
+        if ( true == g_power_is_armed )
+        {
+            g_power_budget -= size;
+        }
+
+        status = g_fm25_sim_if.pf_transmit( p_ctx, p_data, size, cs_action );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Receive from simulated device unless power failed
+*
+* @param[in]    p_ctx       - Pointer to simulated device
+* @param[out]   p_data      - Pointer to receive data
+* @param[in]    size        - Size of transfer
+* @param[in]    cs_action   - Chip select action
+* @return       status      - "eFM25_ERROR_SPI" once power failed
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_power_receive(void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action)
+{
+    fm25_status_t status = eFM25_ERROR_SPI;
+
+    if ( false == g_power_is_off )
+    {
+        status = g_fm25_sim_if.pf_receive( p_ctx, p_data, size, cs_action );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open zeroed simulated device behind power fail interface
+*
+* @note     Segmented transfer is disabled, thus power can fail at any
+*           byte of transaction.
+*
+* @param[out]   p_sim   - Pointer to simulated device
+* @param[out]   p_dev   - Pointer to device handle
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_power_open(fm25_sim_t * const p_sim, fm25_dev_t * const p_dev)
+{
+    g_power_if                  = g_fm25_sim_if;
+    g_power_if.pf_transmit      = fm25_test_power_transmit;
+    g_power_if.pf_receive       = fm25_test_power_receive;
+    g_power_if.pf_transfer_seg  = NULL;
+
+    g_power_is_armed    = false;
+    g_power_is_off      = false;
+
+    return fm25_test_open( p_sim, p_dev, &g_power_if, NULL, false );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Power cycle simulated device and reopen driver
+*
+* @param[in,out]    p_sim   - Pointer to simulated device
+* @param[in,out]    p_dev   - Pointer to device handle
+* @param[in]        p_image - Memory content after reboot, NULL to keep current
+* @return           status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_reboot(fm25_sim_t * const p_sim, fm25_dev_t * const p_dev, const uint8_t * const p_image)
+{
+    static uint8_t  mem[FM25_TEST_MEM_SIZE];
+    fm25_status_t   status = eFM25_OK;
+
+    memcpy( mem, (( NULL != p_image ) ? p_image : fm25_sim_get_mem( p_sim )), sizeof( mem ));
+
+    (void) fm25_close( *p_dev );
+    (void) fm25_sim_close( p_sim );
+
+    *p_dev = NULL;
+
+    status = fm25_test_power_open( p_sim, p_dev );
+
+    if ( eFM25_OK == status )
+    {
+        memcpy( fm25_sim_get_mem( p_sim ), mem, sizeof( mem ));
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Arm power failure
+*
+* @param[in]    byte_num    - Number of transmitted bytes before power fails
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_power_cut(const uint32_t byte_num)
+{
+    g_power_budget      = byte_num;
+    g_power_is_armed    = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Payload byte of log record
+*
+* @param[in]    seq     - Sequence number of record
+* @param[in]    idx     - Index of byte in payload
+* @return       byte    - Payload byte
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t fm25_test_log_byte(const uint32_t seq, const uint32_t idx)
+{
+    return (uint8_t)(( seq * 31U ) + ( idx * 7U ) + 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Payload size of log record
+*
+* @param[in]    seq     - Sequence number of record
+* @return       size    - Payload size in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_test_log_rec_size(const uint32_t seq)
+{
+    return ( 1U + (( seq * 13U ) % FM25_TEST_LOG_REC_SIZE_MAX ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Append next record to model
+*
+* @note     Oldest records are dropped until new one fits, the same as
+*           "fm25_log_append()" does.
+*
+* @param[in,out]    p_model - Pointer to model
+* @return           is_wrap - True if record crosses end of ring
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_test_log_model_add(fm25_test_log_model_t * const p_model)
+{
+    const uint32_t  ring_size   = ( FM25_TEST_LOG_SIZE - ( 2U * FM25_LOG_SB_SIZE ));
+    const uint32_t  need        = ( FM25_LOG_HDR_SIZE + fm25_test_log_rec_size( p_model->next ));
+    const bool      is_wrap     = (( p_model->tail + need ) > ring_size );
+
+    while (( ring_size - p_model->used ) < need )
+    {
+        p_model->used -= ( FM25_LOG_HDR_SIZE + fm25_test_log_rec_size( p_model->first ));
+        p_model->first++;
+    }
+
+    p_model->used += need;
+    p_model->tail = (( p_model->tail + need ) % ring_size );
+    p_model->next++;
+
+    return is_wrap;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Mount test log
+*
+* @param[out]   p_log   - Pointer to log
+* @param[in]    dev     - Device handle
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_log_mount(fm25_log_t * const p_log, fm25_dev_t dev)
+{
+    const fm25_log_cfg_t log_cfg =
+    {
+        .dev        = dev,
+        .addr       = FM25_TEST_LOG_ADDR,
+        .size       = FM25_TEST_LOG_SIZE,
+        .commit_num = FM25_TEST_LOG_COMMIT_NUM,
+    };
+
+    return fm25_log_mount( p_log, &log_cfg );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Append record of given sequence number
+*
+* @param[in]    p_log   - Pointer to log
+* @param[in]    seq     - Sequence number of record
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_log_add(fm25_log_t * const p_log, const uint32_t seq)
+{
+    uint8_t         data[FM25_TEST_LOG_REC_SIZE_MAX];
+    const uint32_t  size = fm25_test_log_rec_size( seq );
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        data[i] = fm25_test_log_byte( seq, i );
+    }
+
+    return fm25_log_append( p_log, data, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Iterate log and check each record against its sequence number
+*
+* @param[in]    p_log   - Pointer to log
+* @param[out]   p_first - Sequence number of oldest record
+* @param[out]   p_next  - Sequence number following newest record
+* @return       is_ok   - True if records are consecutive and intact
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_test_log_scan(fm25_log_t * const p_log, uint32_t * const p_first, uint32_t * const p_next)
+{
+    fm25_log_iter_t it          = { 0 };
+    fm25_log_info_t info        = { 0 };
+    uint8_t         data[FM25_TEST_LOG_REC_SIZE_MAX];
+    bool            is_rec      = false;
+    bool            is_ok       = true;
+    uint32_t        num         = 0U;
+
+    is_ok = ( eFM25_OK == fm25_log_iter_first( p_log, &it, &is_rec ));
+
+    *p_first    = it.seq;
+    *p_next     = it.seq;
+
+    while (( true == is_ok ) && ( true == is_rec ))
+    {
+        const uint32_t size = fm25_test_log_rec_size( it.seq );
+
+        is_ok   = ( it.seq == *p_next )
+                && ( it.size == size )
+                && ( eFM25_OK == fm25_log_iter_read( p_log, &it, 0U, size, data ));
+
+        for ( uint32_t i = 0U; ( i < size ) && ( true == is_ok ); i++ )
+        {
+            is_ok = ( fm25_test_log_byte( it.seq, i ) == data[i] );
+        }
+
+        ( *p_next )++;
+        num++;
+
+        is_ok &= ( eFM25_OK == fm25_log_iter_next( p_log, &it, &is_rec ));
+    }
+
+    if ( false == is_rec )
+    {
+        is_ok &= ( eFM25_OK == fm25_log_get_info( p_log, &info ));
+        is_ok &= ( info.rec_num == num );
+    }
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Ring log recovery after remount and power failure
+*
+* @note     Records are appended across end of ring and log is remounted
+*           without sync, records since last commit shall be rolled
+*           forward. Then power fails at each byte of several appends,
+*           recovered log shall hold records before append, with or
+*           without new record (oldest ones may be dropped already), and
+*           shall accept further appends.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_log(void)
+{
+    static uint8_t          image[FM25_TEST_MEM_SIZE];
+    fm25_test_log_model_t   model       = { 0 };
+    fm25_sim_t              sim         = { 0 };
+    fm25_log_t              log;
+    fm25_log_info_t         info        = { 0 };
+    fm25_dev_t              dev         = NULL;
+    fm25_status_t           status      = eFM25_OK;
+    uint32_t                first       = 0U;
+    uint32_t                next        = 0U;
+    uint32_t                wrap_num    = 0U;
+    uint32_t                recover_num = 0U;
+
+    const fm25_log_cfg_t log_cfg =
+    {
+        .addr       = FM25_TEST_LOG_ADDR,
+        .size       = FM25_TEST_LOG_SIZE,
+        .commit_num = FM25_TEST_LOG_COMMIT_NUM,
+    };
+
+    status = fm25_test_power_open( &sim, &dev );
+
+    if ( eFM25_OK == status )
+    {
+        fm25_log_cfg_t cfg = log_cfg;
+
+        cfg.dev = dev;
+        status  = fm25_log_format( &log, &cfg );
+    }
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        // Appends across end of ring, remount without sync
+        for ( uint32_t i = 0U; ( i < FM25_TEST_LOG_APPEND_NUM ) && ( eFM25_OK == status ); i++ )
+        {
+            status = fm25_test_log_add( &log, model.next );
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+
+            wrap_num += ( true == fm25_test_log_model_add( &model )) ? 1U : 0U;
+
+            if ( 0U == ( i % FM25_TEST_LOG_REMOUNT_NUM ))
+            {
+                status = fm25_test_reboot( &sim, &dev, NULL );
+                status |= fm25_test_log_mount( &log, dev );
+                status |= fm25_log_get_info( &log, &info );
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK( true == fm25_test_log_scan( &log, &first, &next ));
+                FM25_TEST_CHECK(( model.first == first ) && ( model.next == next ));
+
+                recover_num += info.recovered;
+            }
+        }
+
+        FM25_TEST_CHECK( 0U < wrap_num );
+        FM25_TEST_CHECK( 0U < recover_num );
+
+        // Power fails at each byte of append
+        wrap_num = 0U;
+
+        for ( uint32_t i = 0U; ( i < FM25_TEST_LOG_CUT_NUM ) && ( eFM25_OK == status ); i++ )
+        {
+            fm25_test_log_model_t   after   = model;
+            bool                    is_cut  = true;
+
+            wrap_num += ( true == fm25_test_log_model_add( &after )) ? 1U : 0U;
+
+            memcpy( image, fm25_sim_get_mem( &sim ), sizeof( image ));
+
+            for ( uint32_t byte_num = 0U; ( true == is_cut ) && ( eFM25_OK == status ); byte_num++ )
+            {
+                fm25_status_t add_status = eFM25_OK;
+
+                status = fm25_test_reboot( &sim, &dev, image );
+                status |= fm25_test_log_mount( &log, dev );
+
+                fm25_test_power_cut( byte_num );
+
+                add_status  = fm25_test_log_add( &log, model.next );
+                is_cut      = g_power_is_off;
+
+                status |= fm25_test_reboot( &sim, &dev, NULL );
+                status |= fm25_test_log_mount( &log, dev );
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK( true == fm25_test_log_scan( &log, &first, &next ));
+
+                if ( false == is_cut )
+                {
+                    FM25_TEST_CHECK( eFM25_OK == add_status );
+                    FM25_TEST_CHECK(( after.first == first ) && ( after.next == next ));
+                }
+                else
+                {
+                    fm25_test_log_model_t recovered = ( after.next == next ) ? after : model;
+
+                    FM25_TEST_CHECK(    (( model.next == next ) && (( model.first == first ) || ( after.first == first )))
+                                    ||  (( after.next == next ) && ( after.first == first )));
+
+                    // Torn append leaves log usable
+                    recovered.first = first;
+                    recovered.next  = next;
+                    recovered.used  = 0U;
+
+                    for ( uint32_t seq = first; seq < next; seq++ )
+                    {
+                        recovered.used += ( FM25_LOG_HDR_SIZE + fm25_test_log_rec_size( seq ));
+                    }
+
+                    FM25_TEST_CHECK( eFM25_OK == fm25_test_log_add( &log, recovered.next ));
+                    (void) fm25_test_log_model_add( &recovered );
+
+                    status |= fm25_test_reboot( &sim, &dev, NULL );
+                    status |= fm25_test_log_mount( &log, dev );
+
+                    FM25_TEST_CHECK( true == fm25_test_log_scan( &log, &first, &next ));
+                    FM25_TEST_CHECK(( recovered.first == first ) && ( recovered.next == next ));
+                }
+            }
+
+            model = after;
+        }
+
+        FM25_TEST_CHECK( 0U < wrap_num );
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Byte of blob generation
+*
+* @param[in]    gen     - Generation of blob
+* @param[in]    idx     - Index of byte in blob
+* @return       byte    - Blob byte
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t fm25_test_blob_byte(const uint32_t gen, const uint32_t idx)
+{
+    return (uint8_t)(( gen * 53U ) + (( gen >> 8U ) * 17U ) + ( idx * 3U ) + 7U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Size of blob generation
+*
+* @param[in]    gen     - Generation of blob
+* @return       size    - Blob size in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_test_blob_data_size(const uint32_t gen)
+{
+    return ( 1U + (( gen * 11U ) % FM25_TEST_BLOB_SIZE ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Device address of slot data
+*
+* @param[in]    slot    - Slot number, 0 or 1
+* @return       addr    - Device address of blob in slot
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_test_blob_data_addr(const uint8_t slot)
+{
+    return ( FM25_TEST_BLOB_ADDR + 1U + ( slot * ( FM25_BLOB_HDR_SIZE + FM25_TEST_BLOB_SIZE )) + FM25_BLOB_HDR_SIZE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open test blob
+*
+* @param[out]   p_blob  - Pointer to blob
+* @param[in]    dev     - Device handle
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_blob_open(fm25_blob_t * const p_blob, fm25_dev_t dev)
+{
+    const fm25_blob_cfg_t blob_cfg =
+    {
+        .dev    = dev,
+        .addr   = FM25_TEST_BLOB_ADDR,
+        .size   = FM25_TEST_BLOB_SIZE,
+    };
+
+    return fm25_blob_open( p_blob, &blob_cfg );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Commit blob generation
+*
+* @param[in]    p_blob  - Pointer to blob
+* @param[in]    gen     - Generation of blob
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_blob_commit(fm25_blob_t * const p_blob, const uint32_t gen)
+{
+    uint8_t         data[FM25_TEST_BLOB_SIZE];
+    const uint32_t  size = fm25_test_blob_data_size( gen );
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        data[i] = fm25_test_blob_byte( gen, i );
+    }
+
+    return fm25_blob_commit( p_blob, data, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check that blob loads as given generation
+*
+* @param[in]    p_blob  - Pointer to blob
+* @param[in]    gen     - Expected generation, 0 for no blob
+* @return       is_gen  - True if loaded blob is given generation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_test_blob_is_gen(fm25_blob_t * const p_blob, const uint32_t gen)
+{
+    uint8_t     data[FM25_TEST_BLOB_SIZE];
+    uint32_t    size    = 0U;
+    bool        is_gen  = false;
+
+    is_gen = ( eFM25_OK == fm25_blob_load( p_blob, data, sizeof( data ), &size ))
+           && ( size == (( 0U == gen ) ? 0U : fm25_test_blob_data_size( gen )));
+
+    for ( uint32_t i = 0U; ( i < size ) && ( true == is_gen ); i++ )
+    {
+        is_gen = ( fm25_test_blob_byte( gen, i ) == data[i] );
+    }
+
+    return is_gen;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check that slot in device memory holds given generation
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @param[in]    slot    - Slot number, 0 or 1
+* @param[in]    gen     - Generation of blob
+* @return       is_slot - True if slot data matches generation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_test_blob_is_slot(const fm25_sim_t * const p_sim, const uint8_t slot, const uint32_t gen)
+{
+    const uint8_t * const   p_data  = &fm25_sim_get_mem( p_sim )[ fm25_test_blob_data_addr( slot ) ];
+    const uint32_t          size    = fm25_test_blob_data_size( gen );
+    bool                    is_slot = true;
+
+    for ( uint32_t i = 0U; ( i < size ) && ( true == is_slot ); i++ )
+    {
+        is_slot = ( fm25_test_blob_byte( gen, i ) == p_data[i] );
+    }
+
+    return is_slot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        A/B blob slot selection
+*
+* @note     Commits wrap sequence number from 255 to 0, blob shall load
+*           newest generation from slot of marker parity after each
+*           reboot. Damaged inactive slot is ignored, damaged active slot
+*           falls back to previous generation. Power fails at each byte
+*           of commit across sequence wrap, commit interrupted before
+*           marker write completes shall load previous generation.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_blob(void)
+{
+    static uint8_t  image[FM25_TEST_MEM_SIZE];
+    fm25_sim_t      sim         = { 0 };
+    fm25_blob_t     blob;
+    fm25_dev_t      dev         = NULL;
+    fm25_status_t   status      = eFM25_OK;
+    uint8_t *       p_mem       = NULL;
+    uint32_t        gen         = 0U;
+    uint32_t        wrap_num    = 0U;
+    uint32_t        torn_num    = 0U;
+    bool            is_cut      = true;
+
+    status = fm25_test_power_open( &sim, &dev );
+    status |= fm25_test_blob_open( &blob, dev );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        FM25_TEST_CHECK( true == fm25_test_blob_is_gen( &blob, 0U ));
+
+        // Commits across sequence wrap, slot follows marker parity
+        for ( gen = 1U; ( gen <= FM25_TEST_BLOB_COMMIT_NUM ) && ( eFM25_OK == status ); gen++ )
+        {
+            status = fm25_test_blob_commit( &blob, gen );
+            status |= fm25_test_reboot( &sim, &dev, NULL );
+            status |= fm25_test_blob_open( &blob, dev );
+
+            p_mem = fm25_sim_get_mem( &sim );
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+            FM25_TEST_CHECK((uint8_t) gen == p_mem[FM25_TEST_BLOB_ADDR] );
+            FM25_TEST_CHECK( true == fm25_test_blob_is_slot( &sim, ( gen & 1U ), gen ));
+            FM25_TEST_CHECK( true == fm25_test_blob_is_gen( &blob, gen ));
+
+            wrap_num += ( 0U == p_mem[FM25_TEST_BLOB_ADDR] ) ? 1U : 0U;
+        }
+
+        FM25_TEST_CHECK( 0U < wrap_num );
+
+        gen--;
+
+        // Damaged inactive slot is ignored
+        p_mem[ fm25_test_blob_data_addr(( gen - 1U ) & 1U ) ] ^= 0x01U;
+
+        status = fm25_test_reboot( &sim, &dev, NULL );
+        status |= fm25_test_blob_open( &blob, dev );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_blob_is_gen( &blob, gen ));
+
+        // Damaged active slot falls back to previous generation
+        p_mem = fm25_sim_get_mem( &sim );
+        p_mem[ fm25_test_blob_data_addr(( gen - 1U ) & 1U ) ] ^= 0x01U;
+        p_mem[ fm25_test_blob_data_addr( gen & 1U ) ] ^= 0x01U;
+
+        status = fm25_test_reboot( &sim, &dev, NULL );
+        status |= fm25_test_blob_open( &blob, dev );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_blob_is_gen( &blob, ( gen - 1U )));
+
+        // Next commit replaces damaged slot
+        gen++;
+
+        status = fm25_test_blob_commit( &blob, gen );
+        status |= fm25_test_reboot( &sim, &dev, NULL );
+        status |= fm25_test_blob_open( &blob, dev );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_blob_is_slot( &sim, (( gen - 1U ) & 1U ), gen ));
+        FM25_TEST_CHECK( true == fm25_test_blob_is_gen( &blob, gen ));
+
+        // Both slots damaged, no blob
+        p_mem = fm25_sim_get_mem( &sim );
+        p_mem[ fm25_test_blob_data_addr( 0U ) ] ^= 0x01U;
+        p_mem[ fm25_test_blob_data_addr( 1U ) ] ^= 0x01U;
+
+        status = fm25_test_reboot( &sim, &dev, NULL );
+        status |= fm25_test_blob_open( &blob, dev );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_blob_is_gen( &blob, 0U ));
+
+        // Commit until marker is 255, next commit wraps it
+        do
+        {
+            gen++;
+            status = fm25_test_blob_commit( &blob, gen );
+            p_mem = fm25_sim_get_mem( &sim );
+        }
+        while (( eFM25_OK == status ) && ( 0xFFU != p_mem[FM25_TEST_BLOB_ADDR] ));
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+
+        memcpy( image, p_mem, sizeof( image ));
+
+        // Power fails at each byte of commit
+        for ( uint32_t byte_num = 0U; ( true == is_cut ) && ( eFM25_OK == status ); byte_num++ )
+        {
+            fm25_status_t commit_status = eFM25_OK;
+
+            status = fm25_test_reboot( &sim, &dev, image );
+            status |= fm25_test_blob_open( &blob, dev );
+
+            fm25_test_power_cut( byte_num );
+
+            commit_status   = fm25_test_blob_commit( &blob, ( gen + 1U ));
+            is_cut          = g_power_is_off;
+
+            status |= fm25_test_reboot( &sim, &dev, NULL );
+            status |= fm25_test_blob_open( &blob, dev );
+
+            p_mem = fm25_sim_get_mem( &sim );
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+
+            if ( true == is_cut )
+            {
+                FM25_TEST_CHECK( 0xFFU == p_mem[FM25_TEST_BLOB_ADDR] );
+                FM25_TEST_CHECK( true == fm25_test_blob_is_gen( &blob, gen ));
+
+                // Slot complete, marker not written yet
+                torn_num += ( true == fm25_test_blob_is_slot( &sim, 0U, ( gen + 1U ))) ? 1U : 0U;
+            }
+            else
+            {
+                FM25_TEST_CHECK( eFM25_OK == commit_status );
+                FM25_TEST_CHECK( 0x00U == p_mem[FM25_TEST_BLOB_ADDR] );
+                FM25_TEST_CHECK( true == fm25_test_blob_is_gen( &blob, ( gen + 1U )));
+            }
+        }
+
+        FM25_TEST_CHECK( 0U < torn_num );
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Torn counter update
+*
+* @note     For each width, start value and delta every prefix of bytes
+*           changed by "fm25_counter_add()" is applied to device memory.
+*           Counter shall read previous value until whole span is written
+*           and new value afterwards. Start values cover carries across
+*           bytes and wrap of counter.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_counter(void)
+{
+    static const uint32_t start[] = { 0x00000000UL, 0x000000FEUL, 0x0000FFFEUL, 0x00FFFFFEUL, 0xFFFFFFFEUL, 0x7FFFFFFFUL, 0x12345678UL };
+    static const uint32_t delta[] = { 1UL, 1UL, 0x00000101UL, 0x00FF00FFUL, 0x7FFFFFFFUL, 2UL };
+    uint8_t         before[FM25_COUNTER_SIZE( FM25_COUNTER_WIDTH_MAX )];
+    uint8_t         after[FM25_COUNTER_SIZE( FM25_COUNTER_WIDTH_MAX )];
+    fm25_sim_t      sim     = { 0 };
+    fm25_dev_t      dev     = NULL;
+    fm25_status_t   status  = eFM25_OK;
+    uint8_t *       p_mem   = NULL;
+
+    status = fm25_test_open( &sim, &dev, &g_fm25_sim_if, NULL, false );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        p_mem = &fm25_sim_get_mem( &sim )[FM25_TEST_COUNTER_ADDR];
+
+        for ( uint8_t width = 1U; ( width <= FM25_COUNTER_WIDTH_MAX ) && ( eFM25_OK == status ); width++ )
+        {
+            const uint32_t mask     = ( FM25_COUNTER_WIDTH_MAX == width ) ? 0xFFFFFFFFUL : (( 1UL << ( 8U * width )) - 1UL );
+            const uint32_t size     = FM25_COUNTER_SIZE( width );
+            const uint32_t copy     = ( size / 2U );
+
+            for ( uint32_t i = 0U; i < ( sizeof( start ) / sizeof( start[0] )); i++ )
+            {
+                uint32_t value = ( start[i] & mask );
+
+                FM25_TEST_CHECK( eFM25_OK == fm25_counter_set( dev, FM25_TEST_COUNTER_ADDR, width, value ));
+
+                for ( uint32_t j = 0U; j < ( sizeof( delta ) / sizeof( delta[0] )); j++ )
+                {
+                    const uint32_t  add     = ( delta[j] & ( mask >> 1U ));
+                    const uint32_t  next    = (( value + add ) & mask );
+                    uint32_t        got     = 0U;
+                    uint32_t        first   = size;
+                    uint32_t        last    = 0U;
+
+                    memcpy( before, p_mem, size );
+
+                    FM25_TEST_CHECK(( eFM25_OK == fm25_counter_add( dev, FM25_TEST_COUNTER_ADDR, width, add, &got )) && ( next == got ));
+
+                    memcpy( after, p_mem, size );
+
+                    for ( uint32_t k = 0U; k < size; k++ )
+                    {
+                        if ( before[k] != after[k] )
+                        {
+                            first   = ( k < first ) ? k : first;
+                            last    = k;
+                        }
+                    }
+
+                    // Only older copy changes
+                    FM25_TEST_CHECK(( first <= last ) && (( first / copy ) == ( last / copy )));
+
+                    for ( uint32_t prefix = 0U; prefix <= (( last - first ) + 1U ); prefix++ )
+                    {
+                        memcpy( p_mem, before, size );
+                        memcpy( &p_mem[first], &after[first], prefix );
+
+                        got = ~value;
+
+                        FM25_TEST_CHECK( eFM25_OK == fm25_counter_get( dev, FM25_TEST_COUNTER_ADDR, width, &got ));
+                        FM25_TEST_CHECK((( prefix <= ( last - first )) ? value : next ) == got );
+                    }
+
+                    memcpy( p_mem, after, size );
+                    value = next;
+                }
+            }
+        }
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Compare bitmap on device and through API against model
+*
+* @param[in]    p_bitmap    - Pointer to bitmap
+* @param[in]    p_mem       - Pointer to bitmap in device memory
+* @param[in]    p_model     - Allocated units of model
+* @return       is_model    - True if all units match model
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_test_bitmap_is_model(fm25_bitmap_t * const p_bitmap, const uint8_t * const p_mem, const bool * const p_model)
+{
+    bool is_model = true;
+
+    for ( uint32_t bit = 0U; ( bit < FM25_TEST_BITMAP_BIT_NUM ) && ( true == is_model ); bit++ )
+    {
+        bool is_set = false;
+
+        is_model    = ( eFM25_OK == fm25_bitmap_is_set( p_bitmap, bit, &is_set ))
+                    && ( p_model[bit] == is_set )
+                    && ( p_model[bit] == ( 0U == ( p_mem[bit / 8U] & ( 1U << ( bit % 8U )))));
+    }
+
+    return is_model;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Bitmap allocation, search wrap around and padding bits
+*
+* @note     Random allocations and releases are checked against model
+*           without and with RAM mirror, bitmap is filled up and padding
+*           bits of last byte shall never be allocated. Search hint wraps
+*           around when unit below it is released through other handle.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_bitmap(void)
+{
+    static uint8_t  mirror[FM25_BITMAP_SIZE( FM25_TEST_BITMAP_BIT_NUM )];
+    static bool     model[FM25_TEST_BITMAP_BIT_NUM];
+    const uint32_t  last        = ( FM25_BITMAP_SIZE( FM25_TEST_BITMAP_BIT_NUM ) - 1U );
+    const uint8_t   pad         = (uint8_t)( 0xFFU << ( FM25_TEST_BITMAP_BIT_NUM % 8U ));
+    fm25_sim_t      sim         = { 0 };
+    fm25_bitmap_t   bitmap;
+    fm25_bitmap_t   other;
+    fm25_dev_t      dev         = NULL;
+    fm25_status_t   status      = eFM25_OK;
+    const uint8_t * p_mem       = NULL;
+    uint32_t        bit         = 0U;
+
+    status = fm25_test_open( &sim, &dev, &g_fm25_sim_if, NULL, false );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        p_mem = &fm25_sim_get_mem( &sim )[FM25_TEST_BITMAP_ADDR];
+
+        for ( uint32_t pass = 0U; ( pass < 2U ) && ( eFM25_OK == status ); pass++ )
+        {
+            const fm25_bitmap_cfg_t bitmap_cfg =
+            {
+                .dev        = dev,
+                .addr       = FM25_TEST_BITMAP_ADDR,
+                .bit_num    = FM25_TEST_BITMAP_BIT_NUM,
+                .p_mirror   = ( 0U == pass ) ? NULL : mirror,
+            };
+
+            uint32_t    alloc_num   = 0U;
+            uint32_t    seed        = 1U;
+
+            memset( model, 0, sizeof( model ));
+
+            status = fm25_erase( dev, FM25_TEST_BITMAP_ADDR, FM25_BITMAP_SIZE( FM25_TEST_BITMAP_BIT_NUM ));
+            status |= fm25_bitmap_init( &bitmap, &bitmap_cfg );
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+
+            // Random allocations and releases
+            for ( uint32_t op = 0U; op < FM25_TEST_BITMAP_OP_NUM; op++ )
+            {
+                seed = (( seed * 1103515245UL ) + 12345UL );
+
+                const uint32_t rnd = ( seed >> 16U );
+
+                if (( 0U == alloc_num ) || ( 0U != ( rnd % 3U )))
+                {
+                    const fm25_status_t alloc_status = fm25_bitmap_alloc( &bitmap, &bit );
+
+                    if ( FM25_TEST_BITMAP_BIT_NUM == alloc_num )
+                    {
+                        FM25_TEST_CHECK( eFM25_ERROR == alloc_status );
+                    }
+                    else
+                    {
+                        FM25_TEST_CHECK(( eFM25_OK == alloc_status ) && ( bit < FM25_TEST_BITMAP_BIT_NUM ) && ( false == model[bit] ));
+
+                        model[bit % FM25_TEST_BITMAP_BIT_NUM] = true;
+                        alloc_num++;
+                    }
+                }
+                else
+                {
+                    bit = ( rnd % FM25_TEST_BITMAP_BIT_NUM );
+
+                    while ( false == model[bit] )
+                    {
+                        bit = ((( bit + 1U ) < FM25_TEST_BITMAP_BIT_NUM ) ? ( bit + 1U ) : 0U );
+                    }
+
+                    FM25_TEST_CHECK( eFM25_OK == fm25_bitmap_free( &bitmap, bit ));
+                    FM25_TEST_CHECK( eFM25_ERROR == fm25_bitmap_free( &bitmap, bit ));
+
+                    model[bit] = false;
+                    alloc_num--;
+                }
+            }
+
+            FM25_TEST_CHECK( true == fm25_test_bitmap_is_model( &bitmap, p_mem, model ));
+            FM25_TEST_CHECK(( 0U == pass ) || ( 0 == memcmp( mirror, p_mem, sizeof( mirror ))));
+
+            // Fill up, padding bits are never allocated
+            while ( eFM25_OK == fm25_bitmap_alloc( &bitmap, &bit ))
+            {
+                FM25_TEST_CHECK(( bit < FM25_TEST_BITMAP_BIT_NUM ) && ( false == model[bit % FM25_TEST_BITMAP_BIT_NUM] ));
+
+                model[bit % FM25_TEST_BITMAP_BIT_NUM] = true;
+                alloc_num++;
+            }
+
+            FM25_TEST_CHECK( FM25_TEST_BITMAP_BIT_NUM == alloc_num );
+            FM25_TEST_CHECK( pad == p_mem[last] );
+            FM25_TEST_CHECK( eFM25_ERROR == fm25_bitmap_free( &bitmap, FM25_TEST_BITMAP_BIT_NUM ));
+
+            // Last unit before padding
+            FM25_TEST_CHECK( eFM25_OK == fm25_bitmap_free( &bitmap, ( FM25_TEST_BITMAP_BIT_NUM - 1U )));
+            FM25_TEST_CHECK(( eFM25_OK == fm25_bitmap_alloc( &bitmap, &bit )) && (( FM25_TEST_BITMAP_BIT_NUM - 1U ) == bit ));
+            FM25_TEST_CHECK( eFM25_ERROR == fm25_bitmap_alloc( &bitmap, &bit ));
+        }
+
+        // Search hint wraps around, bitmap is full
+        {
+            const fm25_bitmap_cfg_t bitmap_cfg =
+            {
+                .dev        = dev,
+                .addr       = FM25_TEST_BITMAP_ADDR,
+                .bit_num    = FM25_TEST_BITMAP_BIT_NUM,
+                .p_mirror   = NULL,
+            };
+
+            status = fm25_bitmap_init( &bitmap, &bitmap_cfg );
+            status |= fm25_bitmap_init( &other, &bitmap_cfg );
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+
+            // Move hint to last byte
+            FM25_TEST_CHECK( eFM25_OK == fm25_bitmap_free( &other, ( FM25_TEST_BITMAP_BIT_NUM - 1U )));
+            FM25_TEST_CHECK(( eFM25_OK == fm25_bitmap_alloc( &bitmap, &bit )) && (( FM25_TEST_BITMAP_BIT_NUM - 1U ) == bit ));
+
+            // Units below hint
+            FM25_TEST_CHECK( eFM25_OK == fm25_bitmap_free( &other, 9U ));
+            FM25_TEST_CHECK(( eFM25_OK == fm25_bitmap_alloc( &bitmap, &bit )) && ( 9U == bit ));
+            FM25_TEST_CHECK( eFM25_OK == fm25_bitmap_free( &other, 0U ));
+            FM25_TEST_CHECK(( eFM25_OK == fm25_bitmap_alloc( &bitmap, &bit )) && ( 0U == bit ));
+            FM25_TEST_CHECK( eFM25_ERROR == fm25_bitmap_alloc( &bitmap, &bit ));
+            FM25_TEST_CHECK( pad == p_mem[last] );
+        }
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Key of key-value test
+*
+* @param[in]    n       - Number of key
+* @param[out]   p_key   - Key, zero terminated
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_kv_key(const uint32_t n, char * const p_key)
+{
+    (void) snprintf( p_key, FM25_KV_KEY_SIZE, "key%02u", (unsigned) n );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Index entry of bucket in simulated memory
+*
+* @param[in]    p_sim   - Pointer to simulated device
+* @param[in]    idx     - Bucket number
+* @return       entry   - Index entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_test_kv_entry(const fm25_sim_t * const p_sim, const uint32_t idx)
+{
+    uint32_t entry = 0U;
+
+    memcpy( &entry, &fm25_sim_get_mem( p_sim )[FM25_TEST_KV_ADDR + sizeof( fm25_kv_hdr_t ) + ( idx * sizeof( uint32_t ))], sizeof( entry ));
+
+    return entry;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Format or mount key-value test store
+*
+* @param[out]   p_kv        - Pointer to store
+* @param[in]    dev         - Device handle
+* @param[in]    p_index     - RAM copy of index, NULL to disable
+* @param[in]    is_format   - Format instead of mount
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_kv_open(fm25_kv_t * const p_kv, fm25_dev_t dev, uint32_t * const p_index, const bool is_format)
+{
+    const fm25_kv_cfg_t cfg =
+    {
+        .dev        = dev,
+        .addr       = FM25_TEST_KV_ADDR,
+        .size       = FM25_TEST_KV_SIZE,
+        .value_max  = FM25_TEST_KV_VALUE_MAX,
+        .p_index    = p_index,
+        .index_size = ( FM25_TEST_KV_BUCKET_NUM * sizeof( uint32_t )),
+    };
+
+    return ( true == is_format ) ? fm25_kv_format( p_kv, &cfg ) : fm25_kv_mount( p_kv, &cfg );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check that value of key matches model
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    n       - Number of key
+* @param[in]    p_model - Model of key
+* @return       is_model - True if key is absent and unset in model or holds model value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_test_kv_is_key(fm25_kv_t * const p_kv, const uint32_t n, const fm25_test_kv_model_t * const p_model)
+{
+    char        key[FM25_KV_KEY_SIZE];
+    uint8_t     data[FM25_TEST_KV_VALUE_MAX];
+    uint32_t    size = 0xFFFFFFFFUL;
+
+    fm25_test_kv_key( n, key );
+
+    return  (   ( eFM25_OK == fm25_kv_get( p_kv, key, data, sizeof( data ), &size ))
+            &&  (   (( false == p_model->is_set ) && ( 0U == size ))
+                ||  (   ( true == p_model->is_set )
+                    &&  ( p_model->size == size )
+                    &&  ( 0 == memcmp( data, p_model->data, size )))));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check that all keys match model
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    p_model - Model of all keys
+* @return       is_model - True if store matches model
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_test_kv_is_model(fm25_kv_t * const p_kv, const fm25_test_kv_model_t * const p_model)
+{
+    bool is_model = true;
+
+    for ( uint32_t n = 0U; ( n < FM25_TEST_KV_KEY_NUM ) && ( true == is_model ); n++ )
+    {
+        is_model = fm25_test_kv_is_key( p_kv, n, &p_model[n] );
+    }
+
+    return is_model;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Set key and its model
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    n       - Number of key
+* @param[in]    size    - Size of value
+* @param[in]    seed    - Seed of value bytes
+* @param[out]   p_model - Model of key, updated on success
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_kv_set(fm25_kv_t * const p_kv, const uint32_t n, const uint32_t size, const uint32_t seed, fm25_test_kv_model_t * const p_model)
+{
+    fm25_status_t   status = eFM25_OK;
+    char            key[FM25_KV_KEY_SIZE];
+    uint8_t         data[FM25_TEST_KV_VALUE_MAX];
+
+    fm25_test_kv_key( n, key );
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        data[i] = (uint8_t)(( seed * 13U ) + ( i * 7U ) + 1U );
+    }
+
+    status = fm25_kv_set( p_kv, key, data, size );
+
+    if ( eFM25_OK == status )
+    {
+        memcpy( p_model->data, data, size );
+        p_model->size   = size;
+        p_model->is_set = true;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Key-value store operations, probe chains, index rebuild and
+*        power failure during delete
+*
+* @note     Hash of each key is read from index of single key store, thus
+*           keys sharing home bucket are known without copy of hash
+*           function. Random sets, overwrites and deletes of more keys
+*           than buckets are checked against model with and without RAM
+*           index, chain of three colliding keys is walked across
+*           tombstones, cleared index is rebuilt from slots and power
+*           fails at each byte of delete of chain middle key.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_kv(void)
+{
+    static uint8_t                  image[FM25_TEST_MEM_SIZE];
+    static fm25_test_kv_model_t     model[FM25_TEST_KV_KEY_NUM];
+    static uint32_t                 index[FM25_TEST_KV_BUCKET_NUM];
+    uint32_t                        hash[FM25_TEST_KV_KEY_NUM]  = { 0 };
+    uint32_t                        chain[3]                    = { 0 };
+    uint32_t                        chain_num                   = 0U;
+    uint32_t                        home                        = 0U;
+    fm25_sim_t                      sim                         = { 0 };
+    fm25_kv_t                       kv;
+    fm25_dev_t                      dev                         = NULL;
+    fm25_status_t                   status                      = eFM25_OK;
+    char                            key[FM25_KV_KEY_SIZE];
+
+    status = fm25_test_power_open( &sim, &dev );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        // Hash of each key from index entry of single key store
+        for ( uint32_t n = 0U; ( n < FM25_TEST_KV_KEY_NUM ) && ( eFM25_OK == status ); n++ )
+        {
+            status = fm25_test_kv_open( &kv, dev, NULL, true );
+            status |= fm25_test_kv_set( &kv, n, 0U, 0U, &model[n] );
+
+            for ( uint32_t idx = 0U; idx < FM25_TEST_KV_BUCKET_NUM; idx++ )
+            {
+                hash[n] |= fm25_test_kv_entry( &sim, idx );
+            }
+
+            FM25_TEST_CHECK(( eFM25_OK == status ) && ( 0U != hash[n] ));
+        }
+
+        // Three keys with same home bucket, keys outnumber two per bucket
+        for ( uint32_t idx = 0U; ( idx < FM25_TEST_KV_BUCKET_NUM ) && ( chain_num < 3U ); idx++ )
+        {
+            chain_num   = 0U;
+            home        = idx;
+
+            for ( uint32_t n = 0U; ( n < FM25_TEST_KV_KEY_NUM ) && ( chain_num < 3U ); n++ )
+            {
+                if ( home == ( hash[n] % FM25_TEST_KV_BUCKET_NUM ))
+                {
+                    chain[chain_num] = n;
+                    chain_num++;
+                }
+            }
+        }
+
+        FM25_TEST_CHECK( 3U == chain_num );
+
+        for ( uint32_t pass = 0U; ( pass < 2U ) && ( 3U == chain_num ) && ( eFM25_OK == status ); pass++ )
+        {
+            uint32_t * const    p_index     = ( 0U == pass ) ? NULL : index;
+            uint32_t            seed        = 1U;
+            uint32_t            live        = 0U;
+            uint32_t            gap_num     = 0U;
+            bool                is_cut      = true;
+
+            memset( model, 0, sizeof( model ));
+
+            status = fm25_test_kv_open( &kv, dev, p_index, true );
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+
+            // Random sets, overwrites, deletes and remounts
+            for ( uint32_t op = 0U; ( op < FM25_TEST_KV_OP_NUM ) && ( eFM25_OK == status ); op++ )
+            {
+                seed = (( seed * 1103515245UL ) + 12345UL );
+
+                const uint32_t rnd  = ( seed >> 16U );
+                const uint32_t n    = ( rnd % FM25_TEST_KV_KEY_NUM );
+
+                live = 0U;
+
+                for ( uint32_t i = 0U; i < FM25_TEST_KV_KEY_NUM; i++ )
+                {
+                    live += ( true == model[i].is_set ) ? 1U : 0U;
+                }
+
+                if ( 0U != (( rnd / FM25_TEST_KV_KEY_NUM ) % 3U ))
+                {
+                    const bool          is_full     = (( false == model[n].is_set ) && ( FM25_TEST_KV_BUCKET_NUM == live ));
+                    const fm25_status_t set_status  = fm25_test_kv_set( &kv, n, (( rnd >> 8U ) % ( FM25_TEST_KV_VALUE_MAX + 1U )), op, &model[n] );
+
+                    FM25_TEST_CHECK((( true == is_full ) ? eFM25_ERROR : eFM25_OK ) == set_status );
+                }
+                else
+                {
+                    fm25_test_kv_key( n, key );
+
+                    FM25_TEST_CHECK( eFM25_OK == fm25_kv_delete( &kv, key ));
+
+                    model[n].is_set = false;
+                }
+
+                if ( 0U == ( op % FM25_TEST_KV_REMOUNT_NUM ))
+                {
+                    status = fm25_test_kv_open( &kv, dev, p_index, false );
+
+                    FM25_TEST_CHECK(( eFM25_OK == status ) && ( false == kv.is_rebuilt ));
+                    FM25_TEST_CHECK( true == fm25_test_kv_is_model( &kv, model ));
+                }
+            }
+
+            FM25_TEST_CHECK( true == fm25_test_kv_is_model( &kv, model ));
+
+            // Lost index with matching slots is rebuilt at mount
+            memset( &fm25_sim_get_mem( &sim )[FM25_TEST_KV_ADDR + sizeof( fm25_kv_hdr_t )], 0, ( FM25_TEST_KV_BUCKET_NUM * sizeof( uint32_t )));
+
+            status = fm25_test_kv_open( &kv, dev, p_index, false );
+
+            FM25_TEST_CHECK(( eFM25_OK == status ) && ( true == kv.is_rebuilt ));
+            FM25_TEST_CHECK( true == fm25_test_kv_is_model( &kv, model ));
+
+            status |= fm25_test_kv_open( &kv, dev, p_index, false );
+
+            FM25_TEST_CHECK(( eFM25_OK == status ) && ( false == kv.is_rebuilt ));
+
+            // Probe chain across tombstones
+            memset( model, 0, sizeof( model ));
+
+            status |= fm25_test_kv_open( &kv, dev, p_index, true );
+
+            for ( uint32_t i = 0U; i < 3U; i++ )
+            {
+                status |= fm25_test_kv_set( &kv, chain[i], ( 4U + i ), i, &model[chain[i]] );
+
+                FM25_TEST_CHECK( hash[chain[i]] == fm25_test_kv_entry( &sim, (( home + i ) % FM25_TEST_KV_BUCKET_NUM )));
+            }
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+
+            fm25_test_kv_key( chain[1], key );
+            FM25_TEST_CHECK( eFM25_OK == fm25_kv_delete( &kv, key ));
+            model[chain[1]].is_set = false;
+
+            FM25_TEST_CHECK( FM25_TEST_KV_TOMB == fm25_test_kv_entry( &sim, (( home + 1U ) % FM25_TEST_KV_BUCKET_NUM )));
+            FM25_TEST_CHECK( true == fm25_test_kv_is_model( &kv, model ));
+
+            // Tombstone is reused by next insert on probe path
+            FM25_TEST_CHECK( eFM25_OK == fm25_test_kv_set( &kv, chain[1], 8U, 9U, &model[chain[1]] ));
+            FM25_TEST_CHECK( hash[chain[1]] == fm25_test_kv_entry( &sim, (( home + 1U ) % FM25_TEST_KV_BUCKET_NUM )));
+
+            // Last key stays reachable behind two tombstones
+            for ( uint32_t i = 0U; i < 2U; i++ )
+            {
+                fm25_test_kv_key( chain[i], key );
+                FM25_TEST_CHECK( eFM25_OK == fm25_kv_delete( &kv, key ));
+                model[chain[i]].is_set = false;
+            }
+
+            FM25_TEST_CHECK( true == fm25_test_kv_is_model( &kv, model ));
+
+            // Rebuild of cleared index closes gap in front of last key
+            memset( &fm25_sim_get_mem( &sim )[FM25_TEST_KV_ADDR + sizeof( fm25_kv_hdr_t )], 0, ( FM25_TEST_KV_BUCKET_NUM * sizeof( uint32_t )));
+
+            status = fm25_test_kv_open( &kv, dev, p_index, false );
+
+            FM25_TEST_CHECK(( eFM25_OK == status ) && ( true == kv.is_rebuilt ));
+            FM25_TEST_CHECK( true == fm25_test_kv_is_model( &kv, model ));
+            FM25_TEST_CHECK( hash[chain[2]] == fm25_test_kv_entry( &sim, (( home + 2U ) % FM25_TEST_KV_BUCKET_NUM )));
+
+            // Power fails at each byte of delete of chain middle key
+            memset( model, 0, sizeof( model ));
+
+            status |= fm25_test_kv_open( &kv, dev, p_index, true );
+
+            for ( uint32_t i = 0U; i < 3U; i++ )
+            {
+                status |= fm25_test_kv_set( &kv, chain[i], ( 4U + i ), i, &model[chain[i]] );
+            }
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+
+            memcpy( image, fm25_sim_get_mem( &sim ), sizeof( image ));
+            fm25_test_kv_key( chain[1], key );
+
+            for ( uint32_t byte_num = 0U; ( true == is_cut ) && ( eFM25_OK == status ); byte_num++ )
+            {
+                fm25_test_kv_model_t    after       = model[chain[1]];
+                fm25_status_t           del_status  = eFM25_OK;
+
+                status = fm25_test_reboot( &sim, &dev, image );
+                status |= fm25_test_kv_open( &kv, dev, p_index, false );
+
+                fm25_test_power_cut( byte_num );
+
+                del_status  = fm25_kv_delete( &kv, key );
+                is_cut      = g_power_is_off;
+
+                status |= fm25_test_reboot( &sim, &dev, NULL );
+                status |= fm25_test_kv_open( &kv, dev, p_index, false );
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK(( true == is_cut ) || ( eFM25_OK == del_status ));
+
+                // Deleted key is either intact or absent
+                after.is_set = false;
+
+                FM25_TEST_CHECK(    ( true == fm25_test_kv_is_key( &kv, chain[1], &model[chain[1]] ))
+                                ||  ( true == fm25_test_kv_is_key( &kv, chain[1], &after )));
+                FM25_TEST_CHECK(( true == is_cut ) || ( true == fm25_test_kv_is_key( &kv, chain[1], &after )));
+                FM25_TEST_CHECK( true == fm25_test_kv_is_key( &kv, chain[2], &model[chain[2]] ));
+
+                // Slot invalidated, tombstone not yet written
+                if  (   ( true == fm25_test_kv_is_key( &kv, chain[1], &after ))
+                    &&  ( FM25_TEST_KV_TOMB != fm25_test_kv_entry( &sim, (( home + 1U ) % FM25_TEST_KV_BUCKET_NUM ))))
+                {
+                    gap_num++;
+                }
+
+                // Absent key does not reappear by rebuild
+                if ( true == fm25_test_kv_is_key( &kv, chain[1], &after ))
+                {
+                    status |= fm25_kv_rebuild( &kv );
+
+                    FM25_TEST_CHECK( true == fm25_test_kv_is_key( &kv, chain[1], &after ));
+                    FM25_TEST_CHECK( true == fm25_test_kv_is_key( &kv, chain[2], &model[chain[2]] ));
+                }
+            }
+
+            FM25_TEST_CHECK( 0U < gap_num );
+        }
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Completion of queue test request
+*
+* @param[in]    p_req   - Pointer to queued request
+* @param[in]    status  - Status of transaction
+* @param[in]    p_arg   - Pointer to test request
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_queue_cb(fm25_queue_req_t * const p_req, const fm25_status_t status, void * const p_arg)
+{
+    fm25_test_queue_req_t * const p_test = (fm25_test_queue_req_t*) p_arg;
+
+    (void) p_req;
+
+    p_test->status  = status;
+    p_test->order   = g_queue_done;
+    p_test->is_done = true;
+
+    g_queue_done++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Timestamp of queue latency budgets
+*
+* @return       tick    - Timestamp set by test
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_test_queue_tick(void)
+{
+    return g_queue_tick;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Initialize test queue and its requests
+*
+* @param[out]   p_queue     - Pointer to queue
+* @param[in]    dev         - Device handle
+* @param[in]    is_merge    - Enable merge buffer
+* @param[in]    is_budget   - Enable latency budgets of priorities 2 and 3
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_queue_init(fm25_queue_t * const p_queue, fm25_dev_t dev, const bool is_merge, const bool is_budget)
+{
+    static uint8_t buf[FM25_TEST_QUEUE_BUF_SIZE];
+
+    const fm25_queue_cfg_t cfg =
+    {
+        .dev            = dev,
+        .p_buf          = ( true == is_merge ) ? buf : NULL,
+        .buf_size       = ( true == is_merge ) ? sizeof( buf ) : 0U,
+        .budget         = { 0U, 0U, ( true == is_budget ) ? 20U : 0U, ( true == is_budget ) ? 10U : 0U },
+        .pf_get_tick    = ( true == is_budget ) ? fm25_test_queue_tick : NULL,
+    };
+
+    memset( g_queue_req, 0, sizeof( g_queue_req ));
+    g_queue_done = 0U;
+    g_queue_tick = 0U;
+
+    return fm25_queue_init( p_queue, &cfg );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Submit test request and apply it to model
+*
+* @note     Read expects model content at its submission, write data
+*           differs with each submission.
+*
+* @param[in]    p_queue     - Pointer to queue
+* @param[in]    idx         - Index of test request
+* @param[in]    is_write    - Write request
+* @param[in]    prio        - Priority
+* @param[in]    addr        - Start address
+* @param[in]    size        - Size in bytes
+* @param[in,out]    p_model - Model of device memory
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_test_queue_submit(fm25_queue_t * const p_queue, const uint32_t idx, const bool is_write, const uint8_t prio, const uint32_t addr, const uint32_t size, uint8_t * const p_model)
+{
+    static uint32_t                 submit_num  = 0U;
+    fm25_test_queue_req_t * const   p_test      = &g_queue_req[idx];
+    fm25_status_t                   status      = eFM25_OK;
+
+    submit_num++;
+
+    memset( p_test, 0, sizeof( fm25_test_queue_req_t ));
+    p_test->is_write    = is_write;
+    p_test->size        = size;
+
+    if ( true == is_write )
+    {
+        for ( uint32_t i = 0U; i < size; i++ )
+        {
+            p_test->data[i] = (uint8_t)(( submit_num * 29U ) + ( i * 3U ) + 1U );
+        }
+
+        memcpy( &p_model[addr], p_test->data, size );
+
+        status = fm25_queue_write( p_queue, &p_test->req, prio, addr, size, p_test->data, fm25_test_queue_cb, p_test );
+    }
+    else
+    {
+        memcpy( p_test->expect, &p_model[addr], size );
+
+        status = fm25_queue_read( p_queue, &p_test->req, prio, addr, size, p_test->data, fm25_test_queue_cb, p_test );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check completion of test requests
+*
+* @param[in]    num     - Number of submitted test requests
+* @return       is_ok   - True if all completed once with success and reads returned expected data
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_test_queue_is_done(const uint32_t num)
+{
+    bool is_ok = ( num == g_queue_done );
+
+    for ( uint32_t i = 0U; ( i < num ) && ( true == is_ok ); i++ )
+    {
+        const fm25_test_queue_req_t * const p_test = &g_queue_req[i];
+
+        is_ok   =   ( true == p_test->is_done )
+                &&  ( eFM25_OK == p_test->status )
+                &&  (   ( true == p_test->is_write )
+                    ||  ( 0 == memcmp( p_test->data, p_test->expect, p_test->size )));
+    }
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Request queue merging, priorities, ordering of conflicting
+*        requests, latency budgets and wake-up
+*
+* @note     Every request is applied to model in RAM at submission, thus
+*           reads expect data of all older writes touching same memory
+*           and none of younger ones. Device memory shall match model
+*           after each processing.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_queue(void)
+{
+    static uint8_t      model[FM25_TEST_MEM_SIZE];
+    fm25_sim_t          sim         = { 0 };
+    fm25_queue_t        queue;
+    fm25_queue_stats_t  stats       = { 0 };
+    fm25_dev_t          dev         = NULL;
+    fm25_status_t       status      = eFM25_OK;
+    uint32_t            seed        = 1U;
+
+    memset( model, 0, sizeof( model ));
+
+    status = fm25_test_open( &sim, &dev, &g_fm25_sim_if, NULL, true );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        // Contiguous writes and reads merged in buffer, distant one not
+        status = fm25_test_queue_init( &queue, dev, true, false );
+
+        for ( uint32_t i = 0U; i < 3U; i++ )
+        {
+            status |= fm25_test_queue_submit( &queue, i, true, 1U, ( i * 8U ), 8U, model );
+        }
+
+        status |= fm25_test_queue_submit( &queue, 3U, true, 1U, 0x080U, 8U, model );
+        status |= fm25_queue_process( &queue );
+        status |= fm25_queue_get_stats( &queue, &stats );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_queue_is_done( 4U ));
+        FM25_TEST_CHECK(( 2U == stats.trans ) && ( 2U == stats.merged ) && ( 0U == stats.depth ));
+
+        status = fm25_test_queue_init( &queue, dev, true, false );
+
+        for ( uint32_t i = 0U; i < 4U; i++ )
+        {
+            status |= fm25_test_queue_submit( &queue, i, false, 1U, (( 3U == i ) ? 0x080U : ( 20U - ( i * 8U ))), 8U, model );
+        }
+
+        status |= fm25_queue_process( &queue );
+        status |= fm25_queue_get_stats( &queue, &stats );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_queue_is_done( 4U ));
+        FM25_TEST_CHECK(( 2U == stats.trans ) && ( 2U == stats.merged ));
+
+        // Merged range limited by buffer size
+        status = fm25_test_queue_init( &queue, dev, true, false );
+
+        for ( uint32_t i = 0U; i < 3U; i++ )
+        {
+            status |= fm25_test_queue_submit( &queue, i, true, 1U, ( i * ( FM25_TEST_QUEUE_BUF_SIZE / 2U )), ( FM25_TEST_QUEUE_BUF_SIZE / 2U ), model );
+        }
+
+        status |= fm25_queue_process( &queue );
+        status |= fm25_queue_get_stats( &queue, &stats );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_queue_is_done( 3U ));
+        FM25_TEST_CHECK(( 2U == stats.trans ) && ( 1U == stats.merged ));
+
+        // Overlapping writes merged in submission order, lower priority first
+        status = fm25_test_queue_init( &queue, dev, true, false );
+        status |= fm25_test_queue_submit( &queue, 0U, true, 2U, 0x100U, 16U, model );
+        status |= fm25_test_queue_submit( &queue, 1U, true, 0U, 0x108U, 16U, model );
+        status |= fm25_queue_process( &queue );
+        status |= fm25_queue_get_stats( &queue, &stats );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_queue_is_done( 2U ));
+        FM25_TEST_CHECK(( 1U == stats.trans ) && ( 1U == stats.merged ));
+        FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, FM25_TEST_MEM_SIZE ));
+
+        // Priority order, FIFO within priority
+        status = fm25_test_queue_init( &queue, dev, false, false );
+
+        for ( uint32_t i = 0U; i < 5U; i++ )
+        {
+            status |= fm25_test_queue_submit( &queue, i, false, (uint8_t)(( i < 4U ) ? ( 3U - i ) : 0U ), ( 0x040U * i ), 4U, model );
+        }
+
+        status |= fm25_queue_process( &queue );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_queue_is_done( 5U ));
+        FM25_TEST_CHECK(    ( 0U == g_queue_req[3].order ) && ( 1U == g_queue_req[4].order ) && ( 2U == g_queue_req[2].order )
+                        &&  ( 3U == g_queue_req[1].order ) && ( 4U == g_queue_req[0].order ));
+
+        // Read after write, write after write and write after read are not reordered
+        status = fm25_test_queue_init( &queue, dev, false, false );
+        status |= fm25_test_queue_submit( &queue, 0U, true, 3U, 0x100U, 16U, model );
+        status |= fm25_test_queue_submit( &queue, 1U, false, 0U, 0x108U, 8U, model );
+        status |= fm25_test_queue_submit( &queue, 2U, true, 0U, 0x10CU, 8U, model );
+        status |= fm25_test_queue_submit( &queue, 3U, false, 3U, 0x180U, 8U, model );
+        status |= fm25_test_queue_submit( &queue, 4U, true, 0U, 0x184U, 8U, model );
+        status |= fm25_queue_process( &queue );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_queue_is_done( 5U ));
+        FM25_TEST_CHECK(( g_queue_req[0].order < g_queue_req[1].order ) && ( g_queue_req[1].order < g_queue_req[2].order ));
+        FM25_TEST_CHECK( g_queue_req[3].order < g_queue_req[4].order );
+        FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, FM25_TEST_MEM_SIZE ));
+
+        // Request over latency budget served first, largest overrun first
+        status = fm25_test_queue_init( &queue, dev, false, true );
+        status |= fm25_test_queue_submit( &queue, 0U, false, 3U, 0x000U, 4U, model );
+        g_queue_tick = 5U;
+        status |= fm25_test_queue_submit( &queue, 1U, false, 2U, 0x040U, 4U, model );
+        g_queue_tick = 40U;
+        status |= fm25_test_queue_submit( &queue, 2U, false, 0U, 0x080U, 4U, model );
+        status |= fm25_queue_process( &queue );
+        status |= fm25_queue_get_stats( &queue, &stats );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_queue_is_done( 3U ));
+        FM25_TEST_CHECK(( 0U == g_queue_req[0].order ) && ( 1U == g_queue_req[1].order ) && ( 2U == g_queue_req[2].order ));
+        FM25_TEST_CHECK( 2U == stats.late );
+
+        // Within budget priority decides
+        status = fm25_test_queue_init( &queue, dev, false, true );
+        status |= fm25_test_queue_submit( &queue, 0U, false, 3U, 0x000U, 4U, model );
+        g_queue_tick = 5U;
+        status |= fm25_test_queue_submit( &queue, 1U, false, 0U, 0x040U, 4U, model );
+        status |= fm25_queue_process( &queue );
+        status |= fm25_queue_get_stats( &queue, &stats );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+        FM25_TEST_CHECK( true == fm25_test_queue_is_done( 2U ));
+        FM25_TEST_CHECK(( 1U == g_queue_req[0].order ) && ( 0U == g_queue_req[1].order ) && ( 0U == stats.late ));
+
+        // Random requests in small window against model
+        for ( uint32_t round = 0U; ( round < FM25_TEST_QUEUE_ROUND_NUM ) && ( eFM25_OK == status ); round++ )
+        {
+            status = fm25_test_queue_init( &queue, dev, ( 0U != ( round % 2U )), false );
+
+            for ( uint32_t i = 0U; i < FM25_TEST_QUEUE_REQ_NUM; i++ )
+            {
+                seed = (( seed * 1103515245UL ) + 12345UL );
+
+                const uint32_t rnd  = ( seed >> 8U );
+                const uint32_t size = ( 1U + ( rnd % FM25_TEST_QUEUE_SIZE_MAX ));
+                const uint32_t addr = (( rnd >> 5U ) % ( FM25_TEST_QUEUE_WINDOW - size ));
+
+                status |= fm25_test_queue_submit( &queue, i, ( 0U != (( rnd >> 13U ) % 2U )), (uint8_t)(( rnd >> 14U ) % FM25_QUEUE_PRIO_NUM ), addr, size, model );
+            }
+
+            status |= fm25_queue_process( &queue );
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+            FM25_TEST_CHECK( true == fm25_test_queue_is_done( FM25_TEST_QUEUE_REQ_NUM ));
+            FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, FM25_TEST_MEM_SIZE ));
+        }
+
+        #if ( 1 == FM25_CFG_SLEEP_EN )
+
+            // Processing wakes sleeping device before first transaction
+            if ( FM25_TEST_ADDR_BIT_NUM >= FM25_TEST_SLEEP_ADDR_BIT_MIN )
+            {
+                fm25_sleep_stats_t  before      = { 0 };
+                fm25_sleep_stats_t  sleep_stats = { 0 };
+                fm25_sim_stats_t    sim_stats   = { 0 };
+
+                status = fm25_get_sleep_stats( dev, &before );
+
+                for ( uint32_t i = 0U; ( i <= FM25_TEST_SLEEP_IDLE ) && ( eFM25_OK == status ); i++ )
+                {
+                    status = fm25_sleep_process( dev );
+                }
+
+                FM25_TEST_CHECK(( eFM25_OK == status ) && ( true == sim.sleep ));
+
+                status = fm25_test_queue_init( &queue, dev, true, false );
+                status |= fm25_test_queue_submit( &queue, 0U, true, 1U, 0x020U, 8U, model );
+                status |= fm25_test_queue_submit( &queue, 1U, false, 0U, 0x0A0U, 8U, model );
+
+                FM25_TEST_CHECK( true == sim.sleep );
+
+                status |= fm25_queue_process( &queue );
+                status |= fm25_get_sleep_stats( dev, &sleep_stats );
+                fm25_sim_get_stats( &sim, &sim_stats );
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK( true == fm25_test_queue_is_done( 2U ));
+                FM25_TEST_CHECK(( false == sim.sleep ) && ( 0U == sim_stats.violations ));
+                FM25_TEST_CHECK((( before.sleep + 1U ) == sleep_stats.sleep ) && (( before.wake + 1U ) == sleep_stats.wake ));
+                FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, FM25_TEST_MEM_SIZE ));
+            }
+
+        #endif
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Overlapping copies against memmove model
+*
+* @note     Ranges overlap in both directions by less and by more than
+*           one copy chunk, reach last byte of memory and are not chunk
+*           multiples. Copy shall be accounted as one read and one write
+*           operation, failed copy in error counters of both.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_copy(void)
+{
+    static const struct
+    {
+        uint32_t    dst;
+        uint32_t    src;
+        uint32_t    size;
+    } op[] =
+    {
+        { ( FM25_TEST_COPY_ADDR + 1U ),     FM25_TEST_COPY_ADDR,            FM25_TEST_COPY_SIZE },  // Destination above source
+        { FM25_TEST_COPY_ADDR,              ( FM25_TEST_COPY_ADDR + 1U ),   FM25_TEST_COPY_SIZE },  // Destination below source
+        { ( FM25_TEST_COPY_ADDR + 130U ),   FM25_TEST_COPY_ADDR,            FM25_TEST_COPY_SIZE },
+        { FM25_TEST_COPY_ADDR,              ( FM25_TEST_COPY_ADDR + 130U ), FM25_TEST_COPY_SIZE },
+        { ( FM25_TEST_COPY_ADDR + 7U ),     FM25_TEST_COPY_ADDR,            1U                  },
+        { FM25_TEST_COPY_ADDR,              FM25_TEST_COPY_ADDR,            FM25_TEST_COPY_SIZE },  // Nothing to move
+        { ( FM25_TEST_MEM_SIZE - 200U ),    ( FM25_TEST_MEM_SIZE - 203U ),  200U                },  // Up to last byte
+        { ( FM25_TEST_MEM_SIZE - 203U ),    ( FM25_TEST_MEM_SIZE - 200U ),  200U                },
+    };
+
+    static uint8_t  model[FM25_TEST_MEM_SIZE];
+    static uint8_t  shadow[FM25_TEST_MEM_SIZE];
+    uint8_t         data[FM25_TEST_COPY_SIZE];
+
+    for ( uint32_t mode = 0U; mode < FM25_TEST_COPY_MODE_NUM; mode++ )
+    {
+        fm25_sim_t      sim     = { 0 };
+        fm25_dev_t      dev     = NULL;
+        fm25_status_t   status  = eFM25_OK;
+        uint32_t        seed    = ( mode + 1U );
+        fm25_dev_cfg_t  cfg     =
+        {
+            .p_if           = &g_fm25_sim_if,
+            .pf_get_tick    = fm25_test_tick,
+        };
+
+        if ( 1U == mode )
+        {
+            cfg.p_shadow    = shadow;
+            cfg.shadow_size = sizeof( shadow );
+        }
+
+        for ( uint32_t i = 0U; i < FM25_TEST_MEM_SIZE; i++ )
+        {
+            seed        = (( seed * 1103515245UL ) + 12345UL );
+            model[i]    = (uint8_t)( seed >> 16U );
+        }
+
+        status = fm25_test_open_cfg( &sim, &dev, &cfg, model );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+
+        if ( eFM25_OK == status )
+        {
+            #if ( 1 == FM25_CFG_STATS_EN )
+                fm25_stats_t before = { 0 };
+                fm25_stats_t after  = { 0 };
+            #endif
+
+            for ( uint32_t i = 0U; i < ( sizeof( op ) / sizeof( op[0] )); i++ )
+            {
+                #if ( 1 == FM25_CFG_STATS_EN )
+                    FM25_TEST_CHECK( eFM25_OK == fm25_get_stats( dev, &before ));
+                #endif
+
+                FM25_TEST_CHECK( eFM25_OK == fm25_copy( dev, op[i].dst, op[i].src, op[i].size ));
+
+                memmove( &model[op[i].dst], &model[op[i].src], op[i].size );
+
+                FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, FM25_TEST_MEM_SIZE ));
+
+                #if ( 1 == FM25_CFG_STATS_EN )
+                    const uint32_t rd_bytes = ( op[i].dst == op[i].src ) ? 0U : op[i].size;
+
+                    FM25_TEST_CHECK( eFM25_OK == fm25_get_stats( dev, &after ));
+                    FM25_TEST_CHECK((( before.read + 1U ) == after.read ) && (( before.write + 1U ) == after.write ));
+                    FM25_TEST_CHECK((( before.rd_bytes + rd_bytes ) == after.rd_bytes ) && (( before.wr_bytes + op[i].size ) == after.wr_bytes ));
+                    FM25_TEST_CHECK(( fm25_test_lat_num( &before, eFM25_STATS_READ ) + 1U ) == fm25_test_lat_num( &after, eFM25_STATS_READ ));
+                    FM25_TEST_CHECK(( fm25_test_lat_num( &before, eFM25_STATS_WRITE ) + 1U ) == fm25_test_lat_num( &after, eFM25_STATS_WRITE ));
+                    FM25_TEST_CHECK( before.err == after.err );
+                #endif
+            }
+
+            // Read agrees with device, from shadow if there is one
+            FM25_TEST_CHECK( eFM25_OK == fm25_read( dev, FM25_TEST_COPY_ADDR, FM25_TEST_COPY_SIZE, data ));
+            FM25_TEST_CHECK( 0 == memcmp( data, &model[FM25_TEST_COPY_ADDR], FM25_TEST_COPY_SIZE ));
+
+            #if ( 1 == FM25_CFG_STATS_EN )
+                FM25_TEST_CHECK( eFM25_OK == fm25_get_stats( dev, &before ));
+            #endif
+
+            // Source or destination past end of memory, nothing is moved
+            FM25_TEST_CHECK( eFM25_ERROR == fm25_copy( dev, FM25_TEST_COPY_ADDR, ( FM25_TEST_MEM_SIZE - 10U ), 20U ));
+            FM25_TEST_CHECK( eFM25_ERROR == fm25_copy( dev, ( FM25_TEST_MEM_SIZE - 10U ), FM25_TEST_COPY_ADDR, 20U ));
+            FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, FM25_TEST_MEM_SIZE ));
+
+            #if ( 1 == FM25_CFG_STATS_EN )
+                FM25_TEST_CHECK( eFM25_OK == fm25_get_stats( dev, &after ));
+                FM25_TEST_CHECK((( before.read + 2U ) == after.read ) && (( before.write + 2U ) == after.write ));
+                FM25_TEST_CHECK(( before.rd_bytes == after.rd_bytes ) && ( before.wr_bytes == after.wr_bytes ));
+                FM25_TEST_CHECK((( before.err + 4U ) == after.err ) && (( before.err_bit[0] + 4U ) == after.err_bit[0] ));
+                FM25_TEST_CHECK(( fm25_test_lat_num( &before, eFM25_STATS_READ ) + 2U ) == fm25_test_lat_num( &after, eFM25_STATS_READ ));
+            #endif
+
+            (void) fm25_close( dev );
+        }
+
+        (void) fm25_sim_close( &sim );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Vectored transfers against scalar transfers
+*
+* @note     Read segments separated by gap up to command frame share one
+*           read command, longer read gap and any write gap start new
+*           command. Gap bytes reach neither read buffer nor device. List
+*           with zero length segment is rejected without bus traffic.
+*           Random lists, unordered, overlapping and up to last byte of
+*           memory, agree with scalar calls segment by segment.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_iov(void)
+{
+    static uint8_t  model[FM25_TEST_MEM_SIZE];
+    static uint8_t  image[FM25_TEST_MEM_SIZE];
+    fm25_sim_t      sim     = { 0 };
+    fm25_dev_t      dev     = NULL;
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        seed    = 11U;
+    fm25_dev_cfg_t  cfg     =
+    {
+        .p_if   = &g_fm25_sim_if,
+    };
+
+    for ( uint32_t i = 0U; i < FM25_TEST_MEM_SIZE; i++ )
+    {
+        seed        = (( seed * 1103515245UL ) + 12345UL );
+        model[i]    = (uint8_t)( seed >> 16U );
+    }
+
+    status = fm25_test_open_cfg( &sim, &dev, &cfg, model );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        uint8_t * const     p_mem       = fm25_sim_get_mem( &sim );
+        uint8_t             data[( 2U * FM25_TEST_IOV_SIZE ) + 1U];
+        fm25_sim_stats_t    sim_stats   = { 0 };
+
+        // Gaps up to and beyond command frame
+        for ( uint32_t gap = 0U; gap <= ( FM25_TEST_IOV_CMD_SIZE + 1U ); gap++ )
+        {
+            const fm25_iov_t iov[2] =
+            {
+                { .addr = FM25_TEST_IOV_ADDR,                                   .size = FM25_TEST_IOV_SIZE, .p_data = &data[0]                  },
+                { .addr = ( FM25_TEST_IOV_ADDR + FM25_TEST_IOV_SIZE + gap ),    .size = FM25_TEST_IOV_SIZE, .p_data = &data[FM25_TEST_IOV_SIZE] },
+            };
+
+            memset( data, 0xEE, sizeof( data ));
+            fm25_sim_reset_stats( &sim );
+
+            FM25_TEST_CHECK( eFM25_OK == fm25_readv( dev, iov, 2U ));
+
+            fm25_sim_get_stats( &sim, &sim_stats );
+
+            FM25_TEST_CHECK((( gap <= FM25_TEST_IOV_CMD_SIZE ) ? 1U : 2U ) == sim_stats.read );
+            FM25_TEST_CHECK( 0 == memcmp( iov[0].p_data, &model[iov[0].addr], FM25_TEST_IOV_SIZE ));
+            FM25_TEST_CHECK( 0 == memcmp( iov[1].p_data, &model[iov[1].addr], FM25_TEST_IOV_SIZE ));
+            FM25_TEST_CHECK( 0xEEU == data[2U * FM25_TEST_IOV_SIZE] );
+
+            for ( uint32_t i = 0U; i < ( 2U * FM25_TEST_IOV_SIZE ); i++ )
+            {
+                data[i] = (uint8_t)(( gap << 5U ) + i );
+            }
+
+            fm25_sim_reset_stats( &sim );
+
+            FM25_TEST_CHECK( eFM25_OK == fm25_writev( dev, iov, 2U ));
+
+            fm25_sim_get_stats( &sim, &sim_stats );
+
+            memcpy( &model[iov[0].addr], iov[0].p_data, FM25_TEST_IOV_SIZE );
+            memcpy( &model[iov[1].addr], iov[1].p_data, FM25_TEST_IOV_SIZE );
+
+            FM25_TEST_CHECK((( 0U == gap ) ? 1U : 2U ) == sim_stats.write );
+            FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+        }
+
+        // Zero length segment rejects whole list before any transfer
+        const fm25_iov_t zero[3] =
+        {
+            { .addr = FM25_TEST_IOV_ADDR,                           .size = FM25_TEST_IOV_SIZE, .p_data = &data[0]                  },
+            { .addr = ( FM25_TEST_IOV_ADDR + FM25_TEST_IOV_SIZE ),  .size = 0U,                 .p_data = &data[FM25_TEST_IOV_SIZE] },
+            { .addr = ( FM25_TEST_IOV_ADDR + FM25_TEST_IOV_SIZE ),  .size = FM25_TEST_IOV_SIZE, .p_data = &data[FM25_TEST_IOV_SIZE] },
+        };
+        bool is_untouched = true;
+
+        memset( data, 0xEE, sizeof( data ));
+        fm25_sim_reset_stats( &sim );
+
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_readv( dev, zero, 3U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_readv( dev, &zero[1], 1U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_writev( dev, zero, 3U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_writev( dev, &zero[1], 1U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_writev( dev, zero, 0U ));
+
+        fm25_sim_get_stats( &sim, &sim_stats );
+
+        for ( uint32_t i = 0U; i < sizeof( data ); i++ )
+        {
+            is_untouched &= ( 0xEEU == data[i] );
+        }
+
+        FM25_TEST_CHECK(( 0U == sim_stats.cs_assert ) && ( true == is_untouched ));
+        FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+        // Random lists at end of memory against scalar calls
+        for ( uint32_t round = 0U; ( round < FM25_TEST_IOV_ROUND_NUM ) && ( eFM25_OK == status ); round++ )
+        {
+            uint8_t     seg_data[FM25_TEST_IOV_SEG_NUM][FM25_TEST_IOV_SEG_SIZE];
+            uint8_t     scalar[FM25_TEST_IOV_SEG_SIZE];
+            fm25_iov_t  iov[FM25_TEST_IOV_SEG_NUM];
+            uint32_t    rd_num  = 1U;
+            uint32_t    wr_num  = 1U;
+            uint32_t    end     = 0U;
+
+            seed = (( seed * 1103515245UL ) + 12345UL );
+
+            const uint32_t seg_num = ( 1U + (( seed >> 8U ) % FM25_TEST_IOV_SEG_NUM ));
+
+            for ( uint32_t i = 0U; i < seg_num; i++ )
+            {
+                seed = (( seed * 1103515245UL ) + 12345UL );
+
+                const uint32_t  rnd     = ( seed >> 8U );
+                const uint32_t  size    = ( 1U + ( rnd % FM25_TEST_IOV_SEG_SIZE ));
+                uint32_t        addr    = ( FM25_TEST_MEM_SIZE - FM25_TEST_IOV_WINDOW + (( rnd >> 5U ) % FM25_TEST_IOV_WINDOW ));
+
+                // Odd rounds chain segments by short gaps, even ones scatter them
+                if (( 0U != ( round % 2U )) && ( i > 0U ))
+                {
+                    addr = ( end + (( rnd >> 5U ) % ( FM25_TEST_IOV_CMD_SIZE + 2U )));
+                }
+
+                if ( addr > ( FM25_TEST_MEM_SIZE - size ))
+                {
+                    addr = ( FM25_TEST_MEM_SIZE - size );
+                }
+
+                if ( i > 0U )
+                {
+                    rd_num += (( addr < end ) || (( addr - end ) > FM25_TEST_IOV_CMD_SIZE )) ? 1U : 0U;
+                    wr_num += ( addr != end ) ? 1U : 0U;
+                }
+
+                for ( uint32_t j = 0U; j < size; j++ )
+                {
+                    seg_data[i][j] = (uint8_t)( rnd >> ( j % 16U ));
+                }
+
+                iov[i].addr     = addr;
+                iov[i].size     = size;
+                iov[i].p_data   = seg_data[i];
+                end             = ( addr + size );
+            }
+
+            // Write in list order, later segment wins overlap
+            memcpy( image, p_mem, FM25_TEST_MEM_SIZE );
+            fm25_sim_reset_stats( &sim );
+
+            status = fm25_writev( dev, iov, seg_num );
+
+            fm25_sim_get_stats( &sim, &sim_stats );
+            memcpy( model, p_mem, FM25_TEST_MEM_SIZE );
+            memcpy( p_mem, image, FM25_TEST_MEM_SIZE );
+
+            FM25_TEST_CHECK( wr_num == sim_stats.write );
+
+            for ( uint32_t i = 0U; i < seg_num; i++ )
+            {
+                status |= fm25_write( dev, iov[i].addr, iov[i].size, iov[i].p_data );
+            }
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+            FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+            // Read back into cleared segments
+            for ( uint32_t i = 0U; i < seg_num; i++ )
+            {
+                memset( seg_data[i], 0, FM25_TEST_IOV_SEG_SIZE );
+            }
+
+            fm25_sim_reset_stats( &sim );
+
+            status = fm25_readv( dev, iov, seg_num );
+
+            fm25_sim_get_stats( &sim, &sim_stats );
+
+            FM25_TEST_CHECK( rd_num == sim_stats.read );
+
+            for ( uint32_t i = 0U; i < seg_num; i++ )
+            {
+                status |= fm25_read( dev, iov[i].addr, iov[i].size, scalar );
+
+                FM25_TEST_CHECK( 0 == memcmp( iov[i].p_data, scalar, iov[i].size ));
+                FM25_TEST_CHECK( 0 == memcmp( iov[i].p_data, &model[iov[i].addr], iov[i].size ));
+            }
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+        }
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Fill, sequential fill and erase against model
+*
+* @note     Lengths around and over pattern block, not multiple of block
+*           nor of pattern, start at odd address and end at last byte of
+*           memory. Each call is single write command, bytes around range
+*           keep content. Invalid pattern size or range transfers nothing.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_fill(void)
+{
+    static const struct
+    {
+        uint32_t    size;
+        uint32_t    pattern;
+        uint8_t     pattern_size;
+    } op[] =
+    {
+        { 1U,                                           0x55A5U,        1U },   // Upper pattern bytes ignored
+        { 3U,                                           0xFFFF1234UL,   2U },   // Pattern cut inside second repeat
+        { 7U,                                           0x89ABCDEFUL,   4U },
+        { ( FM25_CFG_FILL_BLOCK_SIZE - 1U ),            0x5AU,          1U },
+        { FM25_CFG_FILL_BLOCK_SIZE,                     0xC3D2U,        2U },
+        { ( FM25_CFG_FILL_BLOCK_SIZE + 1U ),            0x01020304UL,   4U },
+        { (( 2U * FM25_CFG_FILL_BLOCK_SIZE ) + 3U ),    0xF00DU,        2U },
+        { (( 2U * FM25_CFG_FILL_BLOCK_SIZE ) + 6U ),    0xDEADBEEFUL,   4U },
+    };
+
+    static uint8_t  model[FM25_TEST_MEM_SIZE];
+    fm25_sim_t      sim     = { 0 };
+    fm25_dev_t      dev     = NULL;
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        seed    = 5U;
+    fm25_dev_cfg_t  cfg     =
+    {
+        .p_if   = &g_fm25_sim_if,
+    };
+
+    for ( uint32_t i = 0U; i < FM25_TEST_MEM_SIZE; i++ )
+    {
+        seed        = (( seed * 1103515245UL ) + 12345UL );
+        model[i]    = (uint8_t)( seed >> 16U );
+    }
+
+    status = fm25_test_open_cfg( &sim, &dev, &cfg, model );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        uint8_t * const     p_mem       = fm25_sim_get_mem( &sim );
+        fm25_sim_stats_t    sim_stats   = { 0 };
+
+        #if ( 1 == FM25_CFG_STATS_EN )
+            fm25_stats_t    before      = { 0 };
+            fm25_stats_t    after       = { 0 };
+        #endif
+
+        for ( uint32_t i = 0U; i < ( 2U * ( sizeof( op ) / sizeof( op[0] ))); i++ )
+        {
+            const uint32_t  size    = op[i / 2U].size;
+            const uint32_t  pattern = op[i / 2U].pattern;
+            const uint8_t   ps      = op[i / 2U].pattern_size;
+            const uint32_t  addr    = ( 0U == ( i % 2U )) ? ( FM25_TEST_FILL_ADDR + i ) : ( FM25_TEST_MEM_SIZE - size );
+
+            // Fill, sequential fill and erase of same range
+            for ( uint32_t kind = 0U; kind < 3U; kind++ )
+            {
+                fm25_sim_reset_stats( &sim );
+
+                #if ( 1 == FM25_CFG_STATS_EN )
+                    FM25_TEST_CHECK( eFM25_OK == fm25_get_stats( dev, &before ));
+                #endif
+
+                if ( 0U == kind )
+                {
+                    status = fm25_fill( dev, addr, size, pattern, ps );
+                }
+                else if ( 1U == kind )
+                {
+                    status = fm25_fill_seq( dev, addr, size );
+                }
+                else
+                {
+                    status = fm25_erase( dev, addr, size );
+                }
+
+                for ( uint32_t j = 0U; j < size; j++ )
+                {
+                    if ( 0U == kind )
+                    {
+                        model[addr + j] = (uint8_t)( pattern >> ( 8U * ( ps - 1U - ( j % ps ))));
+                    }
+                    else if ( 1U == kind )
+                    {
+                        model[addr + j] = FM25_SEQ_VALUE( addr + j );
+                    }
+                    else
+                    {
+                        model[addr + j] = FM25_TEST_ERASE_VALUE;
+                    }
+                }
+
+                fm25_sim_get_stats( &sim, &sim_stats );
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK(( 1U == sim_stats.write ) && ( 0U == sim_stats.violations ));
+                FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+                #if ( 1 == FM25_CFG_STATS_EN )
+                    const uint32_t erase_num = ( 2U == kind ) ? 1U : 0U;
+
+                    FM25_TEST_CHECK( eFM25_OK == fm25_get_stats( dev, &after ));
+                    FM25_TEST_CHECK((( before.erase + erase_num ) == after.erase ) && (( before.write + 1U - erase_num ) == after.write ));
+                    FM25_TEST_CHECK(( before.wr_bytes + size ) == after.wr_bytes );
+                #endif
+            }
+        }
+
+        // Invalid pattern size, empty range and range past last byte
+        fm25_sim_reset_stats( &sim );
+
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_fill( dev, FM25_TEST_FILL_ADDR, 8U, 0x12U, 0U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_fill( dev, FM25_TEST_FILL_ADDR, 8U, 0x123456UL, 3U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_fill( dev, FM25_TEST_FILL_ADDR, 0U, 0x12U, 1U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_fill_seq( dev, FM25_TEST_FILL_ADDR, 0U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_fill_seq( dev, ( FM25_TEST_MEM_SIZE - 10U ), 11U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_erase( dev, FM25_TEST_MEM_SIZE, 1U ));
+        FM25_TEST_CHECK( eFM25_ERROR == fm25_erase( dev, ( FM25_TEST_MEM_SIZE - 1U ), 2U ));
+
+        fm25_sim_get_stats( &sim, &sim_stats );
+
+        FM25_TEST_CHECK( 0U == sim_stats.cs_assert );
+        FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Block device adapter against model
+*
+* @note     Region starts at odd address and spans rest of device. Each
+*           block is programmed and read back, access past block count or
+*           block end, unaligned to read/program size, empty or wrapping
+*           around is rejected without bus traffic. Erase fills block by
+*           single write command or is no-op by mode. Failed device
+*           access is reported as I/O error.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_bd(void)
+{
+    static uint8_t  model[FM25_TEST_MEM_SIZE];
+    fm25_sim_t      sim     = { 0 };
+    fm25_dev_t      dev     = NULL;
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        seed    = 23U;
+    fm25_dev_cfg_t  cfg     =
+    {
+        .p_if   = &g_fm25_sim_if,
+    };
+
+    for ( uint32_t i = 0U; i < FM25_TEST_MEM_SIZE; i++ )
+    {
+        seed        = (( seed * 1103515245UL ) + 12345UL );
+        model[i]    = (uint8_t)( seed >> 16U );
+    }
+
+    status = fm25_test_open_cfg( &sim, &dev, &cfg, model );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        const uint32_t      block_num   = (( FM25_TEST_MEM_SIZE - FM25_TEST_BD_ADDR ) / FM25_TEST_BD_BLOCK_SIZE );
+        uint8_t * const     p_mem       = fm25_sim_get_mem( &sim );
+        fm25_bd_t           bd          = { 0 };
+        fm25_bd_cfg_t       bd_cfg      =
+        {
+            .dev            = dev,
+            .addr           = FM25_TEST_BD_ADDR,
+            .block_size     = FM25_TEST_BD_BLOCK_SIZE,
+            .block_num      = 0U,
+            .read_size      = FM25_TEST_BD_READ_SIZE,
+            .prog_size      = FM25_TEST_BD_PROG_SIZE,
+            .erase          = eFM25_BD_ERASE_NONE,
+        };
+        uint8_t             data[FM25_TEST_BD_BLOCK_SIZE];
+        fm25_sim_stats_t    sim_stats   = { 0 };
+        uint32_t            num         = 0U;
+
+        // Unusable configurations
+        const fm25_bd_cfg_t bad_cfg[] =
+        {
+            { dev,  FM25_TEST_MEM_SIZE,     FM25_TEST_BD_BLOCK_SIZE,    0U,                 FM25_TEST_BD_READ_SIZE, FM25_TEST_BD_PROG_SIZE, eFM25_BD_ERASE_NONE },  // Region past device
+            { dev,  FM25_TEST_BD_ADDR,      0U,                         0U,                 FM25_TEST_BD_READ_SIZE, FM25_TEST_BD_PROG_SIZE, eFM25_BD_ERASE_NONE },
+            { dev,  FM25_TEST_BD_ADDR,      FM25_TEST_BD_BLOCK_SIZE,    0U,                 0U,                     FM25_TEST_BD_PROG_SIZE, eFM25_BD_ERASE_NONE },
+            { dev,  FM25_TEST_BD_ADDR,      FM25_TEST_BD_BLOCK_SIZE,    0U,                 FM25_TEST_BD_READ_SIZE, 0U,                     eFM25_BD_ERASE_NONE },
+            { dev,  FM25_TEST_BD_ADDR,      60U,                        0U,                 FM25_TEST_BD_READ_SIZE, FM25_TEST_BD_PROG_SIZE, eFM25_BD_ERASE_NONE },  // Block not multiple of program size
+            { dev,  FM25_TEST_BD_ADDR,      FM25_TEST_BD_BLOCK_SIZE,    0U,                 3U,                     FM25_TEST_BD_PROG_SIZE, eFM25_BD_ERASE_NONE },  // Block not multiple of read size
+            { dev,  FM25_TEST_BD_ADDR,      FM25_TEST_BD_BLOCK_SIZE,    ( block_num + 1U ), FM25_TEST_BD_READ_SIZE, FM25_TEST_BD_PROG_SIZE, eFM25_BD_ERASE_NONE },  // Blocks past device
+            { dev,  ( FM25_TEST_MEM_SIZE - FM25_TEST_BD_BLOCK_SIZE + 1U ), FM25_TEST_BD_BLOCK_SIZE, 0U, FM25_TEST_BD_READ_SIZE, FM25_TEST_BD_PROG_SIZE, eFM25_BD_ERASE_NONE },  // No whole block
+            { dev,  FM25_TEST_BD_ADDR,      FM25_TEST_BD_BLOCK_SIZE,    0U,                 FM25_TEST_BD_READ_SIZE, FM25_TEST_BD_PROG_SIZE, (fm25_bd_erase_t) 2 },
+        };
+
+        for ( uint32_t i = 0U; i < ( sizeof( bad_cfg ) / sizeof( bad_cfg[0] )); i++ )
+        {
+            FM25_TEST_CHECK( eFM25_ERROR == fm25_bd_init( &bd, &bad_cfg[i] ));
+        }
+
+        // Not initialized
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0U, 0U, data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_sync( &bd ));
+        FM25_TEST_CHECK( eFM25_ERROR_INIT == fm25_bd_get_block_num( &bd, &num ));
+
+        FM25_TEST_CHECK( eFM25_OK == fm25_bd_init( &bd, &bd_cfg ));
+        FM25_TEST_CHECK(( eFM25_OK == fm25_bd_get_block_num( &bd, &num )) && ( block_num == num ));
+
+        // Program and read back every block
+        for ( uint32_t block = 0U; block < block_num; block++ )
+        {
+            const uint32_t addr = ( FM25_TEST_BD_ADDR + ( block * FM25_TEST_BD_BLOCK_SIZE ));
+
+            for ( uint32_t i = 0U; i < FM25_TEST_BD_BLOCK_SIZE; i++ )
+            {
+                data[i] = (uint8_t)(( block * 7U ) + i );
+            }
+
+            memcpy( &model[addr], data, FM25_TEST_BD_BLOCK_SIZE );
+
+            FM25_TEST_CHECK( FM25_BD_OK == fm25_bd_prog( &bd, block, 0U, data, FM25_TEST_BD_BLOCK_SIZE ));
+
+            memset( data, 0, sizeof( data ));
+
+            FM25_TEST_CHECK( FM25_BD_OK == fm25_bd_read( &bd, block, 0U, data, FM25_TEST_BD_BLOCK_SIZE ));
+            FM25_TEST_CHECK( 0 == memcmp( data, &model[addr], FM25_TEST_BD_BLOCK_SIZE ));
+        }
+
+        FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+        // Partial access at units, up to last unit of last block
+        const uint32_t last = ( FM25_TEST_BD_ADDR + ( block_num * FM25_TEST_BD_BLOCK_SIZE ));
+
+        FM25_TEST_CHECK( FM25_BD_OK == fm25_bd_read( &bd, 1U, FM25_TEST_BD_READ_SIZE, data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( 0 == memcmp( data, &model[FM25_TEST_BD_ADDR + FM25_TEST_BD_BLOCK_SIZE + FM25_TEST_BD_READ_SIZE], FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_OK == fm25_bd_read( &bd, ( block_num - 1U ), ( FM25_TEST_BD_BLOCK_SIZE - FM25_TEST_BD_READ_SIZE ), data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( 0 == memcmp( data, &model[last - FM25_TEST_BD_READ_SIZE], FM25_TEST_BD_READ_SIZE ));
+
+        memset( data, 0x5A, sizeof( data ));
+        memset( &model[last - FM25_TEST_BD_PROG_SIZE], 0x5A, FM25_TEST_BD_PROG_SIZE );
+
+        FM25_TEST_CHECK( FM25_BD_OK == fm25_bd_prog( &bd, ( block_num - 1U ), ( FM25_TEST_BD_BLOCK_SIZE - FM25_TEST_BD_PROG_SIZE ), data, FM25_TEST_BD_PROG_SIZE ));
+        FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+        // Out of bounds, unaligned, empty and wrapping access
+        fm25_sim_reset_stats( &sim );
+
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, block_num, 0U, data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0xFFFFFFFFUL, 0U, data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0U, FM25_TEST_BD_BLOCK_SIZE, data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0U, ( FM25_TEST_BD_BLOCK_SIZE - FM25_TEST_BD_READ_SIZE ), data, ( 2U * FM25_TEST_BD_READ_SIZE )));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0U, FM25_TEST_BD_READ_SIZE, data, ( 0U - FM25_TEST_BD_READ_SIZE )));     // End wraps to block start
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0U, 0U, data, 0U ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0U, 0U, NULL, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0U, ( FM25_TEST_BD_READ_SIZE / 2U ), data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_read( &bd, 0U, 0U, data, ( FM25_TEST_BD_READ_SIZE + 1U )));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_prog( &bd, block_num, 0U, data, FM25_TEST_BD_PROG_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_prog( &bd, 0U, ( FM25_TEST_BD_BLOCK_SIZE - FM25_TEST_BD_PROG_SIZE ), data, ( 2U * FM25_TEST_BD_PROG_SIZE )));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_prog( &bd, 0U, FM25_TEST_BD_READ_SIZE, data, FM25_TEST_BD_PROG_SIZE ));   // Read aligned only
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_prog( &bd, 0U, 0U, data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_prog( &bd, 0U, 0U, NULL, FM25_TEST_BD_PROG_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_erase( &bd, block_num ));
+        FM25_TEST_CHECK( FM25_BD_ERR_INVAL == fm25_bd_erase( NULL, 0U ));
+
+        fm25_sim_get_stats( &sim, &sim_stats );
+
+        FM25_TEST_CHECK( 0U == sim_stats.cs_assert );
+        FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+        // Erase is no-op
+        FM25_TEST_CHECK( FM25_BD_OK == fm25_bd_erase( &bd, 1U ));
+        FM25_TEST_CHECK( FM25_BD_OK == fm25_bd_sync( &bd ));
+
+        fm25_sim_get_stats( &sim, &sim_stats );
+
+        FM25_TEST_CHECK( 0U == sim_stats.cs_assert );
+        FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+        // Erase fills first and last block with erase value
+        bd_cfg.erase = eFM25_BD_ERASE_FILL;
+
+        FM25_TEST_CHECK( eFM25_OK == fm25_bd_init( &bd, &bd_cfg ));
+
+        for ( uint32_t i = 0U; i < 2U; i++ )
+        {
+            const uint32_t block = ( 0U == i ) ? 0U : ( block_num - 1U );
+
+            fm25_sim_reset_stats( &sim );
+
+            FM25_TEST_CHECK( FM25_BD_OK == fm25_bd_erase( &bd, block ));
+
+            fm25_sim_get_stats( &sim, &sim_stats );
+            memset( &model[FM25_TEST_BD_ADDR + ( block * FM25_TEST_BD_BLOCK_SIZE )], FM25_TEST_ERASE_VALUE, FM25_TEST_BD_BLOCK_SIZE );
+
+            FM25_TEST_CHECK( 1U == sim_stats.write );
+            FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+        }
+
+        // Failed device access
+        (void) fm25_close( dev );
+
+        FM25_TEST_CHECK( FM25_BD_ERR_IO == fm25_bd_read( &bd, 0U, 0U, data, FM25_TEST_BD_READ_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_IO == fm25_bd_prog( &bd, 0U, 0U, data, FM25_TEST_BD_PROG_SIZE ));
+        FM25_TEST_CHECK( FM25_BD_ERR_IO == fm25_bd_erase( &bd, 0U ));
+        FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Checkpoint against model in baseline and hash mode
+*
+* @note     State starts at odd address and is not multiple of hash
+*           block. After each commit of single byte, scattered and
+*           gap-separated changes stored image is byte-identical to
+*           state, rest of device is untouched and write commands and
+*           bytes match merged runs. Runs past segment storage extend
+*           last segment. Unchanged state costs no device access. Commit
+*           failed by power loss rewrites whole state next time, also in
+*           hash mode where failed diff already took hashes of changes.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_test_ckpt(void)
+{
+    // Bytes changed by step, write commands and bytes in baseline and hash mode
+    static const struct
+    {
+        uint32_t    off[6];
+        uint32_t    off_num;
+        uint32_t    run[2];
+        uint32_t    written[2];
+    } step[] =
+    {
+        { { 0U },                                                                   1U, { 1U, 1U }, { 1U,                               64U     }},  // First byte
+        { { ( FM25_TEST_CKPT_SIZE - 1U ) },                                         1U, { 1U, 1U }, { 1U,                               44U     }},  // Last byte of short block
+        { { 100U, ( 101U + FM25_TEST_CKPT_GAP ) },                                  2U, { 1U, 1U }, { ( FM25_TEST_CKPT_GAP + 2U ),      64U     }},  // Gap merged
+        { { 100U, ( 102U + FM25_TEST_CKPT_GAP ) },                                  2U, { 2U, 1U }, { 2U,                               64U     }},  // Gap split
+        { { 10U, 150U, 290U },                                                      3U, { 3U, 3U }, { 3U,                               172U    }},  // Scattered
+        { { 10U, 40U, 70U, 150U, 200U, 290U },                                      6U, { 4U, 1U }, { 144U,                             300U    }},  // Runs past segments
+        { { 62U, 63U, 64U, 65U },                                                   4U, { 1U, 1U }, { 4U,                               128U    }},  // Across block border
+    };
+
+    static uint8_t  model[FM25_TEST_MEM_SIZE];
+    fm25_sim_t      sim     = { 0 };
+    fm25_dev_t      dev     = NULL;
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        seed    = 29U;
+
+    for ( uint32_t i = 0U; i < FM25_TEST_MEM_SIZE; i++ )
+    {
+        seed        = (( seed * 1103515245UL ) + 12345UL );
+        model[i]    = (uint8_t)( seed >> 16U );
+    }
+
+    status = fm25_test_power_open( &sim, &dev );
+
+    FM25_TEST_CHECK( eFM25_OK == status );
+
+    if ( eFM25_OK == status )
+    {
+        static uint8_t      base[FM25_TEST_CKPT_SIZE];
+        static uint32_t     hash[FM25_CKPT_HASH_NUM( FM25_TEST_CKPT_SIZE )];
+        static uint8_t      state[FM25_TEST_CKPT_SIZE];
+        uint8_t * const     p_mem       = fm25_sim_get_mem( &sim );
+        fm25_iov_t          iov[FM25_TEST_CKPT_IOV_NUM];
+        fm25_ckpt_t         ckpt        = { 0 };
+        fm25_ckpt_stats_t   stats       = { 0 };
+        fm25_sim_stats_t    sim_stats   = { 0 };
+
+        memcpy( p_mem, model, FM25_TEST_MEM_SIZE );
+
+        for ( uint32_t mode = 0U; mode < 2U; mode++ )
+        {
+            const fm25_ckpt_cfg_t ckpt_cfg =
+            {
+                .dev        = dev,
+                .addr       = FM25_TEST_CKPT_ADDR,
+                .size       = FM25_TEST_CKPT_SIZE,
+                .p_base     = ( 0U == mode ) ? base : NULL,
+                .p_hash     = ( 0U == mode ) ? NULL : hash,
+                .p_iov      = iov,
+                .iov_num    = FM25_TEST_CKPT_IOV_NUM,
+                .gap        = FM25_TEST_CKPT_GAP,
+            };
+
+            // Restore
+            memset( state, 0, sizeof( state ));
+
+            FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_init( &ckpt, &ckpt_cfg, state ));
+            FM25_TEST_CHECK( 0 == memcmp( state, &model[FM25_TEST_CKPT_ADDR], FM25_TEST_CKPT_SIZE ));
+
+            // Unchanged state
+            fm25_sim_reset_stats( &sim );
+
+            FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_commit( &ckpt, state ));
+            FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_get_stats( &ckpt, &stats ));
+
+            fm25_sim_get_stats( &sim, &sim_stats );
+
+            FM25_TEST_CHECK( 0U == sim_stats.cs_assert );
+            FM25_TEST_CHECK(( 0U == stats.last_run ) && ( 0U == stats.last_written ));
+
+            for ( uint32_t i = 0U; i < ( sizeof( step ) / sizeof( step[0] )); i++ )
+            {
+                for ( uint32_t j = 0U; j < step[i].off_num; j++ )
+                {
+                    state[step[i].off[j]]                           ^= 0xA5U;
+                    model[FM25_TEST_CKPT_ADDR + step[i].off[j]]     = state[step[i].off[j]];
+                }
+
+                FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_commit( &ckpt, state ));
+                FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_get_stats( &ckpt, &stats ));
+                FM25_TEST_CHECK( step[i].run[mode] == stats.last_run );
+                FM25_TEST_CHECK( step[i].written[mode] == stats.last_written );
+                FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+            }
+
+            // Random changes
+            for ( uint32_t round = 0U; round < FM25_TEST_CKPT_ROUND_NUM; round++ )
+            {
+                seed = (( seed * 1103515245UL ) + 12345UL );
+
+                const uint32_t change_num = (( seed >> 16U ) % 5U );
+
+                for ( uint32_t j = 0U; j < change_num; j++ )
+                {
+                    seed = (( seed * 1103515245UL ) + 12345UL );
+
+                    const uint32_t off = (( seed >> 8U ) % FM25_TEST_CKPT_SIZE );
+
+                    state[off]                          = (uint8_t)( seed >> 24U );
+                    model[FM25_TEST_CKPT_ADDR + off]    = state[off];
+                }
+
+                FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_commit( &ckpt, state ));
+                FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+            }
+
+            // Power loss after WREN and part of first write command
+            state[5U]   ^= 0xA5U;
+            state[200U] ^= 0xA5U;
+
+            fm25_test_power_cut( 3U );
+
+            FM25_TEST_CHECK( eFM25_OK != fm25_ckpt_commit( &ckpt, state ));
+
+            g_power_is_armed    = false;
+            g_power_is_off      = false;
+
+            // Next commit rewrites whole state
+            memcpy( &model[FM25_TEST_CKPT_ADDR], state, FM25_TEST_CKPT_SIZE );
+
+            FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_commit( &ckpt, state ));
+            FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_get_stats( &ckpt, &stats ));
+            FM25_TEST_CHECK(( 1U == stats.last_run ) && ( FM25_TEST_CKPT_SIZE == stats.last_written ));
+            FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+
+            // And diff again after it
+            state[5U] ^= 0xA5U;
+            model[FM25_TEST_CKPT_ADDR + 5U] = state[5U];
+
+            FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_commit( &ckpt, state ));
+            FM25_TEST_CHECK( eFM25_OK == fm25_ckpt_get_stats( &ckpt, &stats ));
+            FM25_TEST_CHECK(( 1U == stats.last_run ) && ( FM25_TEST_CKPT_SIZE > stats.last_written ));
+            FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+        }
+
+        (void) fm25_close( dev );
+    }
+
+    (void) fm25_sim_close( &sim );
+}
+
+#if ( 1 == FM25_CFG_SHADOW_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        RAM shadow coherence against device
+    *
+    * @note     Random writes, vectored writes, fills, erases, copies and,
+    *           with asynchronous support, chained overlapping asynchronous
+    *           writes are applied to model. After each of them shadow,
+    *           device and model agree, reads are served without bus access
+    *           and background check step passes. Device changed behind
+    *           driver fails check at the end of pass.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_shadow(void)
+    {
+        static uint8_t  model[FM25_TEST_MEM_SIZE];
+        static uint8_t  shadow[FM25_TEST_MEM_SIZE];
+        fm25_sim_t      sim     = { 0 };
+        fm25_dev_t      dev     = NULL;
+        fm25_status_t   status  = eFM25_OK;
+        uint32_t        seed    = 17U;
+        fm25_dev_cfg_t  cfg     =
+        {
+            .p_if           = &g_fm25_sim_if,
+            .p_shadow       = shadow,
+            .shadow_size    = sizeof( shadow ),
+        };
+
+        #if ( 1 == FM25_CFG_ASYNC_EN )
+            fm25_sim_dma_t dma = { 0 };
+
+            cfg.p_if        = &g_fm25_sim_dma_if;
+            cfg.p_if_ctx    = &dma;
+
+            status = fm25_sim_dma_open( &dma, &sim );
+        #endif
+
+        for ( uint32_t i = 0U; i < FM25_TEST_MEM_SIZE; i++ )
+        {
+            seed        = (( seed * 1103515245UL ) + 12345UL );
+            model[i]    = (uint8_t)( seed >> 16U );
+        }
+
+        memset( shadow, 0, sizeof( shadow ));
+
+        status |= fm25_test_open_cfg( &sim, &dev, &cfg, model );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+
+        if ( eFM25_OK == status )
+        {
+            uint8_t * const     p_mem       = fm25_sim_get_mem( &sim );
+            const uint8_t *     p_ptr       = NULL;
+            const uint8_t       ptr_data[4] = { 0x01U, 0x02U, 0x03U, 0x04U };
+            uint8_t             data[FM25_TEST_SHADOW_SIZE_MAX];
+            fm25_sim_stats_t    sim_stats   = { 0 };
+            bool                is_done     = false;
+
+            // Whole array loaded at open
+            FM25_TEST_CHECK( 0 == memcmp( shadow, model, FM25_TEST_MEM_SIZE ));
+
+            for ( uint32_t round = 0U; ( round < FM25_TEST_SHADOW_ROUND_NUM ) && ( eFM25_OK == status ); round++ )
+            {
+                seed = (( seed * 1103515245UL ) + 12345UL );
+
+                const uint32_t  rnd     = ( seed >> 8U );
+                const uint32_t  kind    = ( rnd % FM25_TEST_SHADOW_KIND_NUM );
+                const uint32_t  size    = ( 1U + (( rnd >> 3U ) % FM25_TEST_SHADOW_SIZE_MAX ));
+                const uint32_t  addr    = (( rnd >> 9U ) % ( FM25_TEST_MEM_SIZE - size + 1U ));
+
+                for ( uint32_t i = 0U; i < FM25_TEST_SHADOW_SIZE_MAX; i++ )
+                {
+                    data[i] = (uint8_t)(( round * 13U ) + i );
+                }
+
+                if ( 0U == kind )
+                {
+                    status = fm25_write( dev, addr, size, data );
+
+                    memcpy( &model[addr], data, size );
+                }
+                else if ( 1U == kind )
+                {
+                    // Second segment overlaps first one, third one is anywhere
+                    const fm25_iov_t iov[3] =
+                    {
+                        { .addr = addr,                             .size = size,   .p_data = &data[0]  },
+                        { .addr = ( addr + (( size - 1U ) / 2U )),  .size = 1U,     .p_data = &data[1]  },
+                        { .addr = (( rnd >> 3U ) % FM25_TEST_MEM_SIZE ), .size = 1U, .p_data = &data[2] },
+                    };
+
+                    status = fm25_writev( dev, iov, 3U );
+
+                    for ( uint32_t i = 0U; i < 3U; i++ )
+                    {
+                        memcpy( &model[iov[i].addr], iov[i].p_data, iov[i].size );
+                    }
+                }
+                else if ( 2U == kind )
+                {
+                    const uint8_t ps = (uint8_t)( 1U << (( rnd >> 5U ) % 3U ));
+
+                    status = fm25_fill( dev, addr, size, seed, ps );
+
+                    for ( uint32_t i = 0U; i < size; i++ )
+                    {
+                        model[addr + i] = (uint8_t)( seed >> ( 8U * ( ps - 1U - ( i % ps ))));
+                    }
+                }
+                else if ( 3U == kind )
+                {
+                    status = fm25_fill_seq( dev, addr, size );
+
+                    for ( uint32_t i = 0U; i < size; i++ )
+                    {
+                        model[addr + i] = FM25_SEQ_VALUE( addr + i );
+                    }
+                }
+                else if ( 4U == kind )
+                {
+                    status = fm25_erase( dev, addr, size );
+
+                    memset( &model[addr], FM25_TEST_ERASE_VALUE, size );
+                }
+                else if ( 5U == kind )
+                {
+                    // Source near destination, overlapping in either direction
+                    const uint32_t src = (( addr + ( rnd & 0x3FU )) % ( FM25_TEST_MEM_SIZE - size + 1U ));
+
+                    status = fm25_copy( dev, addr, src, size );
+
+                    memmove( &model[addr], &model[src], size );
+                }
+                else
+                {
+                    #if ( 1 == FM25_CFG_ASYNC_EN )
+                        fm25_async_t    req[2];
+                        bool            is_busy = true;
+
+                        // Chained overlapping writes, later one wins
+                        status = fm25_write_async( dev, &req[0], addr, size, &data[0], NULL, NULL );
+                        status |= fm25_write_async( dev, &req[1], ( addr + ( size / 2U )), ( size - ( size / 2U )), &data[1], NULL, NULL );
+
+                        for ( uint32_t i = 0U; ( i < FM25_TEST_SHADOW_POLL_NUM ) && ( true == is_busy ) && ( eFM25_OK == status ); i++ )
+                        {
+                            status = fm25_is_busy( dev, &is_busy );
+
+                            (void) sched_yield();
+                        }
+
+                        FM25_TEST_CHECK( false == is_busy );
+
+                        memcpy( &model[addr], &data[0], size );
+                        memcpy( &model[addr + ( size / 2U )], &data[1], ( size - ( size / 2U )));
+                    #endif
+                }
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK( 0 == memcmp( p_mem, model, FM25_TEST_MEM_SIZE ));
+                FM25_TEST_CHECK( 0 == memcmp( shadow, model, FM25_TEST_MEM_SIZE ));
+
+                // Read served from shadow without bus access
+                fm25_sim_reset_stats( &sim );
+
+                status |= fm25_read( dev, addr, size, data );
+                status |= fm25_shadow_check( dev, NULL );
+
+                fm25_sim_get_stats( &sim, &sim_stats );
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK( 0 == memcmp( data, &model[addr], size ));
+                FM25_TEST_CHECK( 1U == sim_stats.read );
+            }
+
+            // Pointer into shadow follows later write
+            status = fm25_shadow_ptr( dev, FM25_TEST_SHADOW_ADDR, sizeof( ptr_data ), &p_ptr );
+            status |= fm25_write( dev, FM25_TEST_SHADOW_ADDR, sizeof( ptr_data ), ptr_data );
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+            FM25_TEST_CHECK( 0 == memcmp( p_ptr, ptr_data, sizeof( ptr_data )));
+
+            // Device changed behind driver fails check at the end of pass
+            p_mem[FM25_TEST_MEM_SIZE - 1U] ^= 0x01U;
+
+            do
+            {
+                status = fm25_shadow_check( dev, &is_done );
+            } while (( false == is_done ) && ( eFM25_OK == status ));
+
+            FM25_TEST_CHECK(( eFM25_ERROR_SHADOW == status ) && ( true == is_done ));
+
+            // Next pass over restored device passes
+            p_mem[FM25_TEST_MEM_SIZE - 1U] ^= 0x01U;
+
+            do
+            {
+                status = fm25_shadow_check( dev, &is_done );
+            } while (( false == is_done ) && ( eFM25_OK == status ));
+
+            FM25_TEST_CHECK(( eFM25_OK == status ) && ( true == is_done ));
+
+            (void) fm25_close( dev );
+        }
+
+        #if ( 1 == FM25_CFG_ASYNC_EN )
+            (void) fm25_sim_dma_close( &dma );
+        #endif
+
+        (void) fm25_sim_close( &sim );
+    }
+
+#endif
+
+#if ( 1 == FM25_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Number of operations in latency histogram
+    *
+    * @param[in]    p_stats - Pointer to device statistics
+    * @param[in]    op      - Operation
+    * @return       num     - Sum of all histogram buckets of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t fm25_test_lat_num(const fm25_stats_t * const p_stats, const fm25_stats_op_t op)
+    {
+        uint32_t num = 0U;
+
+        for ( uint32_t bucket = 0U; bucket < FM25_STATS_LAT_NUM; bucket++ )
+        {
+            num += p_stats->lat[op][bucket];
+        }
+
+        return num;
+    }
+
+#endif
+
+#if ( 1 == FM25_CFG_VERIFY_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Transmit to simulated device with memory cell stuck at zero
+    *
+    * @param[in]    p_ctx       - Pointer to simulated device
+    * @param[in]    p_data      - Pointer to transmit data
+    * @param[in]    size        - Size of transfer
+    * @param[in]    cs_action   - Chip select action
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_test_stuck_transmit(void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action)
+    {
+        const fm25_status_t status = g_fm25_sim_if.pf_transmit( p_ctx, p_data, size, cs_action );
+
+        if ( g_stuck_addr < FM25_TEST_MEM_SIZE )
+        {
+            fm25_sim_get_mem((fm25_sim_t*) p_ctx )[g_stuck_addr] = 0U;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Verify modes and reported mismatch address
+    *
+    * @note     Written data has no zero byte, thus cell stuck at zero
+    *           always holds wrong value. Full mode reports stuck cell,
+    *           sampled mode only when it lies in sampled chunk and CRC
+    *           mode reports start of range.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_verify(void)
+    {
+        static const uint32_t stuck[] =
+        {
+            FM25_TEST_VERIFY_NO_FAULT,
+            0U,                                     // First byte
+            ( FM25_CFG_VERIFY_CHUNK_SIZE + 3U ),    // Chunk skipped by sampling
+            ( FM25_TEST_VERIFY_SIZE - 1U ),         // Last byte
+        };
+
+        uint8_t         data[FM25_TEST_VERIFY_SIZE];
+        fm25_sim_t      sim     = { 0 };
+        fm25_dev_t      dev     = NULL;
+        fm25_status_t   status  = eFM25_OK;
+        fm25_dev_cfg_t  cfg     =
+        {
+            .p_if   = &g_stuck_if,
+            .verify = eFM25_VERIFY_FULL,
+        };
+
+        // Every transfer goes through stuck cell hook
+        g_stuck_if                  = g_fm25_sim_if;
+        g_stuck_if.pf_transmit      = fm25_test_stuck_transmit;
+        g_stuck_if.pf_transfer_seg  = NULL;
+        g_stuck_addr                = FM25_TEST_VERIFY_NO_FAULT;
+
+        for ( uint32_t i = 0U; i < FM25_TEST_VERIFY_SIZE; i++ )
+        {
+            data[i] = (uint8_t)((( i * 7U ) & 0x7FU ) | 0x80U );
+        }
+
+        status = fm25_test_open_cfg( &sim, &dev, &cfg, NULL );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+
+        if ( eFM25_OK == status )
+        {
+            for ( uint32_t mode = eFM25_VERIFY_NONE; mode <= eFM25_VERIFY_CRC; mode++ )
+            {
+                FM25_TEST_CHECK( eFM25_OK == fm25_set_verify( dev, (fm25_verify_t) mode ));
+
+                for ( uint32_t i = 0U; i < ( sizeof( stuck ) / sizeof( stuck[0] )); i++ )
+                {
+                    const bool      is_fault    = ( FM25_TEST_VERIFY_NO_FAULT != stuck[i] );
+                    const bool      is_sampled  = ( 0U == (( stuck[i] / FM25_CFG_VERIFY_CHUNK_SIZE ) % 2U ));
+                    const uint32_t  fault_addr  = ( FM25_TEST_VERIFY_ADDR + stuck[i] );
+                    uint32_t        addr        = FM25_TEST_VERIFY_NO_FAULT;
+                    bool            is_detect   = false;
+                    uint32_t        expect      = fault_addr;
+
+                    switch( mode )
+                    {
+                        case eFM25_VERIFY_FULL:
+                            is_detect   = is_fault;
+                            break;
+
+                        case eFM25_VERIFY_SAMPLED:
+                            is_detect   = (( true == is_fault ) && ( true == is_sampled ));
+                            break;
+
+                        case eFM25_VERIFY_CRC:
+                            is_detect   = is_fault;
+                            expect      = FM25_TEST_VERIFY_ADDR;
+                            break;
+
+                        case eFM25_VERIFY_NONE:
+                        default:
+                            break;
+                    }
+
+                    g_stuck_addr = ( true == is_fault ) ? fault_addr : FM25_TEST_VERIFY_NO_FAULT;
+
+                    status = fm25_write( dev, FM25_TEST_VERIFY_ADDR, FM25_TEST_VERIFY_SIZE, data );
+
+                    FM25_TEST_CHECK((( true == is_detect ) ? eFM25_ERROR_VERIFY : eFM25_OK ) == status );
+
+                    // Explicit verify of same range in same mode agrees with write
+                    FM25_TEST_CHECK( status == fm25_verify( dev, FM25_TEST_VERIFY_ADDR, FM25_TEST_VERIFY_SIZE, data, (fm25_verify_t) mode ));
+
+                    if ( true == is_detect )
+                    {
+                        FM25_TEST_CHECK(( eFM25_OK == fm25_get_verify_addr( dev, &addr )) && ( expect == addr ));
+                    }
+
+                    // Full verify always finds stuck cell
+                    FM25_TEST_CHECK((( true == is_fault ) ? eFM25_ERROR_VERIFY : eFM25_OK ) == fm25_verify( dev, FM25_TEST_VERIFY_ADDR, FM25_TEST_VERIFY_SIZE, data, eFM25_VERIFY_FULL ));
+
+                    if ( true == is_fault )
+                    {
+                        FM25_TEST_CHECK(( eFM25_OK == fm25_get_verify_addr( dev, &addr )) && ( fault_addr == addr ));
+                    }
+
+                    g_stuck_addr = FM25_TEST_VERIFY_NO_FAULT;
+                }
+            }
+
+            // Final content of overlapping segments is verified
+            {
+                uint8_t         other[16]   = { 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0xCCU, 0xDDU, 0xEEU, 0xF1U, 0xF2U };
+                const fm25_iov_t iov[2]     =
+                {
+                    { .addr = FM25_TEST_VERIFY_ADDR,           .size = 64U,                .p_data = data  },
+                    { .addr = ( FM25_TEST_VERIFY_ADDR + 16U ), .size = sizeof( other ),    .p_data = other },
+                };
+                uint32_t addr = 0U;
+
+                FM25_TEST_CHECK( eFM25_OK == fm25_set_verify( dev, eFM25_VERIFY_FULL ));
+                FM25_TEST_CHECK( eFM25_OK == fm25_writev( dev, iov, 2U ));
+
+                g_stuck_addr = ( FM25_TEST_VERIFY_ADDR + 20U );
+
+                FM25_TEST_CHECK( eFM25_ERROR_VERIFY == fm25_writev( dev, iov, 2U ));
+                FM25_TEST_CHECK(( eFM25_OK == fm25_get_verify_addr( dev, &addr )) && (( FM25_TEST_VERIFY_ADDR + 20U ) == addr ));
+
+                g_stuck_addr = ( FM25_TEST_VERIFY_ADDR + 40U );
+
+                FM25_TEST_CHECK( eFM25_ERROR_VERIFY == fm25_writev( dev, iov, 2U ));
+                FM25_TEST_CHECK(( eFM25_OK == fm25_get_verify_addr( dev, &addr )) && (( FM25_TEST_VERIFY_ADDR + 40U ) == addr ));
+
+                g_stuck_addr = FM25_TEST_VERIFY_NO_FAULT;
+
+                FM25_TEST_CHECK( eFM25_OK == fm25_writev( dev, iov, 2U ));
+            }
+
+            (void) fm25_close( dev );
+        }
+
+        (void) fm25_sim_close( &sim );
+    }
+
+#endif
+
+#if ( 1 == FM25_CFG_PAR_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Compare parameter tables
+    *
+    * @note     Parameters are compared byte by byte, padding is ignored.
+    *
+    * @param[in]    p_a         - Pointer to first table
+    * @param[in]    p_b         - Pointer to second table
+    * @return       is_equal    - True if all parameters are equal
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool fm25_test_par_is_equal(const fm25_par_t * const p_a, const fm25_par_t * const p_b)
+    {
+        return ( true FM25_PAR_LIST( FM25_TEST_PAR_IS_EQUAL ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Put table of other layout into device memory
+    *
+    * @param[out]   p_mem   - Pointer to device memory
+    * @param[in]    sig     - Layout signature of table
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_par_old(uint8_t * const p_mem, const uint32_t sig)
+    {
+        memcpy( &p_mem[FM25_PAR_CFG_ADDR], &sig, FM25_PAR_SIG_SIZE );
+        memset( &p_mem[FM25_PAR_CFG_ADDR + FM25_PAR_SIG_SIZE], FM25_TEST_PAR_OLD_BYTE, sizeof( fm25_par_image_t ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Parameter table after change of its layout
+    *
+    * @note     Table written with changed version, appended parameter and
+    *           wider parameters shall be reset to defaults at init, table
+    *           of current layout shall be kept. Power failure at each byte
+    *           of reset leaves table that is reset again at next init.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_par(void)
+    {
+        static const fm25_par_t def =
+        {
+            FM25_PAR_LIST( FM25_TEST_PAR_DEFAULT )
+        };
+
+        const uint32_t old_sig[] =
+        {
+            0U,     // Blank device
+            FM25_PAR_SIG_OF(( FM25_PAR_CFG_VER + 1 ), fm25_par_image_t, FM25_PAR_LIST( FM25_PAR_SIG_ITEM )),
+            FM25_PAR_SIG_OF( FM25_PAR_CFG_VER, fm25_test_par_append_t, FM25_TEST_PAR_APPEND_LIST( FM25_TEST_PAR_APPEND_ITEM )),
+            FM25_PAR_SIG_OF( FM25_PAR_CFG_VER, fm25_test_par_wide_t, FM25_PAR_LIST( FM25_TEST_PAR_WIDE_ITEM )),
+        };
+
+        static uint8_t  image[FM25_TEST_MEM_SIZE];
+        fm25_sim_t      sim         = { 0 };
+        fm25_dev_t      dev         = NULL;
+        fm25_status_t   status      = eFM25_OK;
+        fm25_par_t      par;
+        uint32_t        sig         = 0U;
+        bool            is_default  = false;
+
+        status = fm25_test_power_open( &sim, &dev );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+
+        if ( eFM25_OK == status )
+        {
+            for ( uint32_t i = 0U; i < ( sizeof( old_sig ) / sizeof( old_sig[0] )); i++ )
+            {
+                FM25_TEST_CHECK( FM25_PAR_SIG != old_sig[i] );
+
+                fm25_test_par_old( fm25_sim_get_mem( &sim ), old_sig[i] );
+
+                memset( &par, 0, sizeof( par ));
+
+                FM25_TEST_CHECK(( eFM25_OK == fm25_par_init( dev, &is_default )) && ( true == is_default ));
+                FM25_TEST_CHECK(( eFM25_OK == fm25_par_load( dev, &par )) && ( true == fm25_test_par_is_equal( &par, &def )));
+
+                memcpy( &sig, &fm25_sim_get_mem( &sim )[FM25_PAR_CFG_ADDR], FM25_PAR_SIG_SIZE );
+
+                FM25_TEST_CHECK( FM25_PAR_SIG == sig );
+            }
+
+            // Current layout is kept whatever its content
+            fm25_test_par_old( fm25_sim_get_mem( &sim ), FM25_PAR_SIG );
+            memcpy( image, fm25_sim_get_mem( &sim ), FM25_TEST_MEM_SIZE );
+
+            FM25_TEST_CHECK(( eFM25_OK == fm25_par_init( dev, &is_default )) && ( false == is_default ));
+            FM25_TEST_CHECK( 0 == memcmp( image, fm25_sim_get_mem( &sim ), FM25_TEST_MEM_SIZE ));
+
+            // Power failure during reset to defaults
+            fm25_test_par_old( image, old_sig[1] );
+
+            for ( uint32_t byte_num = 0U; eFM25_OK == status; byte_num++ )
+            {
+                bool is_done = false;
+
+                status = fm25_test_reboot( &sim, &dev, image );
+
+                if ( eFM25_OK == status )
+                {
+                    fm25_test_power_cut( byte_num );
+
+                    is_done = ( eFM25_OK == fm25_par_init( dev, NULL ));
+                    status  = fm25_test_reboot( &sim, &dev, NULL );
+                }
+
+                if ( eFM25_OK == status )
+                {
+                    memset( &par, 0, sizeof( par ));
+
+                    // Torn reset is repeated, completed one is not
+                    FM25_TEST_CHECK(( eFM25_OK == fm25_par_init( dev, &is_default )) && ( is_done != is_default ));
+                    FM25_TEST_CHECK(( eFM25_OK == fm25_par_load( dev, &par )) && ( true == fm25_test_par_is_equal( &par, &def )));
+                }
+
+                if ( true == is_done )
+                {
+                    break;
+                }
+            }
+
+            FM25_TEST_CHECK( eFM25_OK == status );
+
+            (void) fm25_close( dev );
+        }
+
+        (void) fm25_sim_close( &sim );
+    }
+
+#endif
+
+#if ( 1 == FM25_CFG_SLEEP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Timestamp of sleep governor
+    *
+    * @note     Each call advances simulated device by one tick, thus wait
+    *           for recovery time ends and bus sees time elapsed.
+    *
+    * @return       tick    - Timestamp in ticks
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t fm25_test_sleep_tick(void)
+    {
+        fm25_sim_delay( gp_sleep_sim, FM25_TEST_SLEEP_TICK_NS );
+        g_sleep_tick++;
+
+        return g_sleep_tick;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Put device to sleep by governor
+    *
+    * @param[in]    dev         - Device handle
+    * @param[in]    p_sim       - Pointer to simulated device
+    * @return       is_sleep    - True if device sleeps
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool fm25_test_sleep_enter(fm25_dev_t dev, const fm25_sim_t * const p_sim)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        for ( uint32_t i = 0U; ( i < ( 2U * FM25_TEST_SLEEP_WAKE_TIME )) && ( false == p_sim->sleep ) && ( eFM25_OK == status ); i++ )
+        {
+            status = fm25_sleep_process( dev );
+        }
+
+        return (( eFM25_OK == status ) && ( true == p_sim->sleep ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Sleep governor against simulated recovery time
+    *
+    * @note     Device sleeps once idle for "sleep_idle" ticks. Read and
+    *           write of sleeping device wake it and wait for tREC, wake-up
+    *           started ahead hides it fully or partly and is not undone by
+    *           governor before recovery ends. Queue wakes device only for
+    *           new requests. Simulator counts any access before end of
+    *           recovery as violation. Part without SLEEP command is never
+    *           put to sleep.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_sleep(void)
+    {
+        static uint8_t      model[FM25_TEST_MEM_SIZE];
+        fm25_sim_t          sim         = { 0 };
+        fm25_dev_t          dev         = NULL;
+        fm25_status_t       status      = eFM25_OK;
+        fm25_sim_stats_t    sim_stats   = { 0 };
+        fm25_sleep_stats_t  before      = { 0 };
+        fm25_sleep_stats_t  after       = { 0 };
+
+        memset( model, 0, sizeof( model ));
+
+        status = fm25_test_open( &sim, &dev, &g_fm25_sim_if, NULL, true );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+
+        if ( eFM25_OK == status )
+        {
+            uint8_t data[FM25_TEST_SLEEP_SIZE];
+
+            if ( FM25_TEST_ADDR_BIT_NUM < FM25_TEST_SLEEP_ADDR_BIT_MIN )
+            {
+                // Part without SLEEP command
+                fm25_sim_reset_stats( &sim );
+
+                for ( uint32_t i = 0U; i < ( 2U * FM25_TEST_SLEEP_IDLE ); i++ )
+                {
+                    status |= fm25_sleep_process( dev );
+                }
+
+                status |= fm25_get_sleep_stats( dev, &after );
+                fm25_sim_get_stats( &sim, &sim_stats );
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK(( 0U == sim_stats.cs_assert ) && ( 0U == after.sleep ) && ( false == sim.sleep ));
+            }
+            else
+            {
+                // Idle time counts from end of last access, latency timestamp follows it
+                const uint32_t idle_start = ( g_sleep_tick - FM25_CFG_STATS_EN );
+
+                FM25_TEST_CHECK( true == fm25_test_sleep_enter( dev, &sim ));
+                FM25_TEST_CHECK(( g_sleep_tick - idle_start ) == FM25_TEST_SLEEP_IDLE );
+
+                // Write and read of sleeping device wait for tREC
+                for ( uint32_t is_write = 0U; is_write < 2U; is_write++ )
+                {
+                    FM25_TEST_CHECK( true == fm25_test_sleep_enter( dev, &sim ));
+
+                    const uint32_t start = g_sleep_tick;
+
+                    status = fm25_get_sleep_stats( dev, &before );
+                    fm25_sim_reset_stats( &sim );
+
+                    if ( 1U == is_write )
+                    {
+                        for ( uint32_t i = 0U; i < FM25_TEST_SLEEP_SIZE; i++ )
+                        {
+                            data[i] = (uint8_t)( 0x30U + i );
+                        }
+
+                        status |= fm25_write( dev, FM25_TEST_SLEEP_ADDR, FM25_TEST_SLEEP_SIZE, data );
+
+                        memcpy( &model[FM25_TEST_SLEEP_ADDR], data, FM25_TEST_SLEEP_SIZE );
+                    }
+                    else
+                    {
+                        status |= fm25_read( dev, FM25_TEST_SLEEP_ADDR, FM25_TEST_SLEEP_SIZE, data );
+                    }
+
+                    status |= fm25_get_sleep_stats( dev, &after );
+                    fm25_sim_get_stats( &sim, &sim_stats );
+
+                    FM25_TEST_CHECK( eFM25_OK == status );
+                    FM25_TEST_CHECK(( false == sim.sleep ) && ( 0U == sim_stats.violations ));
+                    FM25_TEST_CHECK(( g_sleep_tick - start ) > FM25_TEST_SLEEP_WAKE_TIME );
+                    FM25_TEST_CHECK((( before.wake + 1U ) == after.wake ) && ( before.wake_hidden == after.wake_hidden ));
+                    FM25_TEST_CHECK(( after.wake_wait - before.wake_wait ) >= FM25_TEST_SLEEP_WAKE_TIME );
+                    FM25_TEST_CHECK( 0 == memcmp( data, &model[FM25_TEST_SLEEP_ADDR], FM25_TEST_SLEEP_SIZE ));
+                    FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, FM25_TEST_MEM_SIZE ));
+                }
+
+                // Wake-up started tREC ahead hides it, started half of tREC ahead waits for other half
+                for ( uint32_t ahead = FM25_TEST_SLEEP_WAKE_TIME + 1U; ahead > 0U; ahead /= 2U )
+                {
+                    FM25_TEST_CHECK( true == fm25_test_sleep_enter( dev, &sim ));
+
+                    status = fm25_get_sleep_stats( dev, &before );
+                    status |= fm25_wake( dev );
+
+                    FM25_TEST_CHECK( false == sim.sleep );
+
+                    for ( uint32_t i = 0U; i < ahead; i++ )
+                    {
+                        (void) fm25_test_sleep_tick();
+                    }
+
+                    fm25_sim_reset_stats( &sim );
+
+                    status |= fm25_read( dev, FM25_TEST_SLEEP_ADDR, FM25_TEST_SLEEP_SIZE, data );
+                    status |= fm25_get_sleep_stats( dev, &after );
+                    fm25_sim_get_stats( &sim, &sim_stats );
+
+                    const uint32_t wait = ( after.wake_wait - before.wake_wait );
+
+                    FM25_TEST_CHECK( eFM25_OK == status );
+                    FM25_TEST_CHECK( 0U == sim_stats.violations );
+                    FM25_TEST_CHECK(( before.wake + 1U ) == after.wake );
+                    FM25_TEST_CHECK( 0 == memcmp( data, &model[FM25_TEST_SLEEP_ADDR], FM25_TEST_SLEEP_SIZE ));
+
+                    if ( ahead > FM25_TEST_SLEEP_WAKE_TIME )
+                    {
+                        FM25_TEST_CHECK((( before.wake_hidden + 1U ) == after.wake_hidden ) && ( 0U == wait ));
+                    }
+                    else
+                    {
+                        FM25_TEST_CHECK(( before.wake_hidden == after.wake_hidden ) && ( wait > 0U ) && ( wait <= ( FM25_TEST_SLEEP_WAKE_TIME + 2U - ahead )));
+                    }
+                }
+
+                // Wake-up started ahead without access is not put back to sleep before tREC
+                FM25_TEST_CHECK( true == fm25_test_sleep_enter( dev, &sim ));
+                FM25_TEST_CHECK( eFM25_OK == fm25_wake( dev ));
+
+                fm25_sim_reset_stats( &sim );
+
+                for ( uint32_t i = 0U; i < FM25_TEST_SLEEP_WAKE_TIME; i++ )
+                {
+                    status |= fm25_sleep_process( dev );
+                }
+
+                FM25_TEST_CHECK(( eFM25_OK == status ) && ( false == sim.sleep ));
+                FM25_TEST_CHECK( true == fm25_test_sleep_enter( dev, &sim ));
+
+                fm25_sim_get_stats( &sim, &sim_stats );
+
+                FM25_TEST_CHECK( 0U == sim_stats.violations );
+
+                // Queue wakes device for new requests only
+                fm25_queue_t queue;
+
+                status = fm25_get_sleep_stats( dev, &before );
+                status |= fm25_test_queue_init( &queue, dev, false, false );
+                status |= fm25_queue_process( &queue );
+
+                FM25_TEST_CHECK(( eFM25_OK == status ) && ( true == sim.sleep ));
+
+                status |= fm25_test_queue_submit( &queue, 0U, true, 0U, FM25_TEST_SLEEP_ADDR, FM25_TEST_SLEEP_SIZE, model );
+                status |= fm25_test_queue_submit( &queue, 1U, false, 0U, FM25_TEST_SLEEP_ADDR, FM25_TEST_SLEEP_SIZE, model );
+                status |= fm25_queue_process( &queue );
+                status |= fm25_get_sleep_stats( dev, &after );
+                fm25_sim_get_stats( &sim, &sim_stats );
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+                FM25_TEST_CHECK( true == fm25_test_queue_is_done( 2U ));
+                FM25_TEST_CHECK(( false == sim.sleep ) && ( 0U == sim_stats.violations ));
+                FM25_TEST_CHECK((( before.wake + 1U ) == after.wake ) && ( after.wake_wait > before.wake_wait ));
+                FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, FM25_TEST_MEM_SIZE ));
+            }
+
+            (void) fm25_close( dev );
+        }
+
+        (void) fm25_sim_close( &sim );
+    }
+
+#endif
+
+#if ( 1 == FM25_CFG_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Wait for completion counter
+    *
+    * @param[in]    p_cnt   - Pointer to counter updated from other thread
+    * @param[in]    num     - Expected count
+    * @return       is_done - True if count was reached before timeout
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool fm25_test_wait(const uint32_t * const p_cnt, const uint32_t num)
+    {
+        struct timespec t_start;
+        struct timespec t_now;
+        bool            is_done     = false;
+        bool            is_timeout  = false;
+
+        clock_gettime( CLOCK_MONOTONIC, &t_start );
+
+        while   (   ( false == is_done )
+                &&  ( false == is_timeout ))
+        {
+            is_done = ( num == __atomic_load_n( p_cnt, __ATOMIC_ACQUIRE ));
+
+            clock_gettime( CLOCK_MONOTONIC, &t_now );
+
+            is_timeout = (((( t_now.tv_sec - t_start.tv_sec ) * 1000L ) + (( t_now.tv_nsec - t_start.tv_nsec ) / 1000000L )) > (long) FM25_TEST_TIMEOUT_MS );
+
+            (void) sched_yield();
+        }
+
+        return is_done;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Completion of asynchronous test request
+    *
+    * @note     Called from DMA worker thread. First completion holds
+    *           worker until all requests are queued, thus each synchronous
+    *           write issued here except from last one finds chain pending
+    *           and shall be rejected.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    status  - Status of request
+    * @param[in]    p_arg   - Pointer to test request
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_async_cb(fm25_dev_t dev, const fm25_status_t status, void * const p_arg)
+    {
+        fm25_test_async_req_t * const   p_req   = (fm25_test_async_req_t*) p_arg;
+        const uint8_t                   data    = 0xA5U;
+
+        p_req->status   = status;
+        p_req->order    = __atomic_load_n( &g_async_done, __ATOMIC_ACQUIRE );
+        p_req->is_done  = true;
+
+        if ( p_req == &g_async_req[0] )
+        {
+            (void) fm25_test_wait( &g_async_queued, FM25_TEST_ASYNC_REQ_NUM );
+        }
+
+        if ( p_req != &g_async_req[FM25_TEST_ASYNC_REQ_NUM - 1U] )
+        {
+            p_req->sync_status = fm25_write( dev, 0U, 1U, &data );
+        }
+
+        __atomic_add_fetch( &g_async_done, 1U, __ATOMIC_RELEASE );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Chained asynchronous requests on simulated DMA engine
+    *
+    * @note     Mixed writes and reads, some overlapping, are queued at once.
+    *           Reads expect model content at their queue position, which
+    *           holds only if requests are chained in submission order.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_async(void)
+    {
+        static const struct
+        {
+            bool        is_write;
+            uint32_t    addr;
+            uint32_t    size;
+        } op[FM25_TEST_ASYNC_REQ_NUM] =
+        {
+            { true,     0x010U, 1U      },
+            { true,     0x100U, 200U    },
+            { false,    0x100U, 200U    },
+            { true,     0x180U, 64U     },      // Overlaps previous write
+            { false,    0x0F0U, 256U    },
+            { true,     ( FM25_TEST_MEM_SIZE - 0x80U ),     128U    },  // End of memory array
+            { false,    0x010U, 1U      },
+            { true,     0x011U, 3U      },
+            { false,    ( FM25_TEST_MEM_SIZE - 0x100U ),    256U    },
+            { true,     ( FM25_TEST_MEM_SIZE / 2U ),            256U    },
+            { true,     (( FM25_TEST_MEM_SIZE / 2U ) + 0x80U ), 16U     },
+            { false,    ( FM25_TEST_MEM_SIZE / 2U ),            256U    },
+        };
+
+        static uint8_t  model[1UL << FM25_TEST_ADDR_BIT_NUM];
+        fm25_sim_t      sim         = { 0 };
+        fm25_sim_dma_t  dma         = { 0 };
+        fm25_dev_t      dev         = NULL;
+        fm25_status_t   status      = eFM25_OK;
+        bool            is_busy     = true;
+
+        memset( model, 0, sizeof( model ));
+        memset( g_async_req, 0, sizeof( g_async_req ));
+        g_async_queued  = 0U;
+        g_async_done    = 0U;
+
+        status = fm25_sim_dma_open( &dma, &sim );
+        status |= fm25_test_open( &sim, &dev, &g_fm25_sim_dma_if, &dma, false );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+
+        if ( eFM25_OK == status )
+        {
+            // Prepare requests and expected read data from model
+            for ( uint32_t i = 0U; i < FM25_TEST_ASYNC_REQ_NUM; i++ )
+            {
+                fm25_test_async_req_t * const p_req = &g_async_req[i];
+
+                p_req->is_write = op[i].is_write;
+                p_req->addr     = op[i].addr;
+                p_req->size     = op[i].size;
+
+                if ( true == p_req->is_write )
+                {
+                    for ( uint32_t j = 0U; j < p_req->size; j++ )
+                    {
+                        p_req->data[j] = (uint8_t)(( i * 37U ) + j + 1U );
+                    }
+
+                    memcpy( &model[p_req->addr], p_req->data, p_req->size );
+                }
+                else
+                {
+                    memcpy( p_req->expect, &model[p_req->addr], p_req->size );
+                }
+            }
+
+            // Queue all at once
+            for ( uint32_t i = 0U; ( i < FM25_TEST_ASYNC_REQ_NUM ) && ( eFM25_OK == status ); i++ )
+            {
+                fm25_test_async_req_t * const p_req = &g_async_req[i];
+
+                if ( true == p_req->is_write )
+                {
+                    status = fm25_write_async( dev, &p_req->req, p_req->addr, p_req->size, p_req->data, fm25_test_async_cb, p_req );
+                }
+                else
+                {
+                    status = fm25_read_async( dev, &p_req->req, p_req->addr, p_req->size, p_req->data, fm25_test_async_cb, p_req );
+                }
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+
+                __atomic_add_fetch( &g_async_queued, 1U, __ATOMIC_RELEASE );
+            }
+
+            FM25_TEST_CHECK( true == fm25_test_wait( &g_async_done, FM25_TEST_ASYNC_REQ_NUM ));
+            FM25_TEST_CHECK(( eFM25_OK == fm25_is_busy( dev, &is_busy )) && ( false == is_busy ));
+
+            for ( uint32_t i = 0U; i < FM25_TEST_ASYNC_REQ_NUM; i++ )
+            {
+                const fm25_test_async_req_t * const p_req = &g_async_req[i];
+
+                FM25_TEST_CHECK( true == p_req->is_done );
+                FM25_TEST_CHECK( eFM25_OK == p_req->status );
+                FM25_TEST_CHECK( i == p_req->order );
+
+                // Sync API is rejected while chain is pending
+                if ( i < ( FM25_TEST_ASYNC_REQ_NUM - 1U ))
+                {
+                    FM25_TEST_CHECK( eFM25_ERROR_BUSY == p_req->sync_status );
+                }
+
+                if ( false == p_req->is_write )
+                {
+                    FM25_TEST_CHECK( 0 == memcmp( p_req->data, p_req->expect, p_req->size ));
+                }
+            }
+
+            FM25_TEST_CHECK( 0 == memcmp( fm25_sim_get_mem( &sim ), model, sizeof( model )));
+
+            // Invalid request is rejected without callback
+            FM25_TEST_CHECK( eFM25_ERROR == fm25_write_async( dev, &g_async_req[0].req, ( FM25_TEST_MEM_SIZE - 1U ), 2U, g_async_req[0].data, fm25_test_async_cb, &g_async_req[0] ));
+            FM25_TEST_CHECK( FM25_TEST_ASYNC_REQ_NUM == g_async_done );
+
+            // Sync API works again once idle
+            FM25_TEST_CHECK( eFM25_OK == fm25_write( dev, 0x020U, 4U, g_async_req[1].data ));
+
+            (void) fm25_close( dev );
+        }
+
+        (void) fm25_sim_dma_close( &dma );
+        (void) fm25_sim_close( &sim );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Take bus lock
+    *
+    * @param[in]    p_ctx   - Interface context
+    * @return       status  - "eFM25_ERROR_BUSY" when lock fails on purpose
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_test_lock(void * const p_ctx)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        (void) p_ctx;
+
+        if ( true == __atomic_load_n( &g_lock_fail, __ATOMIC_ACQUIRE ))
+        {
+            status = eFM25_ERROR_BUSY;
+        }
+        else
+        {
+            __atomic_store_n( &g_lock_held, true, __ATOMIC_RELEASE );
+            __atomic_add_fetch( &g_lock_num, 1U, __ATOMIC_RELEASE );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Release bus lock from task
+    *
+    * @param[in]    p_ctx   - Interface context
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_unlock(void * const p_ctx)
+    {
+        (void) p_ctx;
+
+        __atomic_store_n( &g_lock_held, false, __ATOMIC_RELEASE );
+        __atomic_add_fetch( &g_unlock_num, 1U, __ATOMIC_RELEASE );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Release bus lock from completion interrupt
+    *
+    * @param[in]    p_ctx   - Interface context
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_unlock_isr(void * const p_ctx)
+    {
+        (void) p_ctx;
+
+        __atomic_store_n( &g_lock_held, false, __ATOMIC_RELEASE );
+        __atomic_add_fetch( &g_unlock_isr_num, 1U, __ATOMIC_RELEASE );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Start transmit on simulated DMA and count transfers without lock
+    *
+    * @param[in]    p_ctx       - Simulated DMA engine
+    * @param[in]    p_data      - Pointer to transmit data
+    * @param[in]    size        - Size of transfer
+    * @param[in]    cs_action   - Chip select action
+    * @param[in]    pf_done     - Completion function
+    * @param[in]    p_arg       - Completion argument
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_test_tx_start(void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg)
+    {
+        if ( false == __atomic_load_n( &g_lock_held, __ATOMIC_ACQUIRE ))
+        {
+            __atomic_add_fetch( &g_lock_miss_num, 1U, __ATOMIC_RELEASE );
+        }
+
+        return g_fm25_sim_dma_if.pf_transmit_start( p_ctx, p_data, size, cs_action, pf_done, p_arg );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Start receive on simulated DMA and count transfers without lock
+    *
+    * @param[in]    p_ctx       - Simulated DMA engine
+    * @param[out]   p_data      - Pointer to receive data
+    * @param[in]    size        - Size of transfer
+    * @param[in]    cs_action   - Chip select action
+    * @param[in]    pf_done     - Completion function
+    * @param[in]    p_arg       - Completion argument
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_test_rx_start(void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg)
+    {
+        if ( false == __atomic_load_n( &g_lock_held, __ATOMIC_ACQUIRE ))
+        {
+            __atomic_add_fetch( &g_lock_miss_num, 1U, __ATOMIC_RELEASE );
+        }
+
+        return g_fm25_sim_dma_if.pf_receive_start( p_ctx, p_data, size, cs_action, pf_done, p_arg );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Completion of lock test request
+    *
+    * @note     First completion holds worker until all requests are queued,
+    *           thus they form single chain. Last request of chain submits
+    *           follow-up request, which shall join chain that still holds
+    *           the lock.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    status  - Status of request
+    * @param[in]    p_arg   - Pointer to test request
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_lock_cb(fm25_dev_t dev, const fm25_status_t status, void * const p_arg)
+    {
+        fm25_test_async_req_t * const p_req = (fm25_test_async_req_t*) p_arg;
+
+        p_req->status   = status;
+        p_req->is_done  = true;
+
+        if ( p_req == &g_async_req[0] )
+        {
+            (void) fm25_test_wait( &g_async_queued, 4U );
+        }
+
+        if ( p_req == &g_async_req[3] )
+        {
+            p_req->sync_status = fm25_read_async( dev, &g_lock_next, 0x000U, 16U, g_async_req[4].data, fm25_test_lock_cb, &g_async_req[4] );
+        }
+
+        __atomic_add_fetch( &g_async_done, 1U, __ATOMIC_RELEASE );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Bus lock of asynchronous request chain
+    *
+    * @note     Chain shall take lock once in submitter context, start all
+    *           transfers under it and release it from completion context.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_test_async_lock(void)
+    {
+        fm25_sim_t      sim         = { 0 };
+        fm25_sim_dma_t  dma         = { 0 };
+        fm25_if_t       lock_if     = g_fm25_sim_dma_if;
+        fm25_dev_t      dev         = NULL;
+        fm25_status_t   status      = eFM25_OK;
+        bool            is_busy     = true;
+
+        memset( g_async_req, 0, sizeof( g_async_req ));
+        g_async_queued      = 0U;
+        g_async_done        = 0U;
+        g_lock_held         = false;
+        g_lock_fail         = false;
+        g_lock_num          = 0U;
+        g_unlock_num        = 0U;
+        g_unlock_isr_num    = 0U;
+        g_lock_miss_num     = 0U;
+
+        lock_if.pf_transmit_start   = fm25_test_tx_start;
+        lock_if.pf_receive_start    = fm25_test_rx_start;
+        lock_if.pf_lock             = fm25_test_lock;
+        lock_if.pf_unlock           = fm25_test_unlock;
+        lock_if.pf_unlock_isr       = NULL;
+
+        status = fm25_sim_dma_open( &dma, &sim );
+        status |= fm25_test_open( &sim, &dev, &lock_if, &dma, false );
+
+        FM25_TEST_CHECK( eFM25_OK == status );
+
+        if ( eFM25_OK == status )
+        {
+            FM25_TEST_CHECK( 0U == g_lock_miss_num );
+
+            // Lock that can not be released from interrupt
+            FM25_TEST_CHECK( eFM25_ERROR == fm25_write_async( dev, &g_async_req[0].req, 0x000U, 16U, g_async_req[0].data, fm25_test_lock_cb, &g_async_req[0] ));
+
+            lock_if.pf_unlock_isr = fm25_test_unlock_isr;
+
+            g_lock_num      = 0U;
+            g_unlock_num    = 0U;
+
+            // Chain of four requests, last one submits fifth from its callback
+            for ( uint32_t i = 0U; i < 4U; i++ )
+            {
+                memset( g_async_req[i].data, (int) ( i + 1U ), 16U );
+
+                if ( 0U == ( i % 2U ))
+                {
+                    status = fm25_write_async( dev, &g_async_req[i].req, ( 16U * i ), 16U, g_async_req[i].data, fm25_test_lock_cb, &g_async_req[i] );
+                }
+                else
+                {
+                    status = fm25_read_async( dev, &g_async_req[i].req, ( 16U * i ), 16U, g_async_req[i].data, fm25_test_lock_cb, &g_async_req[i] );
+                }
+
+                FM25_TEST_CHECK( eFM25_OK == status );
+
+                __atomic_add_fetch( &g_async_queued, 1U, __ATOMIC_RELEASE );
+            }
+
+            FM25_TEST_CHECK( true == fm25_test_wait( &g_async_done, 5U ));
+            FM25_TEST_CHECK( true == fm25_test_wait( &g_unlock_isr_num, 1U ));
+            FM25_TEST_CHECK(( eFM25_OK == fm25_is_busy( dev, &is_busy )) && ( false == is_busy ));
+
+            for ( uint32_t i = 0U; i < 5U; i++ )
+            {
+                FM25_TEST_CHECK(( true == g_async_req[i].is_done ) && ( eFM25_OK == g_async_req[i].status ));
+            }
+
+            FM25_TEST_CHECK( eFM25_OK == g_async_req[3].sync_status );
+            FM25_TEST_CHECK( 0 == memcmp( g_async_req[4].data, g_async_req[0].data, 16U ));
+            FM25_TEST_CHECK( 1U == g_lock_num );
+            FM25_TEST_CHECK( 0U == g_unlock_num );
+            FM25_TEST_CHECK( 0U == g_lock_miss_num );
+            FM25_TEST_CHECK( false == g_lock_held );
+
+            // Failed lock rejects request without callback
+            g_lock_fail = true;
+            g_async_req[0].is_done = false;
+
+            FM25_TEST_CHECK( eFM25_ERROR_BUSY == fm25_write_async( dev, &g_async_req[0].req, 0x000U, 16U, g_async_req[0].data, fm25_test_lock_cb, &g_async_req[0] ));
+            FM25_TEST_CHECK( false == g_async_req[0].is_done );
+            FM25_TEST_CHECK(( eFM25_OK == fm25_is_busy( dev, &is_busy )) && ( false == is_busy ));
+
+            g_lock_fail = false;
+
+            // Synchronous call uses task release
+            FM25_TEST_CHECK( eFM25_OK == fm25_write( dev, 0x100U, 16U, g_async_req[0].data ));
+            FM25_TEST_CHECK(( 2U == g_lock_num ) && ( 1U == g_unlock_num ) && ( 1U == g_unlock_isr_num ));
+
+            (void) fm25_close( dev );
+        }
+
+        (void) fm25_sim_dma_close( &dma );
+        (void) fm25_sim_close( &sim );
+    }
+
+#endif // ( 1 == FM25_CFG_ASYNC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 host test API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Run all test groups
+*
+* @param[in]    p_report    - Report output stream, NULL for no report
+* @return       status      - "eFM25_OK" if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_test_run(FILE * const p_report)
+{
+    uint32_t fail_total = 0U;
+
+    gp_report = p_report;
+
+    for ( uint32_t i = 0U; i < ( sizeof( g_test_group ) / sizeof( g_test_group[0] )); i++ )
+    {
+        g_check_num = 0U;
+        g_fail_num  = 0U;
+
+        g_test_group[i].pf_test();
+
+        if ( NULL != p_report )
+        {
+            fprintf( p_report, "%-8s %s (%u checks, %u failed)\n", g_test_group[i].p_name,
+                     (( 0U == g_fail_num ) ? "ok" : "FAIL" ), g_check_num, g_fail_num );
+        }
+
+        fail_total += g_fail_num;
+    }
+
+    return (( 0U == fail_total ) ? eFM25_OK : eFM25_ERROR );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined( FM25_TEST_MAIN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Standalone test executable
+*
+* @return   exit code - 0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    return (( eFM25_OK == fm25_test_run( stdout )) ? EXIT_SUCCESS : EXIT_FAILURE );
+}
+
+#endif
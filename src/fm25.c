@@ -8,7 +8,7 @@
 *@author    Ziga Miklosic
 *@email     ziga.miklosic@gmail.com
 *@date      14.11.2023
-*@version   V1.0.0
+*@version   V2.0.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -25,21 +25,103 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
 
 #include "fm25.h"
 #include "fm25_regdef.h"
-#include "../../fm25_if.h"
 #include "../../fm25_cfg.h"
 
+#if ( 1 == FM25_CFG_VERIFY_EN )
+    #include "fm25_crc.h"
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ *  Number of address bits of device
+ *
+ * @note    Pinned density resolves to compile time constant thus
+ *          addressing specialties are optimized out by compiler.
+ */
+#if ( 0 == FM25_CFG_ADDR_BIT_NUM )
+    #define FM25_ADDR_BIT_NUM(dev)      ((dev)->addr_bit_num )
+#else
+    #define FM25_ADDR_BIT_NUM(dev)      ((void)(dev), (uint8_t) FM25_CFG_ADDR_BIT_NUM )
+#endif
+
+/**
+ *  Read command of device
+ */
+#if ( 1 == FM25_CFG_FSTRD_EN )
+    #define FM25_READ_ISA(dev)          ((dev)->read_isa )
+#else
+    #define FM25_READ_ISA(dev)          ((void)(dev), eFM25_ISA_READ )
+#endif
+
+/**
+ *  RAM shadow of device
+ */
+#if ( 1 == FM25_CFG_SHADOW_EN )
+    #define FM25_SHADOW(dev)            ((dev)->p_shadow )
+#else
+    #define FM25_SHADOW(dev)            ((void)(dev), (uint8_t*) NULL )
+#endif
+
+/**
+ *  Statistics
+ *
+ * @note    Compiled away when statistics are disabled. "FM25_STATS_START()"
+ *          declares start timestamp of operation for "FM25_STATS_OP()".
+ */
+#if ( 1 == FM25_CFG_STATS_EN )
+    #define FM25_STATS_START(dev)                   const uint32_t stats_tick = fm25_stats_tick( dev )
+    #define FM25_STATS_OP(dev, op, size, status)    fm25_stats_op( dev, op, size, status, stats_tick )
+    #define FM25_STATS_ADD(dev, field, num)         (( dev )->stats.field += ( num ))
+#else
+    #define FM25_STATS_START(dev)                   { ; }
+    #define FM25_STATS_OP(dev, op, size, status)    { ; }
+    #define FM25_STATS_ADD(dev, field, num)         { ; }
+#endif
+
+/**
+ *  Wake device from sleep mode before bus access
+ */
+#if ( 1 == FM25_CFG_SLEEP_EN )
+    #define FM25_SLEEP_EXIT(dev)                    fm25_sleep_exit( dev )
+#else
+    #define FM25_SLEEP_EXIT(dev)                    ( eFM25_OK )
+#endif
+
 /**
  *  Highest memory address
  */
-#define FM25_MAX_ADDR                   ((uint32_t) (( 1UL << FM25_CFG_ADDR_BIT_NUM ) - 1UL ))
+#define FM25_MAX_ADDR(dev)              ((uint32_t) (( 1UL << FM25_ADDR_BIT_NUM(dev) ) - 1UL ))
+
+/**
+ *  Size of read/write command frame
+ */
+#define FM25_RW_CMD_SIZE(dev)           (( 9U == FM25_ADDR_BIT_NUM(dev) ) ? 2U : (( FM25_ADDR_BIT_NUM(dev) <= 16U ) ? 3U : 4U ))
+
+/**
+ *  Maximum number of segments of single interface transfer
+ */
+#define FM25_XFER_SEG_MAX               ( 8U )
 
+/**
+ *     Device ID prefix, continuation code and Cypress manufacturer ID
+ */
+#define FM25_ID_CONT_CODE               ((uint8_t)( 0x7FU ))
+#define FM25_ID_CONT_SIZE               ( 6U )
+#define FM25_ID_MANUF                   ((uint8_t)( 0xC2U ))
+
+/**
+ *     Part capabilities
+ */
+#define FM25_PART_FSTRD                 ( 0x01U )
+#define FM25_PART_SLEEP                 ( 0x02U )
 
 /**
  *     Erase value
@@ -54,33 +136,207 @@ typedef union
     struct
     {
         uint8_t cmd;        /**<Command part of frame */
-        uint8_t addr[3];    /**<Address part of frame */
+        uint8_t addr[4];    /**<Address part of frame, followed by FSTRD dummy byte */
     } field;
-    uint32_t u;             /**<Unsigned access */
+    uint64_t u;             /**<Unsigned access */
 } fm25_rw_cmd_t;
 
+/**
+ *     Part of device table
+ */
+typedef struct
+{
+    const char *    p_name;         /**<Part name */
+    uint8_t         prod_id;        /**<Family/density byte of device ID, 0 for parts without RDID */
+    uint8_t         addr_bit_num;   /**<Number of address bits */
+    uint8_t         caps;           /**<Part capabilities */
+} fm25_part_t;
+
+/**
+ *     Interface transfer under construction
+ *
+ * @note    Segments are collected and passed to segmented transfer of
+ *          interface as single call. Without segmented transfer each
+ *          segment is transferred immediately.
+ */
+typedef struct
+{
+    fm25_if_seg_t   seg[FM25_XFER_SEG_MAX];     /**<Collected segments */
+    uint32_t        num;                        /**<Number of collected segments */
+    fm25_rw_cmd_t   cmd;                        /**<Command frame */
+    bool            is_cmd;                     /**<Command frame is referenced by collected segment */
+} fm25_xfer_t;
+
+/**
+ *     Asynchronous transfer states
+ */
+typedef enum
+{
+    eFM25_ASYNC_WREN = 0,   /**<Set write enable latch */
+    eFM25_ASYNC_CMD,        /**<Command and address */
+    eFM25_ASYNC_DATA,       /**<Data payload */
+} fm25_async_state_t;
+
+/**
+ *     Sleep governor states
+ */
+typedef enum
+{
+    eFM25_SLEEP_OFF = 0,    /**<Device in standby */
+    eFM25_SLEEP_ON,         /**<Device in sleep mode */
+    eFM25_SLEEP_WAKE,       /**<Device recovering from sleep mode */
+} fm25_sleep_state_t;
+
+/**
+ *     Device instance
+ */
+struct fm25_dev_s
+{
+    const fm25_if_t *   p_if;           /**<Low level interface */
+    void *              p_if_ctx;       /**<Interface context */
+    fm25_dev_info_t     info;           /**<Identification */
+    uint8_t             addr_bit_num;   /**<Number of address bits */
+    bool                is_init;        /**<Initialization guard */
+
+#if ( 1 == FM25_CFG_STATS_EN ) || ( 1 == FM25_CFG_SLEEP_EN )
+    uint32_t            (*pf_get_tick)(void);   /**<Timestamp source */
+#endif
+
+#if ( 1 == FM25_CFG_STATS_EN )
+    fm25_stats_t        stats;          /**<Statistics */
+#endif
+
+#if ( 1 == FM25_CFG_SLEEP_EN )
+    fm25_sleep_stats_t  sleep_stats;    /**<Sleep governor statistics */
+    uint32_t            sleep_idle;     /**<Idle time before sleep, 0 if governor is disabled */
+    uint32_t            wake_time;      /**<Recovery time from sleep mode */
+    uint32_t            sleep_tick;     /**<Last bus activity, start of sleep or start of wake-up */
+    uint32_t            open_tick;      /**<Timestamp of open */
+    uint8_t             sleep_state;    /**<Sleep governor state */
+#endif
+
+#if ( 1 == FM25_CFG_FSTRD_EN )
+    fm25_isa_t          read_isa;       /**<Read command, READ or FSTRD */
+#endif
+
+#if ( 1 == FM25_CFG_SHADOW_EN )
+    uint8_t *           p_shadow;       /**<RAM shadow of memory array */
+    uint32_t            chk_addr;       /**<Next address of shadow check */
+    uint16_t            chk_crc_dev;    /**<Running CRC of device data */
+    uint16_t            chk_crc_shadow; /**<Running CRC of shadow data */
+#endif
+
+#if ( 1 == FM25_CFG_VERIFY_EN )
+    fm25_verify_t       verify;         /**<Verify-after-write mode */
+    uint32_t            verify_addr;    /**<Address of last verify mismatch */
+#endif
+
+#if ( 1 == FM25_CFG_ASYNC_EN )
+    fm25_async_t *      p_async_head;   /**<Asynchronous request in progress */
+    fm25_async_t *      p_async_tail;   /**<Last queued asynchronous request */
+    fm25_rw_cmd_t       async_cmd;      /**<Command frame of asynchronous transfer */
+    bool                async_is_lock;  /**<Request chain holds bus lock */
+#endif
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- *     Initialization guard
+ *     Device instances
+ */
+static struct fm25_dev_s g_fm25_dev[FM25_CFG_DEV_NUM_MAX] = { 0 };
+
+/**
+ *     Write enable command
+ */
+static const uint8_t gu8_wren = eFM25_ISA_WREN;
+
+/**
+ *     Device table
+ *
+ * @note    Parts without RDID are matched by configured number of
+ *          address bits only.
  */
-static bool gb_is_init = false;
+static const fm25_part_t g_fm25_part[] =
+{
+    // Parts without RDID
+    { .p_name = "FM25L04B/FM25040B",    .prod_id = 0x00U, .addr_bit_num = 9U,   .caps = 0U },
+    { .p_name = "FM25L16B/FM25C160B",   .prod_id = 0x00U, .addr_bit_num = 11U,  .caps = 0U },
+    { .p_name = "FM25CL64B/FM25640B",   .prod_id = 0x00U, .addr_bit_num = 13U,  .caps = 0U },
+    { .p_name = "FM25W256/FM25L256B",   .prod_id = 0x00U, .addr_bit_num = 15U,  .caps = 0U },
+
+    // FM25V family
+    { .p_name = "FM25V01A",             .prod_id = 0x21U, .addr_bit_num = 14U,  .caps = ( FM25_PART_FSTRD | FM25_PART_SLEEP ) },
+    { .p_name = "FM25V02A",             .prod_id = 0x22U, .addr_bit_num = 15U,  .caps = ( FM25_PART_FSTRD | FM25_PART_SLEEP ) },
+    { .p_name = "FM25V05",              .prod_id = 0x23U, .addr_bit_num = 16U,  .caps = ( FM25_PART_FSTRD | FM25_PART_SLEEP ) },
+    { .p_name = "FM25V10",              .prod_id = 0x24U, .addr_bit_num = 17U,  .caps = ( FM25_PART_FSTRD | FM25_PART_SLEEP ) },
+    { .p_name = "FM25V20A",             .prod_id = 0x25U, .addr_bit_num = 18U,  .caps = ( FM25_PART_FSTRD | FM25_PART_SLEEP ) },
+    { .p_name = "CY15B104Q",            .prod_id = 0x26U, .addr_bit_num = 19U,  .caps = ( FM25_PART_FSTRD | FM25_PART_SLEEP ) },
+};
+
+/**
+ *     Number of parts in device table
+ */
+#define FM25_PART_NUM                   ( sizeof( g_fm25_part ) / sizeof( fm25_part_t ))
 
 ////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static fm25_status_t    fm25_write_enable       (void);
-static fm25_status_t    fm25_write_disable      (void);
-static fm25_status_t    fm25_read_status        (fm25_status_reg_t * const p_status_reg);
-static fm25_status_t    fm25_read_command       (const uint32_t addr);
-static fm25_status_t    fm25_write_command      (const uint32_t addr);
-static void             fm25_assemble_rw_cmd    (fm25_rw_cmd_t * const p_frame, const fm25_isa_t rw_cmd, const uint32_t addr);
-static bool             fm25_read_wel_flag      (void);
+static fm25_status_t    fm25_write_enable       (fm25_dev_t dev);
+static fm25_status_t    fm25_write_disable      (fm25_dev_t dev);
+static fm25_status_t    fm25_read_status        (fm25_dev_t dev, fm25_status_reg_t * const p_status_reg);
+static fm25_status_t    fm25_read_id            (fm25_dev_t dev, const uint8_t addr_bit_num);
+static fm25_status_t    fm25_xfer_add           (fm25_dev_t dev, fm25_xfer_t * const p_xfer, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const fm25_cs_action_t cs_action);
+static fm25_status_t    fm25_xfer_flush         (fm25_dev_t dev, fm25_xfer_t * const p_xfer);
+static fm25_status_t    fm25_xfer_cmd           (fm25_dev_t dev, fm25_xfer_t * const p_xfer, const fm25_isa_t rw_cmd, const uint32_t addr);
+static uint32_t         fm25_assemble_rw_cmd    (fm25_dev_t dev, fm25_rw_cmd_t * const p_frame, const fm25_isa_t rw_cmd, const uint32_t addr);
+static bool             fm25_read_wel_flag      (fm25_dev_t dev);
+static bool             fm25_is_valid           (fm25_dev_t dev);
+static bool             fm25_is_valid_range     (fm25_dev_t dev, const uint32_t addr, const uint32_t size);
+static bool             fm25_is_async_busy      (fm25_dev_t dev);
+static bool             fm25_is_valid_iov       (fm25_dev_t dev, const fm25_iov_t * const p_iov, const uint32_t iov_num, uint32_t * const p_size);
+static fm25_status_t    fm25_rw_vector          (fm25_dev_t dev, const fm25_isa_t rw_cmd, const fm25_iov_t * const p_iov, const uint32_t iov_num);
+static fm25_status_t    fm25_fill_stream        (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint32_t pattern, const uint8_t pattern_size, const bool is_seq);
+static fm25_status_t    fm25_fill_op            (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint32_t pattern, const uint8_t pattern_size, const fm25_stats_op_t op);
+static fm25_status_t    fm25_read_stream        (fm25_dev_t dev, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+static bool             fm25_lock               (fm25_dev_t dev);
+static void             fm25_unlock             (fm25_dev_t dev);
+
+#if ( 1 == FM25_CFG_SHADOW_EN )
+    static void         fm25_shadow_fill        (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint32_t pattern, const uint8_t pattern_size, const bool is_seq);
+#endif
+
+#if ( 1 == FM25_CFG_SHADOW_EN )
+    static uint16_t     fm25_crc16              (uint16_t crc, const uint8_t * const p_data, const uint32_t size);
+#endif
+
+#if ( 1 == FM25_CFG_VERIFY_EN )
+    static fm25_status_t    fm25_verify_range   (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, const fm25_verify_t verify);
+    static fm25_status_t    fm25_verify_iov     (fm25_dev_t dev, const fm25_iov_t * const p_iov, const uint32_t iov_num);
+#endif
+
+#if ( 1 == FM25_CFG_SLEEP_EN )
+    static fm25_status_t    fm25_sleep_exit     (fm25_dev_t dev);
+    static fm25_status_t    fm25_wake_start     (fm25_dev_t dev);
+#endif
+
+#if ( 1 == FM25_CFG_STATS_EN )
+    static uint32_t         fm25_stats_tick     (fm25_dev_t dev);
+    static void             fm25_stats_op       (fm25_dev_t dev, const fm25_stats_op_t op, const uint32_t size, const fm25_status_t status, const uint32_t tick);
+#endif
+
+#if ( 1 == FM25_CFG_ASYNC_EN )
+    static fm25_status_t    fm25_async_submit   (fm25_dev_t dev, fm25_async_t * const p_req);
+    static void             fm25_async_step     (fm25_dev_t dev);
+    static void             fm25_async_done     (void * const p_arg, const fm25_status_t status);
+    static void             fm25_async_complete (fm25_dev_t dev, const fm25_status_t status);
+    static void             fm25_async_abort    (fm25_dev_t dev, const fm25_async_t * const p_req);
+#endif
 
 // NOTE: Unused function for now. Leave for as it might be useful in future!
-//static fm25_status_t  fm25_write_status       (const fm25_status_reg_t * const p_status_reg);
+//static fm25_status_t  fm25_write_status       (fm25_dev_t dev, const fm25_status_reg_t * const p_status_reg);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -90,15 +346,20 @@ static bool             fm25_read_wel_flag      (void);
 /**
 *        Enable write latch
 *
-* @return   status - Status of operation
+* @param[in]    dev     - Device handle
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static fm25_status_t fm25_write_enable(void)
+static fm25_status_t fm25_write_enable(fm25_dev_t dev)
 {
             fm25_status_t   status  = eFM25_OK;
-    const   fm25_isa_t      cmd     = eFM25_ISA_WREN;
+    const   uint8_t         cmd     = eFM25_ISA_WREN;
 
-    status = fm25_if_transmit( &cmd, 1U, ( eSPI_CS_HIGH_ON_EXIT | eSPI_CS_LOW_ON_ENTRY ));
+    status = FM25_SLEEP_EXIT( dev );
+    status |= dev->p_if->pf_transmit( dev->p_if_ctx, &cmd, 1U, ( eFM25_CS_HIGH_ON_EXIT | eFM25_CS_LOW_ON_ENTRY ));
+
+    FM25_STATS_ADD( dev, frame_bytes, 1U );
+    FM25_STATS_ADD( dev, cs, 1U );
 
     return status;
 }
@@ -107,15 +368,20 @@ static fm25_status_t fm25_write_enable(void)
 /**
 *        Disable write latch
 *
-* @return   status - Status of operation
+* @param[in]    dev     - Device handle
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static fm25_status_t fm25_write_disable(void)
+static fm25_status_t fm25_write_disable(fm25_dev_t dev)
 {
             fm25_status_t   status  = eFM25_OK;
-    const   fm25_isa_t      cmd     = eFM25_ISA_WRDI;
+    const   uint8_t         cmd     = eFM25_ISA_WRDI;
 
-    status = fm25_if_transmit( &cmd, 1U, ( eSPI_CS_HIGH_ON_EXIT | eSPI_CS_LOW_ON_ENTRY ));
+    status = FM25_SLEEP_EXIT( dev );
+    status |= dev->p_if->pf_transmit( dev->p_if_ctx, &cmd, 1U, ( eFM25_CS_HIGH_ON_EXIT | eFM25_CS_LOW_ON_ENTRY ));
+
+    FM25_STATS_ADD( dev, frame_bytes, 1U );
+    FM25_STATS_ADD( dev, cs, 1U );
 
     return status;
 }
@@ -124,17 +390,96 @@ static fm25_status_t fm25_write_disable(void)
 /**
 *        Read status register from device
 *
+* @param[in]    dev             - Device handle
 * @param[out]   p_status_reg    - Pointer to status register
 * @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static fm25_status_t fm25_read_status(fm25_status_reg_t * const p_status_reg)
+static fm25_status_t fm25_read_status(fm25_dev_t dev, fm25_status_reg_t * const p_status_reg)
 {
             fm25_status_t   status  = eFM25_OK;
-    const   fm25_isa_t      cmd     = eFM25_ISA_RDSR;
+    const   uint8_t         cmd     = eFM25_ISA_RDSR;
+
+    FM25_STATS_START( dev );
+
+    status = FM25_SLEEP_EXIT( dev );
+    status |= dev->p_if->pf_transmit( dev->p_if_ctx, &cmd, 1U, eFM25_CS_LOW_ON_ENTRY );
+    status |= dev->p_if->pf_receive( dev->p_if_ctx, (uint8_t*) p_status_reg, 1U, eFM25_CS_HIGH_ON_EXIT );
+
+    FM25_STATS_OP( dev, eFM25_STATS_STATUS, 0U, status );
+    FM25_STATS_ADD( dev, frame_bytes, 2U );
+    FM25_STATS_ADD( dev, cs, 1U );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read device ID and serial number and identify part
+*
+* @note     Device ID is valid when it starts with continuation code and
+*           Cypress manufacturer ID. Family/density byte of valid ID is
+*           looked up in device table. Without valid ID part is looked up
+*           by configured number of address bits among parts without RDID.
+*
+*           Serial number is read only from parts with valid ID. Parts
+*           without SNR command leave data line idle, thus serial number
+*           of equal bytes is treated as invalid.
+*
+* @param[in]    dev             - Device handle
+* @param[in]    addr_bit_num    - Configured number of address bits, 0 for unknown
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_read_id(fm25_dev_t dev, const uint8_t addr_bit_num)
+{
+            fm25_status_t       status  = eFM25_OK;
+            fm25_dev_info_t *   p_info  = &dev->info;
+    const   uint8_t             cmd_id  = eFM25_ISA_RDID;
+    const   uint8_t             cmd_sn  = eFM25_ISA_SNR;
+
+    *p_info = (fm25_dev_info_t) { .p_name = NULL, .addr_bit_num = addr_bit_num };
+
+    status = dev->p_if->pf_transmit( dev->p_if_ctx, &cmd_id, 1U, eFM25_CS_LOW_ON_ENTRY );
+    status |= dev->p_if->pf_receive( dev->p_if_ctx, p_info->id, FM25_ID_SIZE, eFM25_CS_HIGH_ON_EXIT );
+
+    if ( eFM25_OK == status )
+    {
+        p_info->is_id = ( FM25_ID_MANUF == p_info->id[FM25_ID_CONT_SIZE] );
+
+        for ( uint32_t i = 0U; i < FM25_ID_CONT_SIZE; i++ )
+        {
+            p_info->is_id &= ( FM25_ID_CONT_CODE == p_info->id[i] );
+        }
+
+        for ( uint32_t i = 0U; i < FM25_PART_NUM; i++ )
+        {
+            const bool is_match = ( true == p_info->is_id )
+                                ? ( g_fm25_part[i].prod_id == p_info->id[FM25_ID_CONT_SIZE + 1U] )
+                                : (( 0U == g_fm25_part[i].prod_id ) && ( g_fm25_part[i].addr_bit_num == addr_bit_num ));
+
+            if ( true == is_match )
+            {
+                p_info->p_name          = g_fm25_part[i].p_name;
+                p_info->addr_bit_num    = g_fm25_part[i].addr_bit_num;
+                p_info->fstrd_en        = ( 0U != ( g_fm25_part[i].caps & FM25_PART_FSTRD ));
+                p_info->sleep_en        = ( 0U != ( g_fm25_part[i].caps & FM25_PART_SLEEP ));
+                break;
+            }
+        }
+    }
+
+    if  (   ( eFM25_OK == status )
+        &&  ( true == p_info->is_id ))
+    {
+        status = dev->p_if->pf_transmit( dev->p_if_ctx, &cmd_sn, 1U, eFM25_CS_LOW_ON_ENTRY );
+        status |= dev->p_if->pf_receive( dev->p_if_ctx, p_info->sn, FM25_SN_SIZE, eFM25_CS_HIGH_ON_EXIT );
 
-    status = fm25_if_transmit( &cmd, 1U, eSPI_CS_LOW_ON_ENTRY );
-    status |= fm25_if_receive((uint8_t*) p_status_reg, 1, eSPI_CS_HIGH_ON_EXIT );
+        for ( uint32_t i = 1U; i < FM25_SN_SIZE; i++ )
+        {
+            p_info->is_sn |= ( p_info->sn[i] != p_info->sn[0] );
+        }
+    }
 
     return status;
 }
@@ -149,15 +494,19 @@ static fm25_status_t fm25_read_status(fm25_status_reg_t * const p_status_reg)
 *           Look at the AN304 Document No. 001-87196 Rev. *E  p.7
 *           figure 9. Addressing Differences Between Densities
 *
+*           FSTRD command is followed by single dummy byte.
 *
+* @param[in]    dev     - Device handle
 * @param[out]   p_frame - Pointer to cmd frame
 * @param[in]    rw_cmd  - Device command for read or write
 * @param[in]    addr    - Start address of read or write
-* @return       void
+* @return       size    - Size of assembled frame in bytes
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void fm25_assemble_rw_cmd(fm25_rw_cmd_t * const p_frame, const fm25_isa_t rw_cmd, const uint32_t addr)
+static uint32_t fm25_assemble_rw_cmd(fm25_dev_t dev, fm25_rw_cmd_t * const p_frame, const fm25_isa_t rw_cmd, const uint32_t addr)
 {
+    uint32_t size = 0U;
+
     FM25_ASSERT( NULL != p_frame );
 
     p_frame->u          = 0UL;
@@ -165,124 +514,171 @@ static void fm25_assemble_rw_cmd(fm25_rw_cmd_t * const p_frame, const fm25_isa_t
 
     // 4kbit devices
     // 9-bit addressing
-    #if ( 9 == FM25_CFG_ADDR_BIT_NUM )
+    if ( 9U == FM25_ADDR_BIT_NUM( dev ))
     {
         // 9 bit address specialty
-        // NOTE: Address bit A8 is encoded into command part of the device
+        // NOTE: Address bit A8 is encoded into bit 3 of command part of the device
         if (( addr & 0x100U ) == 0x100U )
         {
-            p_frame->field.cmd |= ( 0x80U );
+            p_frame->field.cmd |= ( 0x08U );
         }
         else
         {
-            p_frame->field.cmd &= ~( 0x80U );
+            p_frame->field.cmd &= ~( 0x08U );
         }
 
         p_frame->field.addr[0U] = ( addr & 0xFFU );
+
+        size = 2U;
     }
 
     // Devices from 16kbit to 512kbit
     // 10-bit - 16-bit addressing
-    #elif ( FM25_CFG_ADDR_BIT_NUM < 16 )
+    else if ( FM25_ADDR_BIT_NUM( dev ) <= 16U )
     {
         p_frame->field.addr[0]    = (( addr >> 8U ) & 0xFFU );
         p_frame->field.addr[1]    = ( addr          & 0xFFU );
+
+        size = 3U;
     }
 
     // Devices from 1Mbit to 4Mbit
     // 17-bit - 19-bit addressing
-    #else
+    else
     {
         p_frame->field.addr[0]    = (( addr >> 16U )    & 0xFFU );
         p_frame->field.addr[1]    = (( addr >> 8U )     & 0xFFU );
         p_frame->field.addr[2]    = ( addr              & 0xFFU );
+
+        size = 4U;
     }
-    #endif
+
+    // Dummy byte is already cleared
+    if ( eFM25_ISA_FSTRD == rw_cmd )
+    {
+        size++;
+    }
+
+    return size;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*        Send write command to device
+*        Add segment to interface transfer
 *
-* @param[in]    addr    - Start address of write transfer
-* @return       status  - Status of operation
+* @note     Segment is transferred immediately when interface has no
+*           segmented transfer.
+*
+* @param[in]    dev         - Device handle
+* @param[in]    p_xfer      - Pointer to transfer
+* @param[in]    p_tx        - Transmit data, NULL for receive segment
+* @param[out]   p_rx        - Receive data, NULL for transmit segment
+* @param[in]    size        - Size of segment
+* @param[in]    cs_action   - Chip select action
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static fm25_status_t fm25_write_command(const uint32_t addr)
+static fm25_status_t fm25_xfer_add(fm25_dev_t dev, fm25_xfer_t * const p_xfer, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size, const fm25_cs_action_t cs_action)
 {
-    fm25_status_t status    = eFM25_OK;
-    fm25_rw_cmd_t cmd       = { .u = 0U };
-
-    // Enable write enable latch
-    fm25_write_enable();
-
-    // Assemble command
-    fm25_assemble_rw_cmd( &cmd, eFM25_ISA_WRITE, addr );
+    fm25_status_t status = eFM25_OK;
 
-    // 4kbit devices
-    // 9-bit addressing
-    // NOTE: Address bit A8 is encoded into command part of the device
-    #if ( 9 == FM25_CFG_ADDR_BIT_NUM )
+    if ( eFM25_CS_LOW_ON_ENTRY & cs_action )
     {
-        status = fm25_if_transmit((uint8_t*) &cmd.u, 2U, eSPI_CS_LOW_ON_ENTRY );
+        FM25_STATS_ADD( dev, cs, 1U );
     }
 
-    // Devices from 16kbit to 512kbit
-    // 10-bit - 16-bit addressing
-    #elif ( FM25_CFG_ADDR_BIT_NUM < 16 )
+    status = FM25_SLEEP_EXIT( dev );
+
+    if ( NULL == dev->p_if->pf_transfer_seg )
     {
-        status = fm25_if_transmit((uint8_t*) &cmd.u, 3U, eSPI_CS_LOW_ON_ENTRY );
+        if ( NULL != p_tx )
+        {
+            status |= dev->p_if->pf_transmit( dev->p_if_ctx, p_tx, size, cs_action );
+        }
+        else
+        {
+            status |= dev->p_if->pf_receive( dev->p_if_ctx, p_rx, size, cs_action );
+        }
     }
-
-    // Devices from 1Mbit to 4Mbit
-    // 17-bit - 19-bit addressing
-    #else
+    else
     {
-        status = fm25_if_transmit((uint8_t*) &cmd.u, 4U, eSPI_CS_LOW_ON_ENTRY );
+        if ( FM25_XFER_SEG_MAX == p_xfer->num )
+        {
+            status |= fm25_xfer_flush( dev, p_xfer );
+        }
+
+        p_xfer->seg[p_xfer->num] = (fm25_if_seg_t) { .p_tx = p_tx, .p_rx = p_rx, .size = size, .cs_action = cs_action };
+        p_xfer->num++;
     }
-    #endif
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*        Send read command to device
+*        Pass collected segments to interface
 *
-* @param[in]    addr    - Start address of write transfer
+* @param[in]    dev     - Device handle
+* @param[in]    p_xfer  - Pointer to transfer
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static fm25_status_t fm25_read_command(const uint32_t addr)
+static fm25_status_t fm25_xfer_flush(fm25_dev_t dev, fm25_xfer_t * const p_xfer)
 {
     fm25_status_t status = eFM25_OK;
-    fm25_rw_cmd_t cmd    = { .u = 0U };
-
-    // Assemble command
-    fm25_assemble_rw_cmd( &cmd, eFM25_ISA_READ, addr );
 
-    // 4kbit devices
-    // 9-bit addressing
-    // NOTE: Address bit A8 is encoded into command part of the device
-    #if ( 9 == FM25_CFG_ADDR_BIT_NUM )
+    if ( p_xfer->num > 0U )
     {
-        status = fm25_if_transmit((uint8_t*) &cmd.u, 2U, eSPI_CS_LOW_ON_ENTRY );
+        status = dev->p_if->pf_transfer_seg( dev->p_if_ctx, p_xfer->seg, p_xfer->num );
     }
 
-    // Devices from 16kbit to 512kbit
-    // 10-bit - 16-bit addressing
-    #elif ( FM25_CFG_ADDR_BIT_NUM < 16 )
+    p_xfer->num     = 0U;
+    p_xfer->is_cmd  = false;
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Add read or write command to interface transfer
+*
+* @note     Chip select is left asserted for following data payload.
+*           Write enable latch is set before write command, within same
+*           interface transfer.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    p_xfer  - Pointer to transfer
+* @param[in]    rw_cmd  - Device command for read or write
+* @param[in]    addr    - Start address of transfer
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_xfer_cmd(fm25_dev_t dev, fm25_xfer_t * const p_xfer, const fm25_isa_t rw_cmd, const uint32_t addr)
+{
+    fm25_status_t status = eFM25_OK;
+
+    // Command frame storage is still referenced
+    if ( true == p_xfer->is_cmd )
     {
-        status = fm25_if_transmit((uint8_t*) &cmd.u, 3U, eSPI_CS_LOW_ON_ENTRY );
+        status = fm25_xfer_flush( dev, p_xfer );
     }
 
-    // Devices from 1Mbit to 4Mbit
-    // 17-bit - 19-bit addressing
-    #else
+    // Enable write enable latch
+    if ( eFM25_ISA_WRITE == rw_cmd )
     {
-        status = fm25_if_transmit((uint8_t*) &cmd.u, 4U, eSPI_CS_LOW_ON_ENTRY );
+        status |= fm25_xfer_add( dev, p_xfer, &gu8_wren, NULL, 1U, ( eFM25_CS_LOW_ON_ENTRY | eFM25_CS_HIGH_ON_EXIT ));
+
+        FM25_STATS_ADD( dev, frame_bytes, 1U );
     }
-    #endif
+
+    // Assemble command
+    const uint32_t size = fm25_assemble_rw_cmd( dev, &p_xfer->cmd, rw_cmd, addr );
+
+    FM25_STATS_ADD( dev, frame_bytes, size );
+
+    p_xfer->is_cmd = true;
+
+    status |= fm25_xfer_add( dev, p_xfer, (uint8_t*) &p_xfer->cmd.u, NULL, size, eFM25_CS_LOW_ON_ENTRY );
 
     return status;
 }
@@ -291,15 +687,16 @@ static fm25_status_t fm25_read_command(const uint32_t addr)
 /**
 *        Read WEL flag from device
 *
-* @return   wel - State of Write-Enable-Latch
+* @param[in]    dev - Device handle
+* @return       wel - State of Write-Enable-Latch
 */
 ////////////////////////////////////////////////////////////////////////////////
-static bool fm25_read_wel_flag(void)
+static bool fm25_read_wel_flag(fm25_dev_t dev)
 {
     bool                wel      = false;
     fm25_status_reg_t   stat_reg = { .u = 0U };
 
-    if ( eFM25_OK == fm25_read_status( & stat_reg ))
+    if ( eFM25_OK == fm25_read_status( dev, &stat_reg ))
     {
         wel = (bool) ( stat_reg.b.wel );
     }
@@ -307,128 +704,288 @@ static bool fm25_read_wel_flag(void)
     return wel;
 }
 
-// NOTE: Unused function for now. Leave for as it might be useful in future!
-#if 0
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*        Write to device status register
+*        Check device handle
 *
-* @param[in]    p_status_reg    - Pointer to status register
-* @return         status             - Status of operation
+* @param[in]    dev         - Device handle
+* @return       is_valid    - True if handle points to initialized device
 */
 ////////////////////////////////////////////////////////////////////////////////
-static fm25_status_t fm25_write_status(const fm25_status_reg_t * const p_status_reg)
+static bool fm25_is_valid(fm25_dev_t dev)
 {
-            fm25_status_t status = eFM25_OK;
-    const   fm25_isa_t    cmd    = eFM25_ISA_WRSR;
-
-    status = fm25_if_transmit( &cmd, 1, eSPI_CS_LOW_ON_ENTRY );
-    status |= fm25_if_transmit((uint8_t*) p_status_reg, 1U, eSPI_CS_HIGH_ON_EXIT );
-
-    return status;
+    return (( NULL != dev ) && ( true == dev->is_init ));
 }
-#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-* @} <!-- END GROUP -->
+*        Check memory range
+*
+* @param[in]    dev         - Device handle
+* @param[in]    addr        - Start address
+* @param[in]    size        - Size of range in bytes
+* @return       is_valid    - True if range is non-empty and inside memory array
 */
 ////////////////////////////////////////////////////////////////////////////////
+static bool fm25_is_valid_range(fm25_dev_t dev, const uint32_t addr, const uint32_t size)
+{
+    return  (   ( size > 0U )
+            &&  ( addr <= FM25_MAX_ADDR( dev ))
+            &&  (( size - 1U ) <= ( FM25_MAX_ADDR( dev ) - addr )));
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*@addtogroup FM25_API
-* @{ <!-- BEGIN GROUP -->
+*        Check for asynchronous transfer in progress
 *
-*   Following function are part of FM25 API.
+* @note     Invalid handle is never busy, caller reports init error.
+*
+* @param[in]    dev     - Device handle
+* @return       is_busy - True if asynchronous requests are pending
 */
 ////////////////////////////////////////////////////////////////////////////////
+static bool fm25_is_async_busy(fm25_dev_t dev)
+{
+    bool is_busy = false;
+
+    #if ( 1 == FM25_CFG_ASYNC_EN )
+        is_busy =   (   ( true == fm25_is_valid( dev ))
+                    &&  ( NULL != dev->p_async_head ));
+    #else
+        (void) dev;
+    #endif
+
+    return is_busy;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*        Initialize FRAM device
+*        Check vectored transfer segments
 *
-* @return     status - Status of initialization
+* @param[in]    dev         - Device handle
+* @param[in]    p_iov       - Pointer to segments
+* @param[in]    iov_num     - Number of segments
+* @param[out]   p_size      - Total payload size of segments
+* @return       is_valid    - True if all segments are valid
 */
 ////////////////////////////////////////////////////////////////////////////////
-fm25_status_t fm25_init(void)
+static bool fm25_is_valid_iov(fm25_dev_t dev, const fm25_iov_t * const p_iov, const uint32_t iov_num, uint32_t * const p_size)
 {
-    fm25_status_t status = eFM25_OK;
+    bool is_valid = (( NULL != p_iov ) && ( iov_num > 0U ));
+
+    *p_size = 0U;
 
-    if ( false == gb_is_init )
+    for ( uint32_t i = 0U; ( i < iov_num ) && ( true == is_valid ); i++ )
     {
-        // Initialize app interface
-        status = fm25_if_init();
+        is_valid = (    ( NULL != p_iov[i].p_data )
+                    &&  ( true == fm25_is_valid_range( dev, p_iov[i].addr, p_iov[i].size )));
 
-        // Enable write latch
-        status |= fm25_write_enable();
+        *p_size += p_iov[i].size;
+    }
 
-        // Read WEL flag
-        const bool wel_flag = fm25_read_wel_flag();
+    return is_valid;
+}
 
-        if  (   ( eFM25_OK == status )
-            &&  ( true == wel_flag ))
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Transfer segments to/from device
+*
+* @note     Segments are transferred in given order. Segment starting at
+*           the end of previous one is streamed inside same chip select
+*           window, without command frame. Reads additionally bridge gaps
+*           not longer than command frame by clocking out and dropping gap
+*           bytes, which is cheaper than new command frame.
+*
+*           List segments in ascending address order to get longest chains.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    rw_cmd  - Device command for read or write
+* @param[in]    p_iov   - Pointer to segments
+* @param[in]    iov_num - Number of segments
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_rw_vector(fm25_dev_t dev, const fm25_isa_t rw_cmd, const fm25_iov_t * const p_iov, const uint32_t iov_num)
+{
+    fm25_status_t   status      = eFM25_OK;
+    bool            is_chained  = false;
+    uint8_t         gap[4U]     = { 0U };
+    fm25_xfer_t     xfer        = { .num = 0U };
+
+    for ( uint32_t i = 0U; i < iov_num; i++ )
+    {
+        const uint32_t  end     = ( p_iov[i].addr + p_iov[i].size );
+        uint32_t        gap_num = 0U;
+        bool            is_next = false;
+
+        // Next segment continues inside same chip select window
+        if (( i + 1U ) < iov_num )
         {
-            gb_is_init = true;
+            gap_num = ( p_iov[i+1U].addr - end );
+            is_next =   (   ( p_iov[i+1U].addr == end )
+                        ||  (   ( eFM25_ISA_WRITE != rw_cmd )
+                            &&  ( p_iov[i+1U].addr > end )
+                            &&  ( gap_num <= FM25_RW_CMD_SIZE( dev ))));
+        }
 
-            FM25_DBG_PRINT("FM25: Init success!");
+        // Start new chain
+        if ( false == is_chained )
+        {
+            status |= fm25_xfer_cmd( dev, &xfer, rw_cmd, p_iov[i].addr );
+        }
+
+        const fm25_cs_action_t cs_action = ( true == is_next ) ? eFM25_CS_NONE : eFM25_CS_HIGH_ON_EXIT;
+
+        if ( eFM25_ISA_WRITE == rw_cmd )
+        {
+            status |= fm25_xfer_add( dev, &xfer, p_iov[i].p_data, NULL, p_iov[i].size, cs_action );
         }
         else
         {
-            status = eFM25_ERROR_INIT;
+            status |= fm25_xfer_add( dev, &xfer, NULL, p_iov[i].p_data, p_iov[i].size, cs_action );
 
-            FM25_DBG_PRINT("FM25: Init error!");
+            // Drop gap bytes
+            if (( true == is_next ) && ( gap_num > 0U ))
+            {
+                status |= fm25_xfer_add( dev, &xfer, NULL, gap, gap_num, eFM25_CS_NONE );
+            }
         }
+
+        is_chained = is_next;
     }
 
+    status |= fm25_xfer_flush( dev, &xfer );
+
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       De-initialize FRAM device
+*        Stream pattern to device
 *
-* @return   status - Status of initialization
-*/
+* @note     Pattern block is streamed repeatedly inside single write
+*           command. Block size is multiple of pattern size thus each
+*           block starts at pattern phase 0. Pattern bytes are written
+*           most significant byte first.
+*
+*           Sequential block is regenerated from address of each block.
+*
+* @param[in]    dev             - Device handle
+* @param[in]    addr            - Start address of fill
+* @param[in]    size            - Size of fill in bytes
+* @param[in]    pattern         - Fill pattern
+* @param[in]    pattern_size    - Size of pattern in bytes (1, 2 or 4)
+* @param[in]    is_seq          - Address derived pattern instead of constant one
+* @return       status          - Status of operation
+*/
 ////////////////////////////////////////////////////////////////////////////////
-fm25_status_t fm25_deinit(void)
+static fm25_status_t fm25_fill_stream(fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint32_t pattern, const uint8_t pattern_size, const bool is_seq)
 {
-    fm25_status_t status = eFM25_OK;
+    fm25_status_t   status      = eFM25_OK;
+    uint32_t        left        = size;
+    uint32_t        block_addr  = addr;
+    fm25_xfer_t     xfer        = { .num = 0U };
+    uint8_t         block[FM25_CFG_FILL_BLOCK_SIZE];
 
-    if ( true == gb_is_init )
+    if ( false == is_seq )
     {
-        // Disable write latch
-        status |= fm25_write_disable();
+        for ( uint32_t i = 0U; i < FM25_CFG_FILL_BLOCK_SIZE; i++ )
+        {
+            block[i] = (uint8_t)( pattern >> ( 8U * ( pattern_size - 1U - ( i % pattern_size ))));
+        }
+    }
 
-        // De-init interface layer
-        status |= fm25_if_deinit();
+    status = fm25_xfer_cmd( dev, &xfer, eFM25_ISA_WRITE, addr );
 
-        // De-init
-        gb_is_init = false;
+    while ( left > 0U )
+    {
+        const uint32_t num = ( left > FM25_CFG_FILL_BLOCK_SIZE ) ? FM25_CFG_FILL_BLOCK_SIZE : left;
+
+        if ( true == is_seq )
+        {
+            // Block is referenced by collected segments
+            status |= fm25_xfer_flush( dev, &xfer );
+
+            for ( uint32_t i = 0U; i < num; i++ )
+            {
+                block[i] = FM25_SEQ_VALUE( block_addr + i );
+            }
+        }
+
+        left        -= num;
+        block_addr  += num;
+
+        status |= fm25_xfer_add( dev, &xfer, block, NULL, num, (( 0U == left ) ? eFM25_CS_HIGH_ON_EXIT : eFM25_CS_NONE ));
     }
 
+    status |= fm25_xfer_flush( dev, &xfer );
+
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*        Is device initialized
+*        Fill range with repeating pattern and account it
 *
-* @param[out]   p_is_init   - Initialization flag
-* @return       status      - Status of operation
+* @note     Common body of fill and erase, each accounted as single
+*           operation of its own kind.
+*
+* @param[in]    dev             - Device handle
+* @param[in]    addr            - Start address of fill
+* @param[in]    size            - Size of bytes to fill
+* @param[in]    pattern         - Fill pattern
+* @param[in]    pattern_size    - Size of pattern in bytes (1, 2 or 4)
+* @param[in]    op              - Statistics operation
+* @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-fm25_status_t fm25_is_init(bool * const p_is_init)
+static fm25_status_t fm25_fill_op(fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint32_t pattern, const uint8_t pattern_size, const fm25_stats_op_t op)
 {
     fm25_status_t status = eFM25_OK;
 
-    if ( NULL != p_is_init )
+    FM25_STATS_START( dev );
+
+    const bool is_lock = fm25_lock( dev );
+
+    if  (   ( false == is_lock )
+        ||  ( true == fm25_is_async_busy( dev )))
+    {
+        status = eFM25_ERROR_BUSY;
+    }
+    else if ( true == fm25_is_valid( dev ))
     {
-        *p_is_init = gb_is_init;
+        if  (   (( 1U == pattern_size ) || ( 2U == pattern_size ) || ( 4U == pattern_size ))
+            &&  ( true == fm25_is_valid_range( dev, addr, size )))
+        {
+            status = fm25_fill_stream( dev, addr, size, pattern, pattern_size, false );
+
+            #if ( 1 == FM25_CFG_SHADOW_EN )
+                if  (   ( eFM25_OK == status )
+                    &&  ( NULL != dev->p_shadow ))
+                {
+                    fm25_shadow_fill( dev, addr, size, pattern, pattern_size, false );
+                }
+            #endif
+        }
+        else
+        {
+            status = eFM25_ERROR;
+        }
+
+        FM25_STATS_OP( dev, op, size, status );
     }
     else
     {
-        status = eFM25_ERROR;
+        status = eFM25_ERROR_INIT;
+    }
+
+    #if ( 0 == FM25_CFG_STATS_EN )
+        (void) op;
+    #endif
+
+    if ( true == is_lock )
+    {
+        fm25_unlock( dev );
     }
 
     return status;
@@ -436,131 +993,2439 @@ fm25_status_t fm25_is_init(bool * const p_is_init)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*        Write byte(s) to FRAM
+*        Read byte(s) from device
 *
-* @param[in]    addr    - Start address of write
-* @param[in]    size    - Size of bytes to write
-* @param[in]    p_data  - Pointer to write data
+* @note     Always goes to the bus, RAM shadow is bypassed.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    addr    - Start address of read
+* @param[in]    size    - Size of bytes to read
+* @param[out]   p_data  - Pointer to read data
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-fm25_status_t fm25_write(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+static fm25_status_t fm25_read_stream(fm25_dev_t dev, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
 {
-    fm25_status_t status = eFM25_OK;
+    fm25_status_t   status  = eFM25_OK;
+    fm25_xfer_t     xfer    = { .num = 0U };
 
-    // Check for init
-    FM25_ASSERT( true == gb_is_init );
-
-    if ( true == gb_is_init )
-    {
-        // Send write command
-        status = fm25_write_command( addr );
+    // Send read command
+    status = fm25_xfer_cmd( dev, &xfer, FM25_READ_ISA( dev ), addr );
 
-        // Send data payload
-        status = fm25_if_transmit( p_data, size, eSPI_CS_HIGH_ON_EXIT );
-    }
-    else
-    {
-        status = eFM25_ERROR_INIT;
-    }
+    // Send data payload
+    status |= fm25_xfer_add( dev, &xfer, NULL, p_data, size, eFM25_CS_HIGH_ON_EXIT );
+    status |= fm25_xfer_flush( dev, &xfer );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*        Erase byte(s) from FRAM
-*
-* @brief    This function erase number of bytes from FRAM device starting
-*           from addr parameter. Erase value is defined by "FM25_ERASE_VALUE" macro.
+*        Acquire interface lock
 *
+* @note     Lock spans complete transaction of public API call, thus
+*           write enable, command and payload of concurrent callers
+*           can not interleave. Without lock hook there is nothing to
+*           acquire.
 *
-* @note     Erasing size must be less than 256 bytes!
+* @param[in]    dev     - Device handle
+* @return       is_lock - False if lock could not be acquired
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_lock(fm25_dev_t dev)
+{
+    bool is_lock = true;
+
+    if  (   ( true == fm25_is_valid( dev ))
+        &&  ( NULL != dev->p_if->pf_lock ))
+    {
+        is_lock = ( eFM25_OK == dev->p_if->pf_lock( dev->p_if_ctx ));
+    }
+
+    return is_lock;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Release interface lock
 *
-* @param[in]    addr    - Start address of write
-* @param[in]    size    - Size of bytes to write
-* @return       status  - Status of operation
+* @param[in]    dev     - Device handle
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-fm25_status_t fm25_erase(const uint32_t addr, const uint32_t size)
+static void fm25_unlock(fm25_dev_t dev)
 {
-            fm25_status_t status            = eFM25_OK;
-    static  uint8_t       erase_data[256U]  = { 0 };
+    if  (   ( true == fm25_is_valid( dev ))
+        &&  ( NULL != dev->p_if->pf_unlock ))
+    {
+        dev->p_if->pf_unlock( dev->p_if_ctx );
+    }
+}
 
-    FM25_ASSERT( true == gb_is_init );
-    FM25_ASSERT( size < 256U );
+#if ( 1 == FM25_CFG_SHADOW_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Apply fill to RAM shadow
+    *
+    * @note     Mirrors pattern layout of "fm25_fill_stream()".
+    *
+    * @param[in]    dev             - Device handle
+    * @param[in]    addr            - Start address of fill
+    * @param[in]    size            - Size of fill in bytes
+    * @param[in]    pattern         - Fill pattern
+    * @param[in]    pattern_size    - Size of pattern in bytes (1, 2 or 4)
+    * @param[in]    is_seq          - Address derived pattern instead of constant one
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_shadow_fill(fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint32_t pattern, const uint8_t pattern_size, const bool is_seq)
+    {
+        uint8_t * const p_shadow = &dev->p_shadow[addr];
 
-    // Check for init
-    if ( true == gb_is_init )
+        if ( true == is_seq )
+        {
+            for ( uint32_t i = 0U; i < size; i++ )
+            {
+                p_shadow[i] = FM25_SEQ_VALUE( addr + i );
+            }
+        }
+        else if ( 1U == pattern_size )
+        {
+            memset( p_shadow, (int)( pattern & 0xFFU ), size );
+        }
+        else
+        {
+            for ( uint32_t i = 0U; i < size; i++ )
+            {
+                p_shadow[i] = (uint8_t)( pattern >> ( 8U * ( pattern_size - 1U - ( i % pattern_size ))));
+            }
+        }
+    }
+
+#endif // ( 1 == FM25_CFG_SHADOW_EN )
+
+#if ( 1 == FM25_CFG_SHADOW_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Calculate CRC-16
+    *
+    * @note     CRC-16/CCITT, polynomial 0x1021. Bitwise implementation as
+    *           shadow check runs on small chunks.
+    *
+    * @param[in]    crc     - Running CRC value
+    * @param[in]    p_data  - Pointer to data
+    * @param[in]    size    - Size of data in bytes
+    * @return       crc     - Updated CRC value
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint16_t fm25_crc16(uint16_t crc, const uint8_t * const p_data, const uint32_t size)
     {
-        if ( size < 256U )
+        for ( uint32_t i = 0U; i < size; i++ )
         {
-            // Prepare erase data
-            for ( uint32_t i = 0U; i < 256U; i++ )
+            crc ^= (uint16_t)((uint16_t) p_data[i] << 8U );
+
+            for ( uint8_t bit = 0U; bit < 8U; bit++ )
             {
-                erase_data[i] = FM25_ERASE_VALUE;
+                crc = ( 0U != ( crc & 0x8000U )) ? (uint16_t)(( crc << 1U ) ^ 0x1021U ) : (uint16_t)( crc << 1U );
             }
+        }
+
+        return crc;
+    }
+
+#endif
+
+#if ( 1 == FM25_CFG_VERIFY_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Read back written range and compare it with source data
+    *
+    * @note     Range is read in chunks of "FM25_CFG_VERIFY_CHUNK_SIZE" from
+    *           device, RAM shadow is bypassed. Sampled mode reads at most
+    *           "FM25_CFG_VERIFY_SAMPLE_NUM" chunks, first and last
+    *           included. CRC mode takes CRC-32 of source once, streams
+    *           read back chunks into single running CRC-32 and compares
+    *           both at the end, thus it never compares bytes and both
+    *           CRCs can run on CRC hardware. Its mismatch reports start
+    *           of range.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    addr    - Start address of range
+    * @param[in]    size    - Size of range in bytes
+    * @param[in]    p_data  - Pointer to source data
+    * @param[in]    verify  - Verify mode
+    * @return       status  - "eFM25_ERROR_VERIFY" on mismatch
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_verify_range(fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, const fm25_verify_t verify)
+    {
+        fm25_status_t   status      = eFM25_OK;
+        const uint32_t  chunk_num   = (( size + FM25_CFG_VERIFY_CHUNK_SIZE - 1U ) / FM25_CFG_VERIFY_CHUNK_SIZE );
+        const bool      is_sampled  = (( eFM25_VERIFY_SAMPLED == verify ) && ( chunk_num > FM25_CFG_VERIFY_SAMPLE_NUM ));
+        const uint32_t  check_num   = ( true == is_sampled ) ? FM25_CFG_VERIFY_SAMPLE_NUM : chunk_num;
+        const uint32_t  src_crc     = ( eFM25_VERIFY_CRC == verify ) ? fm25_crc32( FM25_CRC32_INIT, p_data, size ) : FM25_CRC32_INIT;
+        uint32_t        rd_crc      = FM25_CRC32_INIT;
+        uint8_t         buf[FM25_CFG_VERIFY_CHUNK_SIZE];
+
+        for ( uint32_t n = 0U; ( n < check_num ) && ( eFM25_OK == status ); n++ )
+        {
+            const uint32_t chunk    = ( true == is_sampled ) ? (( n * ( chunk_num - 1U )) / ( FM25_CFG_VERIFY_SAMPLE_NUM - 1U )) : n;
+            const uint32_t off      = ( chunk * FM25_CFG_VERIFY_CHUNK_SIZE );
+            const uint32_t num      = (( size - off ) > FM25_CFG_VERIFY_CHUNK_SIZE ) ? FM25_CFG_VERIFY_CHUNK_SIZE : ( size - off );
 
-            // Erase memory
-            status = fm25_write( addr, size, (uint8_t*) erase_data );
+            status = fm25_read_stream( dev, ( addr + off ), num, buf );
+
+            if ( eFM25_OK == status )
+            {
+                if ( eFM25_VERIFY_CRC == verify )
+                {
+                    rd_crc = fm25_crc32( rd_crc, buf, num );
+                }
+                else
+                {
+                    for ( uint32_t i = 0U; i < num; i++ )
+                    {
+                        if ( buf[i] != p_data[off + i] )
+                        {
+                            dev->verify_addr    = ( addr + off + i );
+                            status              = eFM25_ERROR_VERIFY;
+                            break;
+                        }
+                    }
+                }
+            }
         }
-        else
+
+        if  (   ( eFM25_OK == status )
+            &&  ( eFM25_VERIFY_CRC == verify )
+            &&  ( src_crc != rd_crc ))
         {
-            status = eFM25_ERROR;
+            dev->verify_addr    = addr;
+            status              = eFM25_ERROR_VERIFY;
         }
+
+        return status;
     }
-    else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Verify segments of vectored write
+    *
+    * @note     Segments are written in order, thus bytes of segment that
+    *           are overwritten by any later segment are skipped and only
+    *           final content of device is verified.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    p_iov   - Pointer to written segments
+    * @param[in]    iov_num - Number of segments
+    * @return       status  - "eFM25_ERROR_VERIFY" on mismatch
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_verify_iov(fm25_dev_t dev, const fm25_iov_t * const p_iov, const uint32_t iov_num)
     {
-        status = eFM25_ERROR_INIT;
+        fm25_status_t status = eFM25_OK;
+
+        for ( uint32_t i = 0U; ( i < iov_num ) && ( eFM25_OK == status ); i++ )
+        {
+            const uint32_t  end = ( p_iov[i].addr + p_iov[i].size );
+            uint32_t        cur = p_iov[i].addr;
+
+            while   (   ( cur < end )
+                    &&  ( eFM25_OK == status ))
+            {
+                uint32_t skip = cur;
+                uint32_t next = end;
+
+                // Skip bytes covered by later segment, otherwise find where next one starts
+                for ( uint32_t j = ( i + 1U ); j < iov_num; j++ )
+                {
+                    const uint32_t lo = p_iov[j].addr;
+                    const uint32_t hi = ( p_iov[j].addr + p_iov[j].size );
+
+                    if (( lo <= cur ) && ( hi > cur ))
+                    {
+                        skip = ( hi > skip ) ? hi : skip;
+                    }
+                    else if (( lo > cur ) && ( lo < next ))
+                    {
+                        next = lo;
+                    }
+                    else
+                    {
+                        // No actions...
+                    }
+                }
+
+                if ( skip > cur )
+                {
+                    cur = ( skip < end ) ? skip : end;
+                }
+                else
+                {
+                    status = fm25_verify_range( dev, cur, ( next - cur ), &p_iov[i].p_data[cur - p_iov[i].addr], dev->verify );
+                    cur = next;
+                }
+            }
+        }
+
+        return status;
     }
 
-    return status;
-}
+#endif // ( 1 == FM25_CFG_VERIFY_EN )
+
+#if ( 1 == FM25_CFG_SLEEP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Make sure device is out of sleep mode before bus access
+    *
+    * @note     Wake-up started ahead by "fm25_wake()" costs only remainder
+    *           of recovery time. Time spent waiting is accounted as added
+    *           wake-up latency.
+    *
+    * @param[in]    dev     - Device handle
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_sleep_exit(fm25_dev_t dev)
+    {
+        fm25_status_t status = eFM25_OK;
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*        Read byte(s) from FRAM
-*
-* @param[in]    addr    - Start address of write
-* @param[in]    size    - Size of bytes to write
-* @param[out]   p_data  - Pointer to read data
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-fm25_status_t fm25_read(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
-{
-    fm25_status_t status = eFM25_OK;
+        if ( 0U != dev->sleep_idle )
+        {
+            if ( eFM25_SLEEP_ON == dev->sleep_state )
+            {
+                status = fm25_wake_start( dev );
+            }
 
-    // Check for init
-    FM25_ASSERT( true == gb_is_init );
+            if ( eFM25_SLEEP_WAKE == dev->sleep_state )
+            {
+                const   uint32_t    start   = dev->pf_get_tick();
+                        uint32_t    now     = start;
+
+                // Wait for remainder of recovery time
+                while (( now - dev->sleep_tick ) <= dev->wake_time )
+                {
+                    now = dev->pf_get_tick();
+                }
+
+                if ( now == start )
+                {
+                    dev->sleep_stats.wake_hidden++;
+                }
+                else
+                {
+                    dev->sleep_stats.wake_wait += ( now - start );
+                }
+
+                dev->sleep_state = eFM25_SLEEP_OFF;
+            }
 
-    // Invalid inputs
-    FM25_ASSERT( size > 0U );
-    FM25_ASSERT(( addr + size - 1U ) <= FM25_MAX_ADDR );
+            dev->sleep_tick = dev->pf_get_tick();
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Start wake-up of device
+    *
+    * @note     Falling edge of chip select wakes device, command of that
+    *           chip select window is ignored by device. Read status opcode
+    *           is used as it is harmless when device is already awake.
+    *
+    * @param[in]    dev     - Device handle
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_wake_start(fm25_dev_t dev)
+    {
+                fm25_status_t   status  = eFM25_OK;
+        const   uint8_t         cmd     = eFM25_ISA_RDSR;
+        const   uint32_t        now     = dev->pf_get_tick();
 
-    if ( true == gb_is_init )
+        status = dev->p_if->pf_transmit( dev->p_if_ctx, &cmd, 1U, ( eFM25_CS_LOW_ON_ENTRY | eFM25_CS_HIGH_ON_EXIT ));
+
+        FM25_STATS_ADD( dev, frame_bytes, 1U );
+        FM25_STATS_ADD( dev, cs, 1U );
+
+        dev->sleep_stats.wake++;
+        dev->sleep_stats.sleep_time += ( now - dev->sleep_tick );
+        dev->sleep_tick  = now;
+        dev->sleep_state = eFM25_SLEEP_WAKE;
+
+        return status;
+    }
+
+#endif // ( 1 == FM25_CFG_SLEEP_EN )
+
+#if ( 1 == FM25_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Get timestamp for latency histograms
+    *
+    * @note     Device being opened is not valid yet, but its timestamp
+    *           source is already set for status reads of open.
+    *
+    * @param[in]    dev     - Device handle
+    * @return       tick    - Timestamp, 0 without timestamp source
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t fm25_stats_tick(fm25_dev_t dev)
     {
-        if  (   ( size > 0U )
-            &&  (( addr + size - 1U ) <= FM25_MAX_ADDR ))
+        uint32_t tick = 0U;
+
+        if  (   ( NULL != dev )
+            &&  ( NULL != dev->pf_get_tick ))
         {
-            // Send read command
-            status = fm25_read_command( addr );
+            tick = dev->pf_get_tick();
+        }
 
-            // Send data payload
-            status |= fm25_if_receive( p_data, size, eSPI_CS_HIGH_ON_EXIT );
+        return tick;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Account finished operation
+    *
+    * @note     Latency is bucketed by bit length of elapsed ticks, thus
+    *           timestamp wrap-around between start and end is harmless.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    op      - Operation
+    * @param[in]    size    - Payload size in bytes
+    * @param[in]    status  - Status of operation
+    * @param[in]    tick    - Timestamp at start of operation
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_stats_op(fm25_dev_t dev, const fm25_stats_op_t op, const uint32_t size, const fm25_status_t status, const uint32_t tick)
+    {
+        // Payload is counted for succeeded operations only
+        const uint32_t payload = ( eFM25_OK == status ) ? size : 0U;
+
+        switch( op )
+        {
+            case eFM25_STATS_READ:
+                dev->stats.read++;
+                dev->stats.rd_bytes += payload;
+                break;
+
+            case eFM25_STATS_WRITE:
+                dev->stats.write++;
+                dev->stats.wr_bytes += payload;
+                break;
+
+            case eFM25_STATS_ERASE:
+                dev->stats.erase++;
+                dev->stats.wr_bytes += payload;
+                break;
+
+            case eFM25_STATS_STATUS:
+            default:
+                dev->stats.status++;
+                break;
         }
-        else
+
+        if ( eFM25_OK != status )
+        {
+            dev->stats.err++;
+
+            for ( uint32_t bit = 0U; bit < FM25_STATS_ERR_NUM; bit++ )
+            {
+                if ( 0U != ( status & ( 1U << bit )))
+                {
+                    dev->stats.err_bit[bit]++;
+                }
+            }
+        }
+
+        if ( NULL != dev->pf_get_tick )
+        {
+            uint32_t lat    = dev->pf_get_tick() - tick;
+            uint32_t bucket = 0U;
+
+            while   (   ( lat > 0U )
+                    &&  ( bucket < ( FM25_STATS_LAT_NUM - 1U )))
+            {
+                lat >>= 1U;
+                bucket++;
+            }
+
+            dev->stats.lat[op][bucket]++;
+        }
+    }
+
+#endif // ( 1 == FM25_CFG_STATS_EN )
+
+#if ( 1 == FM25_CFG_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Submit asynchronous request
+    *
+    * @note     Without non-blocking interface functions request is executed
+    *           in place and completion callback is called before return.
+    *
+    *           Request starting idle chain takes bus lock in caller context,
+    *           it is released from completion interrupt once chain drains.
+    *           Request submitted from completion callback joins chain that
+    *           still holds the lock.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    p_req   - Pointer to prepared request
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static fm25_status_t fm25_async_submit(fm25_dev_t dev, fm25_async_t * const p_req)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        if  (   ( NULL == dev->p_if->pf_transmit_start )
+            ||  ( NULL == dev->p_if->pf_receive_start ))
+        {
+            if ( NULL != p_req->p_tx )
+            {
+                status = fm25_write( dev, p_req->addr, p_req->size, p_req->p_tx );
+            }
+            else
+            {
+                status = fm25_read( dev, p_req->addr, p_req->size, p_req->p_rx );
+            }
+
+            if ( NULL != p_req->pf_cb )
+            {
+                p_req->pf_cb( dev, status, p_req->p_arg );
+            }
+        }
+        else if (   ( NULL != dev->p_if->pf_lock )
+                &&  ( NULL == dev->p_if->pf_unlock_isr ))
         {
+            // Bus lock can not be released from completion interrupt
             status = eFM25_ERROR;
         }
+        else
+        {
+            bool is_idle = false;
+            bool is_lock = false;
+
+            p_req->p_next   = NULL;
+            p_req->state    = ( NULL != p_req->p_tx ) ? eFM25_ASYNC_WREN : eFM25_ASYNC_CMD;
+
+            #if ( 1 == FM25_CFG_STATS_EN )
+                p_req->tick = fm25_stats_tick( dev );
+            #endif
+
+            FM25_ENTER_CRITICAL();
+
+            if ( NULL == dev->p_async_head )
+            {
+                dev->p_async_head   = p_req;
+                is_idle             = true;
+            }
+            else
+            {
+                dev->p_async_tail->p_next = p_req;
+            }
+
+            dev->p_async_tail = p_req;
+
+            if  (   ( true == is_idle )
+                &&  ( false == dev->async_is_lock ))
+            {
+                dev->async_is_lock  = true;
+                is_lock             = true;
+            }
+
+            FM25_EXIT_CRITICAL();
+
+            if  (   ( true == is_lock )
+                &&  ( NULL != dev->p_if->pf_lock )
+                &&  ( eFM25_OK != dev->p_if->pf_lock( dev->p_if_ctx )))
+            {
+                status = eFM25_ERROR_BUSY;
+
+                fm25_async_abort( dev, p_req );
+            }
+
+            // Kick-off transfer
+            else if ( true == is_idle )
+            {
+                // NOTE: Failed wake-up is reported by first transfer
+                #if ( 1 == FM25_CFG_SLEEP_EN )
+                    (void) fm25_sleep_exit( dev );
+                #endif
+
+                fm25_async_step( dev );
+            }
+        }
+
+        return status;
     }
-    else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Start next transfer of request in progress
+    *
+    * @param[in]    dev     - Device handle
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_async_step(fm25_dev_t dev)
     {
-        status = eFM25_ERROR_INIT;
+        fm25_status_t               status  = eFM25_OK;
+        const fm25_async_t * const  p_req   = dev->p_async_head;
+
+        switch( p_req->state )
+        {
+            case eFM25_ASYNC_WREN:
+                status = dev->p_if->pf_transmit_start( dev->p_if_ctx, &gu8_wren, 1U, ( eFM25_CS_LOW_ON_ENTRY | eFM25_CS_HIGH_ON_EXIT ), fm25_async_done, dev );
+
+                FM25_STATS_ADD( dev, frame_bytes, 1U );
+                FM25_STATS_ADD( dev, cs, 1U );
+                break;
+
+            case eFM25_ASYNC_CMD:
+            {
+                const fm25_isa_t    rw_cmd  = ( NULL != p_req->p_tx ) ? eFM25_ISA_WRITE : FM25_READ_ISA( dev );
+                const uint32_t      size    = fm25_assemble_rw_cmd( dev, &dev->async_cmd, rw_cmd, p_req->addr );
+
+                status = dev->p_if->pf_transmit_start( dev->p_if_ctx, (uint8_t*) &dev->async_cmd.u, size, eFM25_CS_LOW_ON_ENTRY, fm25_async_done, dev );
+
+                FM25_STATS_ADD( dev, frame_bytes, size );
+                FM25_STATS_ADD( dev, cs, 1U );
+                break;
+            }
+
+            case eFM25_ASYNC_DATA:
+                if ( NULL != p_req->p_tx )
+                {
+                    status = dev->p_if->pf_transmit_start( dev->p_if_ctx, p_req->p_tx, p_req->size, eFM25_CS_HIGH_ON_EXIT, fm25_async_done, dev );
+                }
+                else
+                {
+                    status = dev->p_if->pf_receive_start( dev->p_if_ctx, p_req->p_rx, p_req->size, eFM25_CS_HIGH_ON_EXIT, fm25_async_done, dev );
+                }
+                break;
+
+            default:
+                status = eFM25_ERROR;
+                break;
+        }
+
+        if ( eFM25_OK != status )
+        {
+            fm25_async_complete( dev, status );
+        }
     }
 
-    return status;
-}
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Interface transfer completion
+    *
+    * @note     Called from SPI/DMA completion interrupt!
+    *
+    * @param[in]    p_arg   - Device handle
+    * @param[in]    status  - Status of finished transfer
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_async_done(void * const p_arg, const fm25_status_t status)
+    {
+        fm25_dev_t              dev     = (fm25_dev_t) p_arg;
+        fm25_async_t * const    p_req   = dev->p_async_head;
+
+        if  (   ( eFM25_OK != status )
+            ||  ( eFM25_ASYNC_DATA == p_req->state ))
+        {
+            fm25_async_complete( dev, status );
+        }
+        else
+        {
+            p_req->state++;
+            fm25_async_step( dev );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Complete request in progress and start next one
+    *
+    * @note     Bus lock is released once chain drains, unless completion
+    *           callback started new chain.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    status  - Status of request
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_async_complete(fm25_dev_t dev, const fm25_status_t status)
+    {
+        fm25_async_t * const    p_req   = dev->p_async_head;
+        bool                    is_next = false;
+
+        #if ( 1 == FM25_CFG_STATS_EN )
+            fm25_stats_op( dev, (( NULL != p_req->p_tx ) ? eFM25_STATS_WRITE : eFM25_STATS_READ ), p_req->size, status, p_req->tick );
+        #endif
+
+        // Idle time starts at end of transfer
+        #if ( 1 == FM25_CFG_SLEEP_EN )
+            if ( 0U != dev->sleep_idle )
+            {
+                dev->sleep_tick = dev->pf_get_tick();
+            }
+        #endif
+
+        // Write through to shadow
+        if  (   ( eFM25_OK == status )
+            &&  ( NULL != p_req->p_tx )
+            &&  ( NULL != FM25_SHADOW( dev )))
+        {
+            memcpy( &FM25_SHADOW( dev )[p_req->addr], p_req->p_tx, p_req->size );
+        }
+
+        FM25_ENTER_CRITICAL();
+
+        dev->p_async_head = p_req->p_next;
+
+        if ( NULL == dev->p_async_head )
+        {
+            dev->p_async_tail = NULL;
+        }
+
+        // NOTE: Request submitted after queue gets empty is started by submitter
+        is_next = ( NULL != dev->p_async_head );
+
+        FM25_EXIT_CRITICAL();
+
+        if ( NULL != p_req->pf_cb )
+        {
+            p_req->pf_cb( dev, status, p_req->p_arg );
+        }
+
+        // Continue with next request
+        if ( true == is_next )
+        {
+            fm25_async_step( dev );
+        }
+        else
+        {
+            bool is_unlock = false;
+
+            FM25_ENTER_CRITICAL();
+
+            if  (   ( NULL == dev->p_async_head )
+                &&  ( true == dev->async_is_lock ))
+            {
+                dev->async_is_lock  = false;
+                is_unlock           = true;
+            }
+
+            FM25_EXIT_CRITICAL();
+
+            if  (   ( true == is_unlock )
+                &&  ( NULL != dev->p_if->pf_unlock_isr ))
+            {
+                dev->p_if->pf_unlock_isr( dev->p_if_ctx );
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Abort chain that failed to take bus lock
+    *
+    * @note     Rejected request is reported to submitter by return status,
+    *           requests queued behind it complete with "eFM25_ERROR_BUSY".
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    p_req   - Rejected request at head of chain
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void fm25_async_abort(fm25_dev_t dev, const fm25_async_t * const p_req)
+    {
+        fm25_async_t * p_list = NULL;
+
+        FM25_ENTER_CRITICAL();
+
+        p_list              = dev->p_async_head;
+        dev->p_async_head   = NULL;
+        dev->p_async_tail   = NULL;
+        dev->async_is_lock  = false;
+
+        FM25_EXIT_CRITICAL();
+
+        while ( NULL != p_list )
+        {
+            fm25_async_t * const p_fail = p_list;
+
+            // Request storage can be reused from callback
+            p_list = p_list->p_next;
+
+            if  (   ( p_fail != p_req )
+                &&  ( NULL != p_fail->pf_cb ))
+            {
+                p_fail->pf_cb( dev, eFM25_ERROR_BUSY, p_fail->p_arg );
+            }
+        }
+    }
+
+#endif // ( 1 == FM25_CFG_ASYNC_EN )
+
+// NOTE: Unused function for now. Leave for as it might be useful in future!
+#if 0
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write to device status register
+*
+* @param[in]    dev             - Device handle
+* @param[in]    p_status_reg    - Pointer to status register
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_write_status(fm25_dev_t dev, const fm25_status_reg_t * const p_status_reg)
+{
+            fm25_status_t status = eFM25_OK;
+    const   uint8_t       cmd    = eFM25_ISA_WRSR;
+
+    status = dev->p_if->pf_transmit( dev->p_if_ctx, &cmd, 1U, eFM25_CS_LOW_ON_ENTRY );
+    status |= dev->p_if->pf_transmit( dev->p_if_ctx, (uint8_t*) p_status_reg, 1U, eFM25_CS_HIGH_ON_EXIT );
+
+    return status;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open FRAM device
+*
+* @note     Each device has its own low level interface, address width
+*           and statistics. Up to "FM25_CFG_DEV_NUM_MAX" devices can be
+*           opened at the same time.
+*
+*           Device ID and serial number are read at open. With runtime
+*           density and "addr_bit_num" set to 0 number of address bits is
+*           taken from device table, open fails for unknown part.
+*
+*           With RAM shadow configured whole memory array is loaded into
+*           shadow by single read command.
+*
+* @param[out]   p_dev   - Pointer to device handle
+* @param[in]    p_cfg   - Pointer to device configuration
+* @return       status  - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_open(fm25_dev_t * const p_dev, const fm25_dev_cfg_t * const p_cfg)
+{
+    fm25_status_t   status          = eFM25_OK;
+    fm25_dev_t      dev             = NULL;
+    uint8_t         addr_bit_num    = FM25_CFG_ADDR_BIT_NUM;
+    bool            is_fast         = false;
+    bool            is_detect       = false;
+
+    FM25_ASSERT( NULL != p_dev );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if ( NULL != p_cfg )
+    {
+        if ( 0U != p_cfg->addr_bit_num )
+        {
+            addr_bit_num = p_cfg->addr_bit_num;
+        }
+
+        // NOTE: Pinned density resolves to false at compile time
+        is_detect = (( 0 == FM25_CFG_ADDR_BIT_NUM ) && ( 0U == addr_bit_num ));
+
+        // Plain READ can not keep up with SPI clock
+        is_fast =   (   ( eFM25_READ_FAST == p_cfg->read_mode )
+                    ||  (   ( eFM25_READ_AUTO == p_cfg->read_mode )
+                        &&  ( 0U != p_cfg->read_max_hz )
+                        &&  ( p_cfg->sck_hz > p_cfg->read_max_hz )));
+    }
+
+    // Allocate instance
+    for ( uint32_t i = 0U; i < FM25_CFG_DEV_NUM_MAX; i++ )
+    {
+        if ( false == g_fm25_dev[i].is_init )
+        {
+            dev = &g_fm25_dev[i];
+            break;
+        }
+    }
+
+    // NOTE: Pinned density can not be overridden by device configuration
+    // NOTE: FSTRD opcode collides with A8 bit of 9-bit devices
+    if  (   ( NULL == p_dev )
+        ||  ( NULL == p_cfg )
+        ||  ( NULL == p_cfg->p_if )
+        ||  ( NULL == p_cfg->p_if->pf_transmit )
+        ||  ( NULL == p_cfg->p_if->pf_receive )
+        ||  (( false == is_detect ) && (( addr_bit_num < 9U ) || ( addr_bit_num > 19U )))
+        ||  (( 0 != FM25_CFG_ADDR_BIT_NUM ) && ( FM25_CFG_ADDR_BIT_NUM != addr_bit_num ))
+        ||  (( true == is_fast ) && (( 0 == FM25_CFG_FSTRD_EN ) || ( 9U == addr_bit_num )))
+        ||  (( NULL != p_cfg->p_shadow ) && ( 0 == FM25_CFG_SHADOW_EN ))
+        ||  (( eFM25_VERIFY_NONE != p_cfg->verify ) && ( 0 == FM25_CFG_VERIFY_EN ))
+        ||  ( p_cfg->verify > eFM25_VERIFY_CRC )
+        ||  (( 0U != p_cfg->sleep_idle ) && (( 0 == FM25_CFG_SLEEP_EN ) || ( NULL == p_cfg->pf_get_tick ))))
+    {
+        status = eFM25_ERROR;
+    }
+    else if ( NULL == dev )
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        dev->p_if           = p_cfg->p_if;
+        dev->p_if_ctx       = p_cfg->p_if_ctx;
+        dev->addr_bit_num   = addr_bit_num;
+
+        #if ( 1 == FM25_CFG_STATS_EN ) || ( 1 == FM25_CFG_SLEEP_EN )
+            dev->pf_get_tick    = p_cfg->pf_get_tick;
+        #endif
+
+        #if ( 1 == FM25_CFG_STATS_EN )
+            dev->stats          = (fm25_stats_t) { 0 };
+        #endif
+
+        #if ( 1 == FM25_CFG_SLEEP_EN )
+            dev->sleep_stats    = (fm25_sleep_stats_t) { 0 };
+            dev->sleep_idle     = p_cfg->sleep_idle;
+            dev->wake_time      = p_cfg->wake_time;
+
+            // Part may still sleep after MCU reset, first access wakes it
+            if ( 0U != dev->sleep_idle )
+            {
+                dev->open_tick      = dev->pf_get_tick();
+                dev->sleep_tick     = dev->open_tick;
+                dev->sleep_state    = eFM25_SLEEP_ON;
+            }
+            else
+            {
+                dev->sleep_state    = eFM25_SLEEP_OFF;
+            }
+        #endif
+
+        #if ( 1 == FM25_CFG_FSTRD_EN )
+            dev->read_isa = ( true == is_fast ) ? eFM25_ISA_FSTRD : eFM25_ISA_READ;
+        #endif
+
+        #if ( 1 == FM25_CFG_SHADOW_EN )
+            dev->p_shadow       = NULL;
+            dev->chk_addr       = 0U;
+            dev->chk_crc_dev    = 0xFFFFU;
+            dev->chk_crc_shadow = 0xFFFFU;
+        #endif
+
+        #if ( 1 == FM25_CFG_VERIFY_EN )
+            dev->verify         = p_cfg->verify;
+            dev->verify_addr    = 0U;
+        #endif
+
+        #if ( 1 == FM25_CFG_ASYNC_EN )
+            dev->p_async_head   = NULL;
+            dev->p_async_tail   = NULL;
+            dev->async_is_lock  = false;
+        #endif
+
+        // Initialize app interface
+        if ( NULL != dev->p_if->pf_init )
+        {
+            status = dev->p_if->pf_init( dev->p_if_ctx );
+        }
+
+        const bool is_if_init = ( eFM25_OK == status );
+
+        // Device is not valid yet, take bus lock directly
+        if  (   ( eFM25_OK == status )
+            &&  ( NULL != dev->p_if->pf_lock ))
+        {
+            status = dev->p_if->pf_lock( dev->p_if_ctx );
+        }
+
+        const bool is_lock = ( eFM25_OK == status );
+
+        // Enable write latch
+        status |= fm25_write_enable( dev );
+
+        // Read WEL flag
+        const bool wel_flag = fm25_read_wel_flag( dev );
+
+        // Identify part
+        status |= fm25_read_id( dev, addr_bit_num );
+
+        #if ( 0 == FM25_CFG_ADDR_BIT_NUM )
+            if ( true == is_detect )
+            {
+                if ( NULL != dev->info.p_name )
+                {
+                    dev->addr_bit_num = dev->info.addr_bit_num;
+                }
+                else
+                {
+                    status |= eFM25_ERROR_INIT;
+
+                    FM25_DBG_PRINT("FM25: Unknown device!");
+                }
+            }
+        #endif
+
+        // Identified part without FSTRD
+        if  (   ( true == is_fast )
+            &&  ( true == dev->info.is_id )
+            &&  ( false == dev->info.fstrd_en ))
+        {
+            status |= eFM25_ERROR_INIT;
+        }
+
+        // Shadow smaller than memory array
+        if  (   ( NULL != p_cfg->p_shadow )
+            &&  ( p_cfg->shadow_size < ( FM25_MAX_ADDR( dev ) + 1UL )))
+        {
+            status |= eFM25_ERROR_INIT;
+        }
+
+        // Load shadow
+        #if ( 1 == FM25_CFG_SHADOW_EN )
+            if  (   ( eFM25_OK == status )
+                &&  ( NULL != p_cfg->p_shadow ))
+            {
+                status |= fm25_read_stream( dev, 0U, ( FM25_MAX_ADDR( dev ) + 1UL ), p_cfg->p_shadow );
+                dev->p_shadow = p_cfg->p_shadow;
+            }
+        #endif
+
+        if  (   ( true == is_lock )
+            &&  ( NULL != dev->p_if->pf_unlock ))
+        {
+            dev->p_if->pf_unlock( dev->p_if_ctx );
+        }
+
+        if  (   ( eFM25_OK == status )
+            &&  ( true == wel_flag ))
+        {
+            dev->is_init = true;
+            *p_dev = dev;
+
+            FM25_DBG_PRINT("FM25: Init success!");
+        }
+        else
+        {
+            // Release interface initialized above
+            if  (   ( true == is_if_init )
+                &&  ( NULL != dev->p_if->pf_deinit ))
+            {
+                (void) dev->p_if->pf_deinit( dev->p_if_ctx );
+            }
+
+            status = eFM25_ERROR_INIT;
+
+            FM25_DBG_PRINT("FM25: Init error!");
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Close FRAM device
+*
+* @param[in]    dev     - Device handle
+* @return       status  - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_close(fm25_dev_t dev)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if ( true == fm25_is_async_busy( dev ))
+    {
+        status = eFM25_ERROR_BUSY;
+    }
+    else if ( true == fm25_is_valid( dev ))
+    {
+        // Disable write latch
+        if ( true == fm25_lock( dev ))
+        {
+            status |= fm25_write_disable( dev );
+
+            fm25_unlock( dev );
+        }
+        else
+        {
+            status |= eFM25_ERROR_BUSY;
+        }
+
+        // De-init interface layer
+        if ( NULL != dev->p_if->pf_deinit )
+        {
+            status |= dev->p_if->pf_deinit( dev->p_if_ctx );
+        }
+
+        // De-init
+        dev->is_init = false;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Is device initialized
+*
+* @param[in]    dev         - Device handle
+* @param[out]   p_is_init   - Initialization flag
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_is_init(fm25_dev_t dev, bool * const p_is_init)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if ( NULL != p_is_init )
+    {
+        *p_is_init = fm25_is_valid( dev );
+    }
+    else
+    {
+        status = eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get size of device memory array
+*
+* @param[in]    dev     - Device handle
+* @param[out]   p_size  - Size of memory in bytes
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_get_size(fm25_dev_t dev, uint32_t * const p_size)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if ( false == fm25_is_valid( dev ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_size )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        *p_size = ( FM25_MAX_ADDR( dev ) + 1UL );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get device identification
+*
+* @param[in]    dev     - Device handle
+* @param[out]   p_info  - Pointer to identification
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_get_info(fm25_dev_t dev, fm25_dev_info_t * const p_info)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if ( false == fm25_is_valid( dev ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_info )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        *p_info = dev->info;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write byte(s) to FRAM
+*
+* @param[in]    dev     - Device handle
+* @param[in]    addr    - Start address of write
+* @param[in]    size    - Size of bytes to write
+* @param[in]    p_data  - Pointer to write data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_write(fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    fm25_status_t status = eFM25_OK;
+
+    FM25_STATS_START( dev );
+
+    // Check for init
+    FM25_ASSERT( true == fm25_is_valid( dev ));
+
+    const bool is_lock = fm25_lock( dev );
+
+    if  (   ( false == is_lock )
+        ||  ( true == fm25_is_async_busy( dev )))
+    {
+        status = eFM25_ERROR_BUSY;
+    }
+    else if ( true == fm25_is_valid( dev ))
+    {
+        if  (   ( NULL != p_data )
+            &&  ( true == fm25_is_valid_range( dev, addr, size )))
+        {
+            fm25_xfer_t xfer = { .num = 0U };
+
+            // Send write command
+            status = fm25_xfer_cmd( dev, &xfer, eFM25_ISA_WRITE, addr );
+
+            // Send data payload
+            status |= fm25_xfer_add( dev, &xfer, p_data, NULL, size, eFM25_CS_HIGH_ON_EXIT );
+            status |= fm25_xfer_flush( dev, &xfer );
+
+            #if ( 1 == FM25_CFG_VERIFY_EN )
+                if  (   ( eFM25_OK == status )
+                    &&  ( eFM25_VERIFY_NONE != dev->verify))
+                {
+                    status = fm25_verify_range( dev, addr, size, p_data, dev->verify);
+                }
+            #endif
+
+            // Write through to shadow
+            if  (   ( eFM25_OK == status )
+                &&  ( NULL != FM25_SHADOW( dev )))
+            {
+                memcpy( &FM25_SHADOW( dev )[addr], p_data, size );
+            }
+        }
+        else
+        {
+            status = eFM25_ERROR;
+        }
+
+        FM25_STATS_OP( dev, eFM25_STATS_WRITE, size, status );
+    }
+    else
+    {
+        status = eFM25_ERROR_INIT;
+    }
+
+    if ( true == is_lock )
+    {
+        fm25_unlock( dev );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Erase byte(s) from FRAM
+*
+* @brief    This function erase number of bytes from FRAM device starting
+*           from addr parameter. Erase value is defined by "FM25_ERASE_VALUE" macro.
+*
+* @note     Erase is done as single write command of any size.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    addr    - Start address of erase
+* @param[in]    size    - Size of bytes to erase
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_erase(fm25_dev_t dev, const uint32_t addr, const uint32_t size)
+{
+    FM25_ASSERT( true == fm25_is_valid( dev ));
+
+    return fm25_fill_op( dev, addr, size, FM25_ERASE_VALUE, 1U, eFM25_STATS_ERASE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Fill FRAM with repeating pattern
+*
+* @brief    This function fills any number of bytes starting from addr
+*           with 1, 2 or 4 byte pattern as single write command. Pattern
+*           bytes are written most significant byte first, starting at
+*           addr.
+*
+* @param[in]    dev             - Device handle
+* @param[in]    addr            - Start address of fill
+* @param[in]    size            - Size of bytes to fill
+* @param[in]    pattern         - Fill pattern
+* @param[in]    pattern_size    - Size of pattern in bytes (1, 2 or 4)
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_fill(fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint32_t pattern, const uint8_t pattern_size)
+{
+    FM25_ASSERT( true == fm25_is_valid( dev ));
+
+    return fm25_fill_op( dev, addr, size, pattern, pattern_size, eFM25_STATS_WRITE );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Fill FRAM with sequential pattern
+*
+* @brief    This function writes address derived value "FM25_SEQ_VALUE(addr)"
+*           to each byte of range as single write command. Intended for
+*           production self-test where read back is compared against the
+*           same macro.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    addr    - Start address of fill
+* @param[in]    size    - Size of bytes to fill
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_fill_seq(fm25_dev_t dev, const uint32_t addr, const uint32_t size)
+{
+    fm25_status_t status = eFM25_OK;
+
+    FM25_STATS_START( dev );
+
+    FM25_ASSERT( true == fm25_is_valid( dev ));
+
+    const bool is_lock = fm25_lock( dev );
+
+    if  (   ( false == is_lock )
+        ||  ( true == fm25_is_async_busy( dev )))
+    {
+        status = eFM25_ERROR_BUSY;
+    }
+    else if ( true == fm25_is_valid( dev ))
+    {
+        if ( true == fm25_is_valid_range( dev, addr, size ))
+        {
+            status = fm25_fill_stream( dev, addr, size, 0U, 1U, true );
+
+            #if ( 1 == FM25_CFG_SHADOW_EN )
+                if  (   ( eFM25_OK == status )
+                    &&  ( NULL != dev->p_shadow ))
+                {
+                    fm25_shadow_fill( dev, addr, size, 0U, 1U, true );
+                }
+            #endif
+        }
+        else
+        {
+            status = eFM25_ERROR;
+        }
+
+        FM25_STATS_OP( dev, eFM25_STATS_WRITE, size, status );
+    }
+    else
+    {
+        status = eFM25_ERROR_INIT;
+    }
+
+    if ( true == is_lock )
+    {
+        fm25_unlock( dev );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Copy byte(s) inside FRAM
+*
+* @brief    This function copies size bytes from src to dst address with
+*           memmove semantics, overlapping ranges are copied correctly in
+*           either direction.
+*
+* @note     Shadowed device is copied as single write command straight
+*           from RAM shadow. Otherwise data is moved through stack bounce
+*           buffer of "FM25_CFG_COPY_CHUNK_SIZE" bytes, one read and one
+*           write command per chunk. Chunks are taken from the end of
+*           range when dst is above overlapping src.
+*
+*           Copy is accounted as one read and one write operation, read
+*           payload being bytes actually read.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    dst     - Destination address
+* @param[in]    src     - Source address
+* @param[in]    size    - Size of bytes to copy
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_copy(fm25_dev_t dev, const uint32_t dst, const uint32_t src, const uint32_t size)
+{
+    fm25_status_t   status      = eFM25_OK;
+    fm25_status_t   rd_status   = eFM25_OK;
+    uint32_t        rd_size     = 0U;
+
+    FM25_STATS_START( dev );
+
+    FM25_ASSERT( true == fm25_is_valid( dev ));
+
+    const bool is_lock = fm25_lock( dev );
+
+    if  (   ( false == is_lock )
+        ||  ( true == fm25_is_async_busy( dev )))
+    {
+        status = eFM25_ERROR_BUSY;
+    }
+    else if ( true == fm25_is_valid( dev ))
+    {
+        if  (   ( true == fm25_is_valid_range( dev, dst, size ))
+            &&  ( true == fm25_is_valid_range( dev, src, size )))
+        {
+            if ( dst == src )
+            {
+                // Nothing to move
+            }
+            else if ( NULL != FM25_SHADOW( dev ))
+            {
+                fm25_xfer_t xfer = { .num = 0U };
+
+                // Read is served from shadow
+                rd_size = size;
+
+                // Source is already in RAM, stream it as write payload
+                status = fm25_xfer_cmd( dev, &xfer, eFM25_ISA_WRITE, dst );
+                status |= fm25_xfer_add( dev, &xfer, &FM25_SHADOW( dev )[src], NULL, size, eFM25_CS_HIGH_ON_EXIT );
+                status |= fm25_xfer_flush( dev, &xfer );
+
+                #if ( 1 == FM25_CFG_VERIFY_EN )
+                    if  (   ( eFM25_OK == status )
+                        &&  ( eFM25_VERIFY_NONE != dev->verify ))
+                    {
+                        status = fm25_verify_range( dev, dst, size, &FM25_SHADOW( dev )[src], dev->verify );
+                    }
+                #endif
+
+                if ( eFM25_OK == status )
+                {
+                    memmove( &FM25_SHADOW( dev )[dst], &FM25_SHADOW( dev )[src], size );
+                }
+            }
+            else
+            {
+                uint8_t     buf[FM25_CFG_COPY_CHUNK_SIZE];
+                const bool  is_down = ( dst > src );
+                uint32_t    done    = 0U;
+
+                while   (   ( eFM25_OK == status )
+                        &&  ( done < size ))
+                {
+                    const uint32_t  chunk   = ((( size - done ) > sizeof( buf )) ? sizeof( buf ) : ( size - done ));
+                    const uint32_t  offset  = (( true == is_down ) ? ( size - done - chunk ) : done );
+                    fm25_xfer_t     xfer    = { .num = 0U };
+
+                    rd_status   = fm25_read_stream( dev, ( src + offset ), chunk, buf );
+                    status      = rd_status;
+
+                    if ( eFM25_OK == status )
+                    {
+                        rd_size += chunk;
+
+                        status = fm25_xfer_cmd( dev, &xfer, eFM25_ISA_WRITE, ( dst + offset ));
+                        status |= fm25_xfer_add( dev, &xfer, buf, NULL, chunk, eFM25_CS_HIGH_ON_EXIT );
+                        status |= fm25_xfer_flush( dev, &xfer );
+                    }
+
+                    #if ( 1 == FM25_CFG_VERIFY_EN )
+                        if  (   ( eFM25_OK == status )
+                            &&  ( eFM25_VERIFY_NONE != dev->verify ))
+                        {
+                            status = fm25_verify_range( dev, ( dst + offset ), chunk, buf, dev->verify );
+                        }
+                    #endif
+
+                    done += chunk;
+                }
+            }
+        }
+        else
+        {
+            status      = eFM25_ERROR;
+            rd_status   = eFM25_ERROR;
+        }
+
+        FM25_STATS_OP( dev, eFM25_STATS_READ, rd_size, rd_status );
+        FM25_STATS_OP( dev, eFM25_STATS_WRITE, size, status );
+    }
+    else
+    {
+        status = eFM25_ERROR_INIT;
+    }
+
+    if ( true == is_lock )
+    {
+        fm25_unlock( dev );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read byte(s) from FRAM
+*
+* @note     With RAM shadow data is copied from shadow without bus access.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    addr    - Start address of write
+* @param[in]    size    - Size of bytes to write
+* @param[out]   p_data  - Pointer to read data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_read(fm25_dev_t dev, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    fm25_status_t status = eFM25_OK;
+
+    FM25_STATS_START( dev );
+
+    // Check for init
+    FM25_ASSERT( true == fm25_is_valid( dev ));
+
+    // Invalid inputs
+    FM25_ASSERT( size > 0U );
+    FM25_ASSERT( NULL != p_data );
+
+    const bool is_lock = fm25_lock( dev );
+
+    if  (   ( false == is_lock )
+        ||  ( true == fm25_is_async_busy( dev )))
+    {
+        status = eFM25_ERROR_BUSY;
+    }
+    else if ( true == fm25_is_valid( dev ))
+    {
+        if  (   ( NULL != p_data )
+            &&  ( true == fm25_is_valid_range( dev, addr, size )))
+        {
+            if ( NULL != FM25_SHADOW( dev ))
+            {
+                memcpy( p_data, &FM25_SHADOW( dev )[addr], size );
+            }
+            else
+            {
+                status = fm25_read_stream( dev, addr, size, p_data );
+            }
+        }
+        else
+        {
+            status = eFM25_ERROR;
+        }
+
+        FM25_STATS_OP( dev, eFM25_STATS_READ, size, status );
+    }
+    else
+    {
+        status = eFM25_ERROR_INIT;
+    }
+
+    if ( true == is_lock )
+    {
+        fm25_unlock( dev );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write segments to FRAM
+*
+* @brief    This function writes list of (address, size, data) segments.
+*           Segments contiguous on device are streamed as single write
+*           command without staging copy, each non-contiguous run costs one
+*           write command.
+*
+* @note     Segments are written in given order.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    p_iov   - Pointer to segments
+* @param[in]    iov_num - Number of segments
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_writev(fm25_dev_t dev, const fm25_iov_t * const p_iov, const uint32_t iov_num)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        size    = 0U;
+
+    FM25_STATS_START( dev );
+
+    // Check for init
+    FM25_ASSERT( true == fm25_is_valid( dev ));
+
+    const bool is_lock = fm25_lock( dev );
+
+    if  (   ( false == is_lock )
+        ||  ( true == fm25_is_async_busy( dev )))
+    {
+        status = eFM25_ERROR_BUSY;
+    }
+    else if ( true == fm25_is_valid( dev ))
+    {
+        if ( true == fm25_is_valid_iov( dev, p_iov, iov_num, &size ))
+        {
+            status = fm25_rw_vector( dev, eFM25_ISA_WRITE, p_iov, iov_num );
+
+            #if ( 1 == FM25_CFG_VERIFY_EN )
+                if  (   ( eFM25_OK == status )
+                    &&  ( eFM25_VERIFY_NONE != dev->verify ))
+                {
+                    status = fm25_verify_iov( dev, p_iov, iov_num );
+                }
+            #endif
+
+            // Write through to shadow
+            if  (   ( eFM25_OK == status )
+                &&  ( NULL != FM25_SHADOW( dev )))
+            {
+                for ( uint32_t i = 0U; i < iov_num; i++ )
+                {
+                    memcpy( &FM25_SHADOW( dev )[p_iov[i].addr], p_iov[i].p_data, p_iov[i].size );
+                }
+            }
+        }
+        else
+        {
+            status = eFM25_ERROR;
+        }
+
+        FM25_STATS_OP( dev, eFM25_STATS_WRITE, size, status );
+    }
+    else
+    {
+        status = eFM25_ERROR_INIT;
+    }
+
+    if ( true == is_lock )
+    {
+        fm25_unlock( dev );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read segments from FRAM
+*
+* @brief    This function reads list of (address, size, data) segments.
+*           Segments contiguous on device, or separated by gap not longer
+*           than command frame, are read as single read command. With RAM
+*           shadow segments are copied from shadow.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    p_iov   - Pointer to segments
+* @param[in]    iov_num - Number of segments
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_readv(fm25_dev_t dev, const fm25_iov_t * const p_iov, const uint32_t iov_num)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        size    = 0U;
+
+    FM25_STATS_START( dev );
+
+    // Check for init
+    FM25_ASSERT( true == fm25_is_valid( dev ));
+
+    const bool is_lock = fm25_lock( dev );
+
+    if  (   ( false == is_lock )
+        ||  ( true == fm25_is_async_busy( dev )))
+    {
+        status = eFM25_ERROR_BUSY;
+    }
+    else if ( true == fm25_is_valid( dev ))
+    {
+        if ( true == fm25_is_valid_iov( dev, p_iov, iov_num, &size ))
+        {
+            if ( NULL != FM25_SHADOW( dev ))
+            {
+                for ( uint32_t i = 0U; i < iov_num; i++ )
+                {
+                    memcpy( p_iov[i].p_data, &FM25_SHADOW( dev )[p_iov[i].addr], p_iov[i].size );
+                }
+            }
+            else
+            {
+                status = fm25_rw_vector( dev, FM25_READ_ISA( dev ), p_iov, iov_num );
+            }
+        }
+        else
+        {
+            status = eFM25_ERROR;
+        }
+
+        FM25_STATS_OP( dev, eFM25_STATS_READ, size, status );
+    }
+    else
+    {
+        status = eFM25_ERROR_INIT;
+    }
+
+    if ( true == is_lock )
+    {
+        fm25_unlock( dev );
+    }
+
+    return status;
+}
+
+#if ( 1 == FM25_CFG_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Write byte(s) to FRAM asynchronously
+    *
+    * @note     Request is queued and driven by SPI/DMA completion interrupts
+    *           through write enable, command and payload transfers. Callback
+    *           is called from interrupt context once request is completed.
+    *
+    *           Synchronous API returns "eFM25_ERROR_BUSY" while asynchronous
+    *           requests are pending.
+    *
+    *           Request starting idle chain takes bus lock and may block on
+    *           it, thus it shall be submitted from task context or from
+    *           completion callback. Failed lock returns "eFM25_ERROR_BUSY".
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    p_req   - Request storage, valid until completion
+    * @param[in]    addr    - Start address of write
+    * @param[in]    size    - Size of bytes to write
+    * @param[in]    p_data  - Pointer to write data, valid until completion
+    * @param[in]    pf_cb   - Completion callback, can be NULL
+    * @param[in]    p_arg   - Callback argument
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_write_async(fm25_dev_t dev, fm25_async_t * const p_req, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_fm25_async_cb_t pf_cb, void * const p_arg)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        if ( true == fm25_is_valid( dev ))
+        {
+            if  (   ( NULL != p_req )
+                &&  ( NULL != p_data )
+                &&  ( true == fm25_is_valid_range( dev, addr, size )))
+            {
+                p_req->p_tx     = p_data;
+                p_req->p_rx     = NULL;
+                p_req->addr     = addr;
+                p_req->size     = size;
+                p_req->pf_cb    = pf_cb;
+                p_req->p_arg    = p_arg;
+
+                status = fm25_async_submit( dev, p_req );
+            }
+            else
+            {
+                status = eFM25_ERROR;
+            }
+        }
+        else
+        {
+            status = eFM25_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Read byte(s) from FRAM asynchronously
+    *
+    * @note     Request is queued and driven by SPI/DMA completion interrupts
+    *           through command and payload transfers. Callback is called from
+    *           interrupt context once request is completed.
+
+    *           Bus lock is taken as with "fm25_write_async()".
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    p_req   - Request storage, valid until completion
+    * @param[in]    addr    - Start address of read
+    * @param[in]    size    - Size of bytes to read
+    * @param[out]   p_data  - Pointer to read data, valid until completion
+    * @param[in]    pf_cb   - Completion callback, can be NULL
+    * @param[in]    p_arg   - Callback argument
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_read_async(fm25_dev_t dev, fm25_async_t * const p_req, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_fm25_async_cb_t pf_cb, void * const p_arg)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        if ( true == fm25_is_valid( dev ))
+        {
+            if  (   ( NULL != p_req )
+                &&  ( NULL != p_data )
+                &&  ( true == fm25_is_valid_range( dev, addr, size )))
+            {
+                p_req->p_tx     = NULL;
+                p_req->p_rx     = p_data;
+                p_req->addr     = addr;
+                p_req->size     = size;
+                p_req->pf_cb    = pf_cb;
+                p_req->p_arg    = p_arg;
+
+                status = fm25_async_submit( dev, p_req );
+            }
+            else
+            {
+                status = eFM25_ERROR;
+            }
+        }
+        else
+        {
+            status = eFM25_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif // ( 1 == FM25_CFG_ASYNC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Is device busy with asynchronous requests
+*
+* @param[in]    dev         - Device handle
+* @param[out]   p_is_busy   - Busy flag
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_is_busy(fm25_dev_t dev, bool * const p_is_busy)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if ( false == fm25_is_valid( dev ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_is_busy )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        *p_is_busy = fm25_is_async_busy( dev );
+    }
+
+    return status;
+}
+
+#if ( 1 == FM25_CFG_SHADOW_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Get pointer into RAM shadow
+    *
+    * @note     Zero-copy access to shadowed data. Data behind pointer
+    *           follows later writes of device.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    addr    - Start address
+    * @param[in]    size    - Size of accessed range in bytes
+    * @param[out]   pp_data - Pointer to shadowed data at addr
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_shadow_ptr(fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t ** const pp_data)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if (   ( NULL == pp_data )
+                ||  ( NULL == dev->p_shadow )
+                ||  ( false == fm25_is_valid_range( dev, addr, size )))
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            *pp_data = &dev->p_shadow[addr];
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Check RAM shadow against device in background
+    *
+    * @note     Each call reads "FM25_CFG_SHADOW_CHECK_SIZE" bytes from device
+    *           and updates running CRC of device and shadow data. At the end
+    *           of memory array both CRCs are compared and check starts
+    *           over. Writes between steps update device and shadow alike,
+    *           thus they do not break the check.
+    *
+    * @param[in]    dev         - Device handle
+    * @param[out]   p_is_done   - Check pass completed, can be NULL
+    * @return       status      - "eFM25_ERROR_SHADOW" on divergence at the end of pass
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_shadow_check(fm25_dev_t dev, bool * const p_is_done)
+    {
+        fm25_status_t   status  = eFM25_OK;
+        bool            is_done = false;
+        uint8_t         buf[FM25_CFG_SHADOW_CHECK_SIZE];
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        const bool is_lock = fm25_lock( dev );
+
+        if  (   ( false == is_lock )
+            ||  ( true == fm25_is_async_busy( dev )))
+        {
+            status = eFM25_ERROR_BUSY;
+        }
+        else if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if ( NULL == dev->p_shadow )
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            const uint32_t left = ( FM25_MAX_ADDR( dev ) + 1UL - dev->chk_addr );
+            const uint32_t num  = ( left > FM25_CFG_SHADOW_CHECK_SIZE ) ? FM25_CFG_SHADOW_CHECK_SIZE : left;
+
+            status = fm25_read_stream( dev, dev->chk_addr, num, buf );
+
+            if ( eFM25_OK == status )
+            {
+                dev->chk_crc_dev    = fm25_crc16( dev->chk_crc_dev, buf, num );
+                dev->chk_crc_shadow = fm25_crc16( dev->chk_crc_shadow, &dev->p_shadow[dev->chk_addr], num );
+                dev->chk_addr      += num;
+
+                // End of pass
+                if ( dev->chk_addr > FM25_MAX_ADDR( dev ))
+                {
+                    if ( dev->chk_crc_dev != dev->chk_crc_shadow )
+                    {
+                        status = eFM25_ERROR_SHADOW;
+
+                        FM25_DBG_PRINT("FM25: Shadow diverged from device!");
+                    }
+
+                    dev->chk_addr       = 0U;
+                    dev->chk_crc_dev    = 0xFFFFU;
+                    dev->chk_crc_shadow = 0xFFFFU;
+                    is_done             = true;
+                }
+            }
+        }
+
+        if ( NULL != p_is_done )
+        {
+            *p_is_done = is_done;
+        }
+
+        if ( true == is_lock )
+        {
+            fm25_unlock( dev );
+        }
+
+        return status;
+    }
+
+#endif // ( 1 == FM25_CFG_SHADOW_EN )
+
+#if ( 1 == FM25_CFG_VERIFY_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Set verify-after-write mode
+    *
+    * @note     Mode applies to following "fm25_write()" and "fm25_writev()"
+    *           calls of device.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    verify  - Verify mode
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_set_verify(fm25_dev_t dev, const fm25_verify_t verify)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if ( verify > eFM25_VERIFY_CRC )
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            dev->verify = verify;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Verify device range against data
+    *
+    * @note     Per call verification, independent of device verify mode.
+    *           Memory needed is single chunk of "FM25_CFG_VERIFY_CHUNK_SIZE"
+    *           regardless of range size.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    addr    - Start address of range
+    * @param[in]    size    - Size of range in bytes
+    * @param[in]    p_data  - Pointer to expected data
+    * @param[in]    verify  - Verify mode
+    * @return       status  - "eFM25_ERROR_VERIFY" on mismatch
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_verify(fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, const fm25_verify_t verify)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        const bool is_lock = fm25_lock( dev );
+
+        if  (   ( false == is_lock )
+            ||  ( true == fm25_is_async_busy( dev )))
+        {
+            status = eFM25_ERROR_BUSY;
+        }
+        else if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if (   ( NULL == p_data )
+                ||  ( verify > eFM25_VERIFY_CRC )
+                ||  ( false == fm25_is_valid_range( dev, addr, size )))
+        {
+            status = eFM25_ERROR;
+        }
+        else if ( eFM25_VERIFY_NONE != verify )
+        {
+            status = fm25_verify_range( dev, addr, size, p_data, verify );
+        }
+        else
+        {
+            // Nothing to verify
+        }
+
+        if ( true == is_lock )
+        {
+            fm25_unlock( dev );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Get address of last verify mismatch
+    *
+    * @note     CRC mode has no byte position of mismatch and reports start
+    *           of verified range.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[out]   p_addr  - Address of first differing byte of last failed verify
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_get_verify_addr(fm25_dev_t dev, uint32_t * const p_addr)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if ( NULL == p_addr )
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            *p_addr = dev->verify_addr;
+        }
+
+        return status;
+    }
+
+#endif // ( 1 == FM25_CFG_VERIFY_EN )
+
+#if ( 1 == FM25_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Get device statistics
+    *
+    * @param[in]    dev     - Device handle
+    * @param[out]   p_stats - Pointer to statistics
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_get_stats(fm25_dev_t dev, fm25_stats_t * const p_stats)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if ( NULL == p_stats )
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            *p_stats = dev->stats;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Reset device statistics
+    *
+    * @param[in]    dev     - Device handle
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_reset_stats(fm25_dev_t dev)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else
+        {
+            dev->stats = (fm25_stats_t) { 0 };
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Serialize device statistics into text
+    *
+    * @note     Compact form for CLI, one line per group:
+    *
+    *           "op rd=R wr=W er=E sr=S"
+    *           "byte rd=R wr=W frm=F cs=C"
+    *           "err n=N bit=B0,B1,..,B7"
+    *           "lat rd=H0,H1,.. wr=.. er=.. sr=.."
+    *
+    *           Histograms are printed up to last non-empty bucket.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[out]   p_str   - Pointer to text buffer
+    * @param[in]    size    - Size of text buffer in bytes
+    * @return       status  - Status of operation, "eFM25_ERROR" if text was truncated
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_get_stats_str(fm25_dev_t dev, char * const p_str, const uint32_t size)
+    {
+        static const char * const   p_op_name[eFM25_STATS_OP_NUM] = { "rd", "wr", "er", "sr" };
+        fm25_status_t               status  = eFM25_OK;
+        uint32_t                    len     = 0U;
+        int                         num     = 0;
+
+        FM25_ASSERT( NULL != p_str );
+
+        if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if (   ( NULL == p_str )
+                ||  ( 0U == size ))
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            const fm25_stats_t * const p_stats = &dev->stats;
+
+            num = snprintf( p_str, size,
+                            "op rd=%lu wr=%lu er=%lu sr=%lu\r\n"
+                            "byte rd=%lu wr=%lu frm=%lu cs=%lu\r\n"
+                            "err n=%lu bit=",
+                            (unsigned long) p_stats->read, (unsigned long) p_stats->write, (unsigned long) p_stats->erase, (unsigned long) p_stats->status,
+                            (unsigned long) p_stats->rd_bytes, (unsigned long) p_stats->wr_bytes, (unsigned long) p_stats->frame_bytes, (unsigned long) p_stats->cs,
+                            (unsigned long) p_stats->err );
+            len = (uint32_t) num;
+
+            for ( uint32_t bit = 0U; ( bit < FM25_STATS_ERR_NUM ) && ( len < size ); bit++ )
+            {
+                num = snprintf( &p_str[len], ( size - len ), "%s%lu", (( 0U == bit ) ? "" : "," ), (unsigned long) p_stats->err_bit[bit] );
+                len += (uint32_t) num;
+            }
+
+            if ( len < size )
+            {
+                num = snprintf( &p_str[len], ( size - len ), "\r\nlat" );
+                len += (uint32_t) num;
+            }
+
+            for ( uint32_t op = 0U; ( op < eFM25_STATS_OP_NUM ) && ( len < size ); op++ )
+            {
+                uint32_t bucket_num = FM25_STATS_LAT_NUM;
+
+                // Skip empty tail of histogram
+                while   (   ( bucket_num > 1U )
+                        &&  ( 0U == p_stats->lat[op][bucket_num - 1U] ))
+                {
+                    bucket_num--;
+                }
+
+                num = snprintf( &p_str[len], ( size - len ), " %s=", p_op_name[op] );
+                len += (uint32_t) num;
+
+                for ( uint32_t bucket = 0U; ( bucket < bucket_num ) && ( len < size ); bucket++ )
+                {
+                    num = snprintf( &p_str[len], ( size - len ), "%s%lu", (( 0U == bucket ) ? "" : "," ), (unsigned long) p_stats->lat[op][bucket] );
+                    len += (uint32_t) num;
+                }
+            }
+
+            if ( len < size )
+            {
+                num = snprintf( &p_str[len], ( size - len ), "\r\n" );
+                len += (uint32_t) num;
+            }
+
+            // Text truncated
+            if ( len >= size )
+            {
+                status = eFM25_ERROR;
+            }
+        }
+
+        return status;
+    }
+
+#endif // ( 1 == FM25_CFG_STATS_EN )
+
+#if ( 1 == FM25_CFG_SLEEP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Run sleep governor
+    *
+    * @note     Puts device into sleep mode once it has been idle for
+    *           "sleep_idle" ticks. Call periodically, e.g. from idle task.
+    *           Parts without SLEEP command are never put to sleep.
+    *
+    * @param[in]    dev     - Device handle
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_sleep_process(fm25_dev_t dev)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        const bool is_lock = fm25_lock( dev );
+
+        if  (   ( false == is_lock )
+            ||  ( true == fm25_is_async_busy( dev )))
+        {
+            status = eFM25_ERROR_BUSY;
+        }
+        else if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if (   ( 0U != dev->sleep_idle )
+                &&  ( true == dev->info.sleep_en )
+                &&  ( eFM25_SLEEP_ON != dev->sleep_state ))
+        {
+            const uint32_t now  = dev->pf_get_tick();
+            const uint32_t idle = ( now - dev->sleep_tick );
+
+            // Wake-up started ahead but not followed by access must complete first
+            if  (   ( idle >= dev->sleep_idle )
+                &&  (   ( eFM25_SLEEP_OFF == dev->sleep_state )
+                    ||  ( idle > dev->wake_time )))
+            {
+                const uint8_t cmd = eFM25_ISA_SLEEP;
+
+                status = dev->p_if->pf_transmit( dev->p_if_ctx, &cmd, 1U, ( eFM25_CS_LOW_ON_ENTRY | eFM25_CS_HIGH_ON_EXIT ));
+
+                FM25_STATS_ADD( dev, frame_bytes, 1U );
+                FM25_STATS_ADD( dev, cs, 1U );
+
+                if ( eFM25_OK == status )
+                {
+                    dev->sleep_stats.sleep++;
+                    dev->sleep_tick  = now;
+                    dev->sleep_state = eFM25_SLEEP_ON;
+                }
+            }
+        }
+        else
+        {
+            // No actions...
+        }
+
+        if ( true == is_lock )
+        {
+            fm25_unlock( dev );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Start wake-up of device ahead of access
+    *
+    * @note     Does not wait for recovery time. Access following later
+    *           than recovery time after this call sees no wake-up latency.
+    *           Call it as soon as upcoming access is known.
+    *
+    *           Takes bus lock, shall not be called from interrupt context.
+    *
+    * @param[in]    dev     - Device handle
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_wake(fm25_dev_t dev)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        FM25_ASSERT( true == fm25_is_valid( dev ));
+
+        const bool is_lock = fm25_lock( dev );
+
+        if  (   ( false == is_lock )
+            ||  ( true == fm25_is_async_busy( dev )))
+        {
+            status = eFM25_ERROR_BUSY;
+        }
+        else if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if (   ( 0U != dev->sleep_idle )
+                &&  ( eFM25_SLEEP_ON == dev->sleep_state ))
+        {
+            status = fm25_wake_start( dev );
+        }
+        else
+        {
+            // No actions...
+        }
+
+        if ( true == is_lock )
+        {
+            fm25_unlock( dev );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Get sleep governor statistics
+    *
+    * @note     Sleep time includes sleep in progress. Residency is ratio
+    *           of "sleep_time" and "time".
+    *
+    * @param[in]    dev     - Device handle
+    * @param[out]   p_stats - Pointer to statistics
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_get_sleep_stats(fm25_dev_t dev, fm25_sleep_stats_t * const p_stats)
+    {
+        fm25_status_t status = eFM25_OK;
+
+        if ( false == fm25_is_valid( dev ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+        else if ( NULL == p_stats )
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            *p_stats = dev->sleep_stats;
+
+            if ( 0U != dev->sleep_idle )
+            {
+                const uint32_t now = dev->pf_get_tick();
+
+                if ( eFM25_SLEEP_ON == dev->sleep_state )
+                {
+                    p_stats->sleep_time += ( now - dev->sleep_tick );
+                }
+
+                p_stats->time = ( now - dev->open_tick );
+            }
+        }
+
+        return status;
+    }
+
+#endif // ( 1 == FM25_CFG_SLEEP_EN )
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
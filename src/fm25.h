@@ -8,7 +8,7 @@
 *@author    Ziga Miklosic
 *@email     ziga.miklosic@gmail.com
 *@date      14.11.2023
-*@version   V1.0.0
+*@version   V2.0.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -34,7 +34,7 @@
 /**
  *     Module version
  */
-#define FM25_VER_MAJOR      ( 1 )
+#define FM25_VER_MAJOR      ( 2 )
 #define FM25_VER_MINOR      ( 0 )
 #define FM25_VER_DEVELOP    ( 0 )
 
@@ -48,17 +48,281 @@ typedef enum
     eFM25_ERROR_SPI     = 0x02U,    /**<SPI error */
     eFM25_ERROR_INIT    = 0x04U,    /**<Initialisation error */
     eFM25_ERROR_ADDR    = 0x08U,    /**<Invalid memory address */
+    eFM25_ERROR_BUSY    = 0x10U,    /**<Device busy with asynchronous transfer */
+    eFM25_ERROR_SHADOW  = 0x20U,    /**<RAM shadow diverged from device */
+    eFM25_ERROR_VERIFY  = 0x40U,    /**<Read back differs from written data */
 } fm25_status_t;
 
+/**
+ *     Chip select action of interface transfer
+ */
+typedef enum
+{
+    eFM25_CS_NONE           = 0x00U,    /**<Leave chip select as is */
+    eFM25_CS_LOW_ON_ENTRY   = 0x01U,    /**<Assert chip select before transfer */
+    eFM25_CS_HIGH_ON_EXIT   = 0x02U,    /**<De-assert chip select after transfer */
+} fm25_cs_action_t;
+
+/**
+ *     Completion of non-blocking interface transfer
+ *
+ * @note    Called by interface layer from SPI/DMA completion interrupt.
+ */
+typedef void (*pf_fm25_if_done_t)(void * const p_arg, const fm25_status_t status);
+
+/**
+ *     Segment of single interface transfer
+ *
+ * @note    Exactly one of transmit or receive data is set.
+ */
+typedef struct
+{
+    const uint8_t *     p_tx;           /**<Transmit data, NULL for receive segment */
+    uint8_t *           p_rx;           /**<Receive data, NULL for transmit segment */
+    uint32_t            size;           /**<Size of segment in bytes */
+    fm25_cs_action_t    cs_action;      /**<Chip select action of segment */
+} fm25_if_seg_t;
+
+/**
+ *     Low level interface
+ *
+ * @note    Interface context is passed as is to each interface function
+ *          thus single implementation can serve multiple SPI buses or
+ *          chip selects.
+ *
+ *          Non-blocking start functions are optional (NULL when not
+ *          supported). They start transfer and return immediately,
+ *          completion is reported by calling "pf_done" with "p_arg".
+ *
+ *          Segmented transfer is optional (NULL when not supported). It
+ *          executes list of segments with their chip select actions as
+ *          single call, e.g. as one DMA descriptor chain. When supported
+ *          write enable, command frame and payload are passed at once.
+ *
+ *          Lock hooks are optional (NULL when not needed). Lock is held
+ *          across each complete transaction of synchronous API, e.g. RTOS
+ *          mutex shared by all devices on the same SPI bus. Lock returning
+ *          other than "eFM25_OK" (timeout) fails call with "eFM25_ERROR_BUSY".
+ *          Asynchronous request chain takes lock when it starts and releases
+ *          it from completion interrupt through "pf_unlock_isr" once all
+ *          queued requests are done, thus lock shall be releasable from
+ *          interrupt (e.g. binary semaphore). Without "pf_unlock_isr"
+ *          asynchronous requests are rejected on locked interface.
+ */
+typedef struct
+{
+    fm25_status_t (*pf_init)            (void * const p_ctx);
+    fm25_status_t (*pf_deinit)          (void * const p_ctx);
+    fm25_status_t (*pf_transmit)        (void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+    fm25_status_t (*pf_receive)         (void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action);
+    fm25_status_t (*pf_transmit_start)  (void * const p_ctx, const uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg);
+    fm25_status_t (*pf_receive_start)   (void * const p_ctx, uint8_t * const p_data, const uint32_t size, const fm25_cs_action_t cs_action, pf_fm25_if_done_t pf_done, void * const p_arg);
+    fm25_status_t (*pf_transfer_seg)    (void * const p_ctx, const fm25_if_seg_t * const p_seg, const uint32_t seg_num);
+    fm25_status_t (*pf_lock)            (void * const p_ctx);
+    void          (*pf_unlock)          (void * const p_ctx);
+    void          (*pf_unlock_isr)      (void * const p_ctx);
+} fm25_if_t;
+
+/**
+ *     Read command selection
+ */
+typedef enum
+{
+    eFM25_READ_AUTO     = 0U,   /**<FSTRD when SCK is above READ limit, otherwise READ */
+    eFM25_READ_NORMAL,          /**<Always READ */
+    eFM25_READ_FAST,            /**<Always FSTRD */
+} fm25_read_mode_t;
+
+/**
+ *     Verify-after-write mode
+ */
+typedef enum
+{
+    eFM25_VERIFY_NONE   = 0U,   /**<No verification */
+    eFM25_VERIFY_FULL,          /**<Read back and compare whole range */
+    eFM25_VERIFY_SAMPLED,       /**<Read back and compare "FM25_CFG_VERIFY_SAMPLE_NUM" chunks spread over range */
+    eFM25_VERIFY_CRC,           /**<Compare CRC of read back and written data */
+} fm25_verify_t;
+
+/**
+ *     Size of device ID and serial number
+ */
+#define FM25_ID_SIZE                    ( 9U )
+#define FM25_SN_SIZE                    ( 8U )
+
+/**
+ *     Device configuration
+ *
+ * @note    With runtime density ("FM25_CFG_ADDR_BIT_NUM" set to 0) and
+ *          "addr_bit_num" set to 0 density is detected from device ID.
+ */
+typedef struct
+{
+    const fm25_if_t *   p_if;           /**<Low level interface */
+    void *              p_if_ctx;       /**<Interface context */
+    uint8_t             addr_bit_num;   /**<Number of address bits (9-19), 0 for "FM25_CFG_ADDR_BIT_NUM" or auto-detect */
+    fm25_read_mode_t    read_mode;      /**<Read command selection */
+    uint32_t            sck_hz;         /**<SPI clock frequency, 0 if unknown */
+    uint32_t            read_max_hz;    /**<Maximum SPI clock of READ command, 0 for no limit */
+    uint8_t *           p_shadow;       /**<RAM shadow of whole memory array, NULL to disable */
+    uint32_t            shadow_size;    /**<Size of RAM shadow in bytes */
+    fm25_verify_t       verify;         /**<Verify-after-write mode of "fm25_write()" and "fm25_writev()" */
+    uint32_t            (*pf_get_tick)(void);   /**<Timestamp source of latency histograms and sleep governor, can be NULL without those */
+    uint32_t            sleep_idle;     /**<Idle time in ticks before sleep mode, 0 to disable sleep governor */
+    uint32_t            wake_time;      /**<Recovery time from sleep mode (tREC) in ticks */
+} fm25_dev_cfg_t;
+
+/**
+ *     Statistics operations
+ */
+typedef enum
+{
+    eFM25_STATS_READ = 0,       /**<Read */
+    eFM25_STATS_WRITE,          /**<Write, fill and copy */
+    eFM25_STATS_ERASE,          /**<Erase, payload counted as written bytes */
+    eFM25_STATS_STATUS,         /**<Status register read */
+
+    eFM25_STATS_OP_NUM
+} fm25_stats_op_t;
+
+/**
+ *     Number of latency histogram buckets
+ *
+ * @note    Bucket 0 counts latencies of 0 ticks, bucket n of 2^(n-1)
+ *          up to 2^n - 1 ticks. Last bucket collects all longer ones.
+ */
+#define FM25_STATS_LAT_NUM              ( 16U )
+
+/**
+ *     Number of error counters, one per "fm25_status_t" bit
+ */
+#define FM25_STATS_ERR_NUM              ( 8U )
+
+/**
+ *     Device statistics
+ */
+typedef struct
+{
+    uint32_t    read;                                       /**<Number of read operations */
+    uint32_t    write;                                      /**<Number of write operations */
+    uint32_t    erase;                                      /**<Number of erase operations */
+    uint32_t    status;                                     /**<Number of status register reads */
+    uint32_t    rd_bytes;                                   /**<Number of read payload bytes */
+    uint32_t    wr_bytes;                                   /**<Number of written payload bytes */
+    uint32_t    frame_bytes;                                /**<Number of framing bytes: opcode, address, WREN and RDSR */
+    uint32_t    cs;                                         /**<Number of chip select assertions */
+    uint32_t    err;                                        /**<Number of failed operations */
+    uint32_t    err_bit[FM25_STATS_ERR_NUM];                /**<Number of failed operations per status bit */
+    uint32_t    lat[eFM25_STATS_OP_NUM][FM25_STATS_LAT_NUM];  /**<Log2 latency histogram per operation */
+} fm25_stats_t;
+
+/**
+ *     Sleep governor statistics
+ *
+ * @note    Times are in ticks of "pf_get_tick".
+ */
+typedef struct
+{
+    uint32_t    sleep;          /**<Number of sleep mode entries */
+    uint32_t    wake;           /**<Number of wake-ups */
+    uint32_t    wake_hidden;    /**<Number of wake-ups completed before access */
+    uint32_t    wake_wait;      /**<Time accesses waited for recovery from sleep, added latency */
+    uint32_t    sleep_time;     /**<Time spent in sleep mode */
+    uint32_t    time;           /**<Time since open */
+} fm25_sleep_stats_t;
+
+/**
+ *     Device identification
+ */
+typedef struct
+{
+    const char *    p_name;                 /**<Part name, NULL for unknown part */
+    uint8_t         id[FM25_ID_SIZE];       /**<Device ID read by RDID */
+    uint8_t         sn[FM25_SN_SIZE];       /**<Serial number read by SNR */
+    uint8_t         addr_bit_num;           /**<Number of address bits */
+    bool            is_id;                  /**<Device ID is valid */
+    bool            is_sn;                  /**<Serial number is valid */
+    bool            fstrd_en;               /**<Part supports FSTRD command */
+    bool            sleep_en;               /**<Part supports SLEEP command */
+} fm25_dev_info_t;
+
+/**
+ *     Value of sequential fill pattern at given address
+ *
+ * @note    Each address bit affects value, thus stuck or shorted address
+ *          lines are detected by read back of "fm25_fill_seq()".
+ */
+#define FM25_SEQ_VALUE(addr)            ((uint8_t)(( addr ) ^ (( addr ) >> 8U ) ^ (( addr ) >> 16U )))
+
+/**
+ *     Vectored transfer segment
+ */
+typedef struct
+{
+    uint32_t    addr;           /**<Start address of segment */
+    uint32_t    size;           /**<Size of segment in bytes */
+    uint8_t *   p_data;         /**<Segment data */
+} fm25_iov_t;
+
+/**
+ *     Device handle
+ */
+typedef struct fm25_dev_s * fm25_dev_t;
+
+/**
+ *     Asynchronous request completion callback
+ */
+typedef void (*pf_fm25_async_cb_t)(fm25_dev_t dev, const fm25_status_t status, void * const p_arg);
+
+/**
+ *     Asynchronous request
+ *
+ * @note    Storage is provided by caller and must stay valid until
+ *          completion callback is called. Treat as opaque!
+ */
+typedef struct fm25_async_s
+{
+    struct fm25_async_s *   p_next;     /**<Next request in queue */
+    const uint8_t *         p_tx;       /**<Write data */
+    uint8_t *               p_rx;       /**<Read data */
+    uint32_t                addr;       /**<Start address */
+    uint32_t                size;       /**<Size of payload */
+    pf_fm25_async_cb_t      pf_cb;      /**<Completion callback */
+    void *                  p_arg;      /**<Callback argument */
+    uint32_t                tick;       /**<Submission timestamp */
+    uint8_t                 state;      /**<Transfer state */
+} fm25_async_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions Prototypes
 ////////////////////////////////////////////////////////////////////////////////
-fm25_status_t fm25_init     (void);
-fm25_status_t fm25_deinit   (void);
-fm25_status_t fm25_is_init  (bool * const p_is_init);
-fm25_status_t fm25_write    (const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
-fm25_status_t fm25_erase    (const uint32_t addr, const uint32_t size);
-fm25_status_t fm25_read     (const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+fm25_status_t fm25_open       (fm25_dev_t * const p_dev, const fm25_dev_cfg_t * const p_cfg);
+fm25_status_t fm25_close      (fm25_dev_t dev);
+fm25_status_t fm25_is_init    (fm25_dev_t dev, bool * const p_is_init);
+fm25_status_t fm25_get_size   (fm25_dev_t dev, uint32_t * const p_size);
+fm25_status_t fm25_get_info   (fm25_dev_t dev, fm25_dev_info_t * const p_info);
+fm25_status_t fm25_write      (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+fm25_status_t fm25_erase      (fm25_dev_t dev, const uint32_t addr, const uint32_t size);
+fm25_status_t fm25_fill       (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint32_t pattern, const uint8_t pattern_size);
+fm25_status_t fm25_fill_seq   (fm25_dev_t dev, const uint32_t addr, const uint32_t size);
+fm25_status_t fm25_copy       (fm25_dev_t dev, const uint32_t dst, const uint32_t src, const uint32_t size);
+fm25_status_t fm25_read       (fm25_dev_t dev, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+fm25_status_t fm25_writev     (fm25_dev_t dev, const fm25_iov_t * const p_iov, const uint32_t iov_num);
+fm25_status_t fm25_readv      (fm25_dev_t dev, const fm25_iov_t * const p_iov, const uint32_t iov_num);
+fm25_status_t fm25_write_async(fm25_dev_t dev, fm25_async_t * const p_req, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_fm25_async_cb_t pf_cb, void * const p_arg);
+fm25_status_t fm25_read_async (fm25_dev_t dev, fm25_async_t * const p_req, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_fm25_async_cb_t pf_cb, void * const p_arg);
+fm25_status_t fm25_is_busy    (fm25_dev_t dev, bool * const p_is_busy);
+fm25_status_t fm25_shadow_ptr (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t ** const pp_data);
+fm25_status_t fm25_shadow_check(fm25_dev_t dev, bool * const p_is_done);
+fm25_status_t fm25_set_verify (fm25_dev_t dev, const fm25_verify_t verify);
+fm25_status_t fm25_verify     (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, const fm25_verify_t verify);
+fm25_status_t fm25_get_verify_addr(fm25_dev_t dev, uint32_t * const p_addr);
+fm25_status_t fm25_get_stats  (fm25_dev_t dev, fm25_stats_t * const p_stats);
+fm25_status_t fm25_reset_stats(fm25_dev_t dev);
+fm25_status_t fm25_get_stats_str(fm25_dev_t dev, char * const p_str, const uint32_t size);
+fm25_status_t fm25_sleep_process(fm25_dev_t dev);
+fm25_status_t fm25_wake       (fm25_dev_t dev);
+fm25_status_t fm25_get_sleep_stats(fm25_dev_t dev, fm25_sleep_stats_t * const p_stats);
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -0,0 +1,302 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_bd.c
+*@brief     Block device adapter on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BD
+* @{ <!-- BEGIN GROUP -->
+*
+*     Maps block/offset addressing of littlefs or FatFS style filesystem
+*     to region of FM25 device. Callbacks have argument order of littlefs
+*     block device and return littlefs error codes; filesystem glue only
+*     passes its context.
+*
+*     Every callback is single read or write command and never crosses
+*     block boundary. Erase is no-op by default as FRAM cells are written
+*     in place.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_bd.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_bd_is_valid_access(const fm25_bd_t * const p_bd, const uint32_t block, const uint32_t off, const uint32_t size, const uint32_t unit);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check block device access
+*
+* @param[in]    p_bd        - Pointer to block device
+* @param[in]    block       - Block number
+* @param[in]    off         - Offset inside block
+* @param[in]    size        - Size of access in bytes
+* @param[in]    unit        - Access granularity in bytes
+* @return       is_valid    - True if access is aligned and inside block
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_bd_is_valid_access(const fm25_bd_t * const p_bd, const uint32_t block, const uint32_t off, const uint32_t size, const uint32_t unit)
+{
+    return  (   ( NULL != p_bd )
+            &&  ( true == p_bd->is_init )
+            &&  ( block < p_bd->cfg.block_num )
+            &&  ( size > 0U )
+            &&  ( off < p_bd->cfg.block_size )
+            &&  ( size <= ( p_bd->cfg.block_size - off ))
+            &&  ( 0U == ( off % unit ))
+            &&  ( 0U == ( size % unit )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BD
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 block device API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Initialize block device
+*
+* @note     Block size must be multiple of read and program size. With
+*           "block_num" of 0 region spans from "addr" to end of device.
+*
+* @param[out]   p_bd    - Pointer to block device
+* @param[in]    p_cfg   - Pointer to configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bd_init(fm25_bd_t * const p_bd, const fm25_bd_cfg_t * const p_cfg)
+{
+    fm25_status_t   status      = eFM25_OK;
+    uint32_t        mem_size    = 0U;
+
+    FM25_ASSERT( NULL != p_bd );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_bd )
+        ||  ( NULL == p_cfg )
+        ||  ( eFM25_OK != fm25_get_size( p_cfg->dev, &mem_size ))
+        ||  ( p_cfg->addr >= mem_size )
+        ||  ( 0U == p_cfg->block_size )
+        ||  ( 0U == p_cfg->read_size )
+        ||  ( 0U == p_cfg->prog_size )
+        ||  ( 0U != ( p_cfg->block_size % p_cfg->read_size ))
+        ||  ( 0U != ( p_cfg->block_size % p_cfg->prog_size ))
+        ||  ( p_cfg->erase > eFM25_BD_ERASE_FILL ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        const uint32_t block_max = (( mem_size - p_cfg->addr ) / p_cfg->block_size );
+
+        if  (   ( 0U == block_max )
+            ||  ( p_cfg->block_num > block_max ))
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            p_bd->cfg       = *p_cfg;
+            p_bd->is_init   = true;
+
+            if ( 0U == p_bd->cfg.block_num )
+            {
+                p_bd->cfg.block_num = block_max;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get number of blocks
+*
+* @param[in]    p_bd        - Pointer to block device
+* @param[out]   p_block_num - Number of blocks
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bd_get_block_num(const fm25_bd_t * const p_bd, uint32_t * const p_block_num)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if  (   ( NULL == p_bd )
+        ||  ( false == p_bd->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_block_num )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        *p_block_num = p_bd->cfg.block_num;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read from block
+*
+* @param[in]    p_bd    - Pointer to block device
+* @param[in]    block   - Block number
+* @param[in]    off     - Offset inside block, multiple of read size
+* @param[out]   p_buf   - Pointer to read data
+* @param[in]    size    - Size of read in bytes, multiple of read size
+* @return       err     - "FM25_BD_OK", "FM25_BD_ERR_INVAL" or "FM25_BD_ERR_IO"
+*/
+////////////////////////////////////////////////////////////////////////////////
+int fm25_bd_read(fm25_bd_t * const p_bd, const uint32_t block, const uint32_t off, void * const p_buf, const uint32_t size)
+{
+    int err = FM25_BD_OK;
+
+    if  (   ( NULL == p_buf )
+        ||  ( false == fm25_bd_is_valid_access( p_bd, block, off, size, (( NULL != p_bd ) ? p_bd->cfg.read_size : 1U ))))
+    {
+        err = FM25_BD_ERR_INVAL;
+    }
+    else if ( eFM25_OK != fm25_read( p_bd->cfg.dev, ( p_bd->cfg.addr + ( block * p_bd->cfg.block_size ) + off ), size, (uint8_t*) p_buf ))
+    {
+        err = FM25_BD_ERR_IO;
+    }
+    else
+    {
+        // No actions...
+    }
+
+    return err;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Program block
+*
+* @param[in]    p_bd    - Pointer to block device
+* @param[in]    block   - Block number
+* @param[in]    off     - Offset inside block, multiple of program size
+* @param[in]    p_buf   - Pointer to program data
+* @param[in]    size    - Size of program in bytes, multiple of program size
+* @return       err     - "FM25_BD_OK", "FM25_BD_ERR_INVAL" or "FM25_BD_ERR_IO"
+*/
+////////////////////////////////////////////////////////////////////////////////
+int fm25_bd_prog(fm25_bd_t * const p_bd, const uint32_t block, const uint32_t off, const void * const p_buf, const uint32_t size)
+{
+    int err = FM25_BD_OK;
+
+    if  (   ( NULL == p_buf )
+        ||  ( false == fm25_bd_is_valid_access( p_bd, block, off, size, (( NULL != p_bd ) ? p_bd->cfg.prog_size : 1U ))))
+    {
+        err = FM25_BD_ERR_INVAL;
+    }
+    else if ( eFM25_OK != fm25_write( p_bd->cfg.dev, ( p_bd->cfg.addr + ( block * p_bd->cfg.block_size ) + off ), size, (const uint8_t*) p_buf ))
+    {
+        err = FM25_BD_ERR_IO;
+    }
+    else
+    {
+        // No actions...
+    }
+
+    return err;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Erase block
+*
+* @note     No-op with "eFM25_BD_ERASE_NONE", otherwise block is filled
+*           with erase value by single write command.
+*
+* @param[in]    p_bd    - Pointer to block device
+* @param[in]    block   - Block number
+* @return       err     - "FM25_BD_OK", "FM25_BD_ERR_INVAL" or "FM25_BD_ERR_IO"
+*/
+////////////////////////////////////////////////////////////////////////////////
+int fm25_bd_erase(fm25_bd_t * const p_bd, const uint32_t block)
+{
+    int err = FM25_BD_OK;
+
+    if ( false == fm25_bd_is_valid_access( p_bd, block, 0U, (( NULL != p_bd ) ? p_bd->cfg.block_size : 0U ), 1U ))
+    {
+        err = FM25_BD_ERR_INVAL;
+    }
+    else if (   ( eFM25_BD_ERASE_FILL == p_bd->cfg.erase )
+            &&  ( eFM25_OK != fm25_erase( p_bd->cfg.dev, ( p_bd->cfg.addr + ( block * p_bd->cfg.block_size )), p_bd->cfg.block_size )))
+    {
+        err = FM25_BD_ERR_IO;
+    }
+    else
+    {
+        // No actions...
+    }
+
+    return err;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Sync block device
+*
+* @note     FRAM write is non-volatile at end of write command, thus there
+*           is nothing to sync.
+*
+* @param[in]    p_bd    - Pointer to block device
+* @return       err     - "FM25_BD_OK" or "FM25_BD_ERR_INVAL"
+*/
+////////////////////////////////////////////////////////////////////////////////
+int fm25_bd_sync(fm25_bd_t * const p_bd)
+{
+    int err = FM25_BD_OK;
+
+    if  (   ( NULL == p_bd )
+        ||  ( false == p_bd->is_init ))
+    {
+        err = FM25_BD_ERR_INVAL;
+    }
+
+    return err;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
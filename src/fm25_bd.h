@@ -0,0 +1,100 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_bd.h
+*@brief     Block device adapter on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BD
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_BD_H_
+#define FM25_BD_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Block device callback results
+ *
+ * @note    Values match "LFS_ERR_IO" and "LFS_ERR_INVAL" of littlefs,
+ *          thus results can be returned to filesystem as they are.
+ */
+#define FM25_BD_OK                      ( 0 )
+#define FM25_BD_ERR_IO                  ( -5 )
+#define FM25_BD_ERR_INVAL               ( -22 )
+
+/**
+ *     Erase modes
+ */
+typedef enum
+{
+    eFM25_BD_ERASE_NONE = 0,    /**<Erase is no-op, FRAM has no erase-before-write */
+    eFM25_BD_ERASE_FILL,        /**<Erase fills block with erase value by single write command */
+} fm25_bd_erase_t;
+
+/**
+ *     Block device configuration
+ *
+ * @note    FRAM is byte addressable, thus read and program sizes of 1
+ *          are valid. Each callback is single device command, hence
+ *          filesystem cache of whole block programs block by single
+ *          SPI transaction.
+ */
+typedef struct
+{
+    fm25_dev_t          dev;            /**<Device handle */
+    uint32_t            addr;           /**<Start address of block device region */
+    uint32_t            block_size;     /**<Size of block in bytes */
+    uint32_t            block_num;      /**<Number of blocks, 0 for rest of device */
+    uint32_t            read_size;      /**<Read granularity in bytes */
+    uint32_t            prog_size;      /**<Program granularity in bytes */
+    fm25_bd_erase_t     erase;          /**<Erase mode */
+} fm25_bd_cfg_t;
+
+/**
+ *     Block device
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_bd_cfg_t   cfg;        /**<Configuration */
+    bool            is_init;    /**<Initialization guard */
+} fm25_bd_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t   fm25_bd_init            (fm25_bd_t * const p_bd, const fm25_bd_cfg_t * const p_cfg);
+fm25_status_t   fm25_bd_get_block_num   (const fm25_bd_t * const p_bd, uint32_t * const p_block_num);
+int             fm25_bd_read            (fm25_bd_t * const p_bd, const uint32_t block, const uint32_t off, void * const p_buf, const uint32_t size);
+int             fm25_bd_prog            (fm25_bd_t * const p_bd, const uint32_t block, const uint32_t off, const void * const p_buf, const uint32_t size);
+int             fm25_bd_erase           (fm25_bd_t * const p_bd, const uint32_t block);
+int             fm25_bd_sync            (fm25_bd_t * const p_bd);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_BD_H_
@@ -0,0 +1,434 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_bitmap.c
+*@brief     Bitmap allocator on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BITMAP
+* @{ <!-- BEGIN GROUP -->
+*
+*     One bit per allocation unit, cleared bit marks allocated unit, so
+*     bitmap erased by "fm25_erase()" has all units free. Unit n is bit
+*     (n % 8) of byte (n / 8).
+*
+*     Allocation and release write single byte holding the bit, thus
+*     update is never torn. With RAM mirror search and bit test cost no
+*     device access, otherwise bitmap is scanned by chunks and release
+*     reads byte before writing it.
+*
+*     Search continues from byte of last allocation or lowest release,
+*     so allocated prefix is not rescanned.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_bitmap.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of stack buffer for search without mirror in bytes
+ */
+#define FM25_BITMAP_CHUNK_SIZE          ( 32U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static bool             fm25_bitmap_is_valid_cfg(const fm25_bitmap_cfg_t * const p_cfg);
+static uint8_t          fm25_bitmap_pad         (const fm25_bitmap_t * const p_bitmap, const uint32_t idx);
+static fm25_status_t    fm25_bitmap_scan        (fm25_bitmap_t * const p_bitmap, const uint32_t start, const uint32_t end, uint32_t * const p_idx, uint8_t * const p_byte);
+static fm25_status_t    fm25_bitmap_get_byte    (fm25_bitmap_t * const p_bitmap, const uint32_t idx, uint8_t * const p_byte);
+static fm25_status_t    fm25_bitmap_set_byte    (fm25_bitmap_t * const p_bitmap, const uint32_t idx, const uint8_t byte);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check bitmap configuration
+*
+* @param[in]    p_cfg       - Pointer to bitmap configuration
+* @return       is_valid    - True if bitmap fits into device
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_bitmap_is_valid_cfg(const fm25_bitmap_cfg_t * const p_cfg)
+{
+    uint32_t mem_size = 0U;
+
+    return  (   ( NULL != p_cfg )
+            &&  ( eFM25_OK == fm25_get_size( p_cfg->dev, &mem_size ))
+            &&  ( p_cfg->bit_num > 0U )
+            &&  ( p_cfg->addr < mem_size )
+            &&  ( FM25_BITMAP_SIZE( p_cfg->bit_num ) <= ( mem_size - p_cfg->addr )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get padding bits of bitmap byte
+*
+* @param[in]    p_bitmap    - Pointer to bitmap
+* @param[in]    idx         - Byte index
+* @return       pad         - Bits past last unit, never free
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t fm25_bitmap_pad(const fm25_bitmap_t * const p_bitmap, const uint32_t idx)
+{
+    uint8_t pad = 0U;
+
+    if  (   (( idx + 1U ) == FM25_BITMAP_SIZE( p_bitmap->cfg.bit_num ))
+        &&  ( 0U != ( p_bitmap->cfg.bit_num % 8U )))
+    {
+        pad = (uint8_t)( 0xFFU << ( p_bitmap->cfg.bit_num % 8U ));
+    }
+
+    return pad;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Find byte with free unit
+*
+* @param[in]    p_bitmap    - Pointer to bitmap
+* @param[in]    start       - First byte to check
+* @param[in]    end         - Byte after last one to check
+* @param[out]   p_idx       - Index of byte with free unit, "end" if none
+* @param[out]   p_byte      - Value of that byte
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bitmap_scan(fm25_bitmap_t * const p_bitmap, const uint32_t start, const uint32_t end, uint32_t * const p_idx, uint8_t * const p_byte)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        idx     = start;
+    bool            is_free = false;
+    uint8_t         chunk[FM25_BITMAP_CHUNK_SIZE];
+
+    while   (   ( false == is_free )
+            &&  ( idx < end )
+            &&  ( eFM25_OK == status ))
+    {
+        const uint32_t  num     = (( end - idx ) > FM25_BITMAP_CHUNK_SIZE ) ? FM25_BITMAP_CHUNK_SIZE : ( end - idx );
+        const uint8_t * p_data  = NULL;
+        uint32_t        i       = 0U;
+
+        if ( NULL != p_bitmap->cfg.p_mirror )
+        {
+            p_data = &p_bitmap->cfg.p_mirror[idx];
+        }
+        else
+        {
+            status  = fm25_read( p_bitmap->cfg.dev, ( p_bitmap->cfg.addr + idx ), num, chunk );
+            p_data  = chunk;
+        }
+
+        while   (   ( eFM25_OK == status )
+                &&  ( false == is_free )
+                &&  ( i < num ))
+        {
+            if ( 0U != ( p_data[i] & (uint8_t) ~fm25_bitmap_pad( p_bitmap, ( idx + i ))))
+            {
+                *p_byte = p_data[i];
+                is_free = true;
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        idx += i;
+    }
+
+    *p_idx = idx;
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get bitmap byte
+*
+* @param[in]    p_bitmap    - Pointer to bitmap
+* @param[in]    idx         - Byte index
+* @param[out]   p_byte      - Value of byte
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bitmap_get_byte(fm25_bitmap_t * const p_bitmap, const uint32_t idx, uint8_t * const p_byte)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if ( NULL != p_bitmap->cfg.p_mirror )
+    {
+        *p_byte = p_bitmap->cfg.p_mirror[idx];
+    }
+    else
+    {
+        status = fm25_read( p_bitmap->cfg.dev, ( p_bitmap->cfg.addr + idx ), 1U, p_byte );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write bitmap byte
+*
+* @note     Mirror is updated only after successful write.
+*
+* @param[in]    p_bitmap    - Pointer to bitmap
+* @param[in]    idx         - Byte index
+* @param[in]    byte        - Value of byte
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_bitmap_set_byte(fm25_bitmap_t * const p_bitmap, const uint32_t idx, const uint8_t byte)
+{
+    fm25_status_t status = eFM25_OK;
+
+    status = fm25_write( p_bitmap->cfg.dev, ( p_bitmap->cfg.addr + idx ), 1U, &byte );
+
+    if  (   ( eFM25_OK == status )
+        &&  ( NULL != p_bitmap->cfg.p_mirror ))
+    {
+        p_bitmap->cfg.p_mirror[idx] = byte;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BITMAP
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 bitmap API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Initialize bitmap
+*
+* @note     Bitmap content is kept, release all units by "fm25_erase()"
+*           of bitmap region before first use. Mirror is loaded by single read command.
+*
+* @param[out]   p_bitmap    - Pointer to bitmap
+* @param[in]    p_cfg       - Pointer to bitmap configuration
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bitmap_init(fm25_bitmap_t * const p_bitmap, const fm25_bitmap_cfg_t * const p_cfg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    FM25_ASSERT( NULL != p_bitmap );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_bitmap )
+        ||  ( false == fm25_bitmap_is_valid_cfg( p_cfg )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        memset( p_bitmap, 0, sizeof( fm25_bitmap_t ));
+
+        p_bitmap->cfg = *p_cfg;
+
+        if ( NULL != p_cfg->p_mirror )
+        {
+            status = fm25_read( p_cfg->dev, p_cfg->addr, FM25_BITMAP_SIZE( p_cfg->bit_num ), p_cfg->p_mirror );
+        }
+
+        p_bitmap->is_init = ( eFM25_OK == status );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Allocate unit
+*
+* @note     Costs single byte write, plus scan of bitmap chunks without
+*           mirror.
+*
+* @param[in]    p_bitmap    - Pointer to bitmap
+* @param[out]   p_bit       - Allocated unit
+* @return       status      - Status of operation, "eFM25_ERROR" if bitmap is full
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bitmap_alloc(fm25_bitmap_t * const p_bitmap, uint32_t * const p_bit)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        idx     = 0U;
+    uint8_t         byte    = 0U;
+
+    if (( NULL == p_bitmap ) || ( false == p_bitmap->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_bit )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        const uint32_t size = FM25_BITMAP_SIZE( p_bitmap->cfg.bit_num );
+
+        status = fm25_bitmap_scan( p_bitmap, p_bitmap->hint, size, &idx, &byte );
+
+        // Wrap around
+        if  (   ( eFM25_OK == status )
+            &&  ( idx >= size ))
+        {
+            status = fm25_bitmap_scan( p_bitmap, 0U, p_bitmap->hint, &idx, &byte );
+            idx    = ( idx < p_bitmap->hint ) ? idx : size;
+        }
+
+        if  (   ( eFM25_OK == status )
+            &&  ( idx >= size ))
+        {
+            status = eFM25_ERROR;
+        }
+
+        if ( eFM25_OK == status )
+        {
+            const uint8_t   avail   = ( byte & (uint8_t) ~fm25_bitmap_pad( p_bitmap, idx ));
+            uint8_t         bit     = 0U;
+
+            while ( 0U == ( avail & ( 1U << bit )))
+            {
+                bit++;
+            }
+
+            status = fm25_bitmap_set_byte( p_bitmap, idx, (uint8_t)( byte & ~( 1U << bit )));
+
+            if ( eFM25_OK == status )
+            {
+                p_bitmap->hint  = idx;
+                *p_bit          = (( idx * 8U ) + bit );
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Release unit
+*
+* @note     Costs single byte write, plus single byte read without mirror.
+*
+* @param[in]    p_bitmap    - Pointer to bitmap
+* @param[in]    bit         - Unit to release
+* @return       status      - Status of operation, "eFM25_ERROR" if unit is not allocated
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bitmap_free(fm25_bitmap_t * const p_bitmap, const uint32_t bit)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint8_t         byte    = 0U;
+
+    if (( NULL == p_bitmap ) || ( false == p_bitmap->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( bit >= p_bitmap->cfg.bit_num )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        const uint32_t  idx     = ( bit / 8U );
+        const uint8_t   mask    = (uint8_t)( 1U << ( bit % 8U ));
+
+        status = fm25_bitmap_get_byte( p_bitmap, idx, &byte );
+
+        // Double release
+        if  (   ( eFM25_OK == status )
+            &&  ( 0U != ( byte & mask )))
+        {
+            status = eFM25_ERROR;
+        }
+
+        if ( eFM25_OK == status )
+        {
+            status = fm25_bitmap_set_byte( p_bitmap, idx, (uint8_t)( byte | mask ));
+        }
+
+        if  (   ( eFM25_OK == status )
+            &&  ( idx < p_bitmap->hint ))
+        {
+            p_bitmap->hint = idx;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check if unit is allocated
+*
+* @param[in]    p_bitmap    - Pointer to bitmap
+* @param[in]    bit         - Unit to check
+* @param[out]   p_is_set    - True if unit is allocated
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bitmap_is_set(fm25_bitmap_t * const p_bitmap, const uint32_t bit, bool * const p_is_set)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint8_t         byte    = 0U;
+
+    if (( NULL == p_bitmap ) || ( false == p_bitmap->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( bit >= p_bitmap->cfg.bit_num ) || ( NULL == p_is_set ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_bitmap_get_byte( p_bitmap, ( bit / 8U ), &byte );
+
+        *p_is_set = ( 0U == ( byte & ( 1U << ( bit % 8U ))));
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,77 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_bitmap.h
+*@brief     Bitmap allocator on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BITMAP
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_BITMAP_H_
+#define FM25_BITMAP_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of bitmap in bytes
+ */
+#define FM25_BITMAP_SIZE(bit_num)       ((( bit_num ) + 7U ) / 8U )
+
+/**
+ *     Bitmap configuration
+ */
+typedef struct
+{
+    fm25_dev_t  dev;            /**<Device handle */
+    uint32_t    addr;           /**<Device address of bitmap */
+    uint32_t    bit_num;        /**<Number of allocation units */
+    uint8_t *   p_mirror;       /**<RAM mirror of "FM25_BITMAP_SIZE(bit_num)" bytes, or NULL */
+} fm25_bitmap_cfg_t;
+
+/**
+ *     Bitmap
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_bitmap_cfg_t   cfg;        /**<Configuration */
+    uint32_t            hint;       /**<Byte to start free bit search from */
+    bool                is_init;    /**<Init guard */
+} fm25_bitmap_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_bitmap_init      (fm25_bitmap_t * const p_bitmap, const fm25_bitmap_cfg_t * const p_cfg);
+fm25_status_t fm25_bitmap_alloc     (fm25_bitmap_t * const p_bitmap, uint32_t * const p_bit);
+fm25_status_t fm25_bitmap_free      (fm25_bitmap_t * const p_bitmap, const uint32_t bit);
+fm25_status_t fm25_bitmap_is_set    (fm25_bitmap_t * const p_bitmap, const uint32_t bit, bool * const p_is_set);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_BITMAP_H_
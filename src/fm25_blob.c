@@ -0,0 +1,433 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_blob.c
+*@brief     Atomic A/B blob on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BLOB
+* @{ <!-- BEGIN GROUP -->
+*
+*     Blob region holds single byte sequence marker and two slots. Slot
+*     with parity of its sequence number is written by commit, thus new
+*     blob always goes into slot other than current one.
+*
+*     Commit writes slot header and blob as single vectored write and
+*     then sets marker to new sequence number. Marker write is the
+*     commit point, torn slot write leaves current blob selected.
+*
+*     Open selects slot pointed by marker if its CRC is valid, otherwise
+*     falls back to other valid slot. Slot CRC is checked by streaming
+*     slot through small stack buffer.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_blob.h"
+#include "fm25_crc.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of stack buffer for slot check in bytes
+ */
+#define FM25_BLOB_CHUNK_SIZE            ( 64U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t         fm25_blob_slot_addr (const fm25_blob_t * const p_blob, const uint8_t slot);
+static uint32_t         fm25_blob_hdr_crc   (const fm25_blob_hdr_t * const p_hdr);
+static bool             fm25_blob_is_valid_cfg(const fm25_blob_cfg_t * const p_cfg);
+static fm25_status_t    fm25_blob_check_slot(fm25_blob_t * const p_blob, const uint8_t slot, bool * const p_is_valid);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get address of slot header
+*
+* @param[in]    p_blob  - Pointer to blob
+* @param[in]    slot    - Slot number, 0 or 1
+* @return       addr    - Device address of slot header
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_blob_slot_addr(const fm25_blob_t * const p_blob, const uint8_t slot)
+{
+    return ( p_blob->cfg.addr + 1U + ( slot * ( FM25_BLOB_HDR_SIZE + p_blob->cfg.size )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Start CRC of slot with header fields
+*
+* @param[in]    p_hdr   - Pointer to slot header
+* @return       crc     - CRC-32 of size and sequence number
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_blob_hdr_crc(const fm25_blob_hdr_t * const p_hdr)
+{
+    uint32_t crc = FM25_CRC32_INIT;
+
+    crc = fm25_crc32( crc, (const uint8_t*) &p_hdr->size, sizeof( p_hdr->size ));
+    crc = fm25_crc32( crc, &p_hdr->seq, sizeof( p_hdr->seq ));
+
+    return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check blob configuration
+*
+* @param[in]    p_cfg       - Pointer to blob configuration
+* @return       is_valid    - True if blob region fits into device
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_blob_is_valid_cfg(const fm25_blob_cfg_t * const p_cfg)
+{
+    uint32_t mem_size = 0U;
+
+    return  (   ( NULL != p_cfg )
+            &&  ( eFM25_OK == fm25_get_size( p_cfg->dev, &mem_size ))
+            &&  ( p_cfg->size > 0U )
+            &&  ( p_cfg->addr < mem_size )
+            &&  ( p_cfg->size < ( mem_size / 2U ))
+            &&  ( FM25_BLOB_REGION_SIZE( p_cfg->size ) <= ( mem_size - p_cfg->addr )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check CRC of slot
+*
+* @note     Blob is streamed through stack buffer of "FM25_BLOB_CHUNK_SIZE".
+*
+* @param[in]    p_blob      - Pointer to blob with slot header loaded
+* @param[in]    slot        - Slot number, 0 or 1
+* @param[out]   p_is_valid  - True if slot holds complete blob
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_blob_check_slot(fm25_blob_t * const p_blob, const uint8_t slot, bool * const p_is_valid)
+{
+    fm25_status_t           status  = eFM25_OK;
+    const fm25_blob_hdr_t * p_hdr   = &p_blob->hdr[slot];
+    const uint32_t          addr    = ( fm25_blob_slot_addr( p_blob, slot ) + FM25_BLOB_HDR_SIZE );
+    uint32_t                crc     = fm25_blob_hdr_crc( p_hdr );
+    uint32_t                done    = 0U;
+    uint8_t                 chunk[FM25_BLOB_CHUNK_SIZE];
+
+    *p_is_valid = ( p_hdr->size <= p_blob->cfg.size );
+
+    while   (   ( true == *p_is_valid )
+            &&  ( done < p_hdr->size )
+            &&  ( eFM25_OK == status ))
+    {
+        const uint32_t num = (( p_hdr->size - done ) > FM25_BLOB_CHUNK_SIZE ) ? FM25_BLOB_CHUNK_SIZE : ( p_hdr->size - done );
+
+        status = fm25_read( p_blob->cfg.dev, ( addr + done ), num, chunk );
+
+        crc     = fm25_crc32( crc, chunk, num );
+        done   += num;
+    }
+
+    *p_is_valid = (( true == *p_is_valid ) && ( eFM25_OK == status ) && ( crc == p_hdr->crc ));
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BLOB
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 blob API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Open blob and select newest valid slot
+*
+* @note     Blank region opens without blob.
+*
+* @param[out]   p_blob  - Pointer to blob
+* @param[in]    p_cfg   - Pointer to blob configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_blob_open(fm25_blob_t * const p_blob, const fm25_blob_cfg_t * const p_cfg)
+{
+    fm25_status_t   status      = eFM25_OK;
+    bool            is_valid[2] = { false, false };
+
+    FM25_ASSERT( NULL != p_blob );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_blob )
+        ||  ( false == fm25_blob_is_valid_cfg( p_cfg )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        memset( p_blob, 0, sizeof( fm25_blob_t ));
+
+        p_blob->cfg = *p_cfg;
+
+        const fm25_iov_t iov[3] =
+        {
+            { .addr = p_cfg->addr, .size = 1U, .p_data = &p_blob->seq },
+            { .addr = fm25_blob_slot_addr( p_blob, 0U ), .size = FM25_BLOB_HDR_SIZE, .p_data = (uint8_t*) &p_blob->hdr[0] },
+            { .addr = fm25_blob_slot_addr( p_blob, 1U ), .size = FM25_BLOB_HDR_SIZE, .p_data = (uint8_t*) &p_blob->hdr[1] },
+        };
+
+        status = fm25_readv( p_cfg->dev, iov, 3U );
+
+        for ( uint8_t slot = 0U; ( slot < 2U ) && ( eFM25_OK == status ); slot++ )
+        {
+            status = fm25_blob_check_slot( p_blob, slot, &is_valid[slot] );
+        }
+
+        if ( eFM25_OK == status )
+        {
+            const uint8_t marked = ( p_blob->seq & 1U );
+
+            if  (   ( true == is_valid[marked] )
+                &&  ( p_blob->seq == p_blob->hdr[marked].seq ))
+            {
+                p_blob->active  = marked;
+                p_blob->is_blob = true;
+            }
+
+            // Marked slot damaged, previous blob is used
+            else if ( true == is_valid[marked ^ 1U] )
+            {
+                p_blob->active  = ( marked ^ 1U );
+                p_blob->is_blob = true;
+            }
+            else
+            {
+                p_blob->is_blob = false;
+            }
+
+            p_blob->is_open = true;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Commit new blob
+*
+* @note     Costs single vectored write of slot header and blob followed
+*           by single byte write of sequence marker.
+*
+* @param[in]    p_blob  - Pointer to blob
+* @param[in]    p_data  - Pointer to blob data
+* @param[in]    size    - Size of blob in bytes
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_blob_commit(fm25_blob_t * const p_blob, const uint8_t * const p_data, const uint32_t size)
+{
+    fm25_status_t   status  = eFM25_OK;
+    fm25_blob_hdr_t hdr     = { 0 };
+    uint8_t         slot    = 0U;
+
+    if (( NULL == p_blob ) || ( false == p_blob->is_open ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_data ) || ( size > p_blob->cfg.size ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        hdr.size    = size;
+        hdr.seq     = (uint8_t)((( true == p_blob->is_blob ) ? p_blob->hdr[p_blob->active].seq : p_blob->seq ) + 1U );
+        hdr.crc     = fm25_crc32( fm25_blob_hdr_crc( &hdr ), p_data, size );
+        slot        = ( hdr.seq & 1U );
+
+        // NOTE: Vectored write does not modify data
+        const fm25_iov_t iov[2] =
+        {
+            { .addr = fm25_blob_slot_addr( p_blob, slot ), .size = FM25_BLOB_HDR_SIZE, .p_data = (uint8_t*) &hdr },
+            { .addr = ( fm25_blob_slot_addr( p_blob, slot ) + FM25_BLOB_HDR_SIZE ), .size = size, .p_data = (uint8_t*) p_data },
+        };
+
+        status = fm25_writev( p_blob->cfg.dev, iov, (( size > 0U ) ? 2U : 1U ));
+
+        // Commit point
+        if ( eFM25_OK == status )
+        {
+            status = fm25_write( p_blob->cfg.dev, p_blob->cfg.addr, 1U, &hdr.seq );
+        }
+
+        if ( eFM25_OK == status )
+        {
+            p_blob->hdr[slot]   = hdr;
+            p_blob->seq         = hdr.seq;
+            p_blob->active      = slot;
+            p_blob->is_blob     = true;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Load current blob
+*
+* @note     Blob is read into caller buffer and its CRC checked again.
+*
+* @param[in]    p_blob      - Pointer to blob
+* @param[out]   p_data      - Pointer to blob buffer
+* @param[in]    buf_size    - Size of blob buffer in bytes
+* @param[out]   p_size      - Size of blob, 0 if there is no blob
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_blob_load(fm25_blob_t * const p_blob, uint8_t * const p_data, const uint32_t buf_size, uint32_t * const p_size)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_blob ) || ( false == p_blob->is_open ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_data ) || ( NULL == p_size ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        const fm25_blob_hdr_t * p_hdr = &p_blob->hdr[p_blob->active];
+
+        *p_size = 0U;
+
+        if ( true == p_blob->is_blob )
+        {
+            if ( p_hdr->size > buf_size )
+            {
+                status = eFM25_ERROR;
+            }
+            else
+            {
+                status = fm25_read( p_blob->cfg.dev, ( fm25_blob_slot_addr( p_blob, p_blob->active ) + FM25_BLOB_HDR_SIZE ), p_hdr->size, p_data );
+
+                if  (   ( eFM25_OK == status )
+                    &&  ( fm25_crc32( fm25_blob_hdr_crc( p_hdr ), p_data, p_hdr->size ) != p_hdr->crc ))
+                {
+                    status = eFM25_ERROR;
+                }
+            }
+
+            if ( eFM25_OK == status )
+            {
+                *p_size = p_hdr->size;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read part of current blob
+*
+* @note     Blob CRC is checked at open, part is read without check.
+*
+* @param[in]    p_blob  - Pointer to blob
+* @param[in]    offset  - Offset inside blob
+* @param[in]    size    - Number of bytes to read
+* @param[out]   p_data  - Pointer to read data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_blob_read(fm25_blob_t * const p_blob, const uint32_t offset, const uint32_t size, uint8_t * const p_data)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_blob ) || ( false == p_blob->is_open ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (   ( NULL == p_data )
+            ||  ( false == p_blob->is_blob )
+            ||  ( offset > p_blob->hdr[p_blob->active].size )
+            ||  ( size > ( p_blob->hdr[p_blob->active].size - offset )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_read( p_blob->cfg.dev, ( fm25_blob_slot_addr( p_blob, p_blob->active ) + FM25_BLOB_HDR_SIZE + offset ), size, p_data );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get size of current blob
+*
+* @param[in]    p_blob  - Pointer to blob
+* @param[out]   p_size  - Size of blob in bytes, 0 if there is no blob
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_blob_get_size(const fm25_blob_t * const p_blob, uint32_t * const p_size)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_blob ) || ( false == p_blob->is_open ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_size )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        *p_size = ( true == p_blob->is_blob ) ? p_blob->hdr[p_blob->active].size : 0U;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,100 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_blob.h
+*@brief     Atomic A/B blob on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_BLOB
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_BLOB_H_
+#define FM25_BLOB_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of slot header in bytes
+ */
+#define FM25_BLOB_HDR_SIZE              ( sizeof( fm25_blob_hdr_t ))
+
+/**
+ *     Size of blob region in bytes
+ *
+ * @note    Sequence marker byte followed by two slots.
+ */
+#define FM25_BLOB_REGION_SIZE(size)     ( 1U + ( 2U * ( FM25_BLOB_HDR_SIZE + ( size ))))
+
+/**
+ *     Blob configuration
+ */
+typedef struct
+{
+    fm25_dev_t  dev;            /**<Device handle */
+    uint32_t    addr;           /**<Start address of blob region */
+    uint32_t    size;           /**<Maximum size of blob in bytes */
+} fm25_blob_cfg_t;
+
+/**
+ *     Slot header
+ *
+ * @note    Treat as opaque!
+ */
+typedef struct
+{
+    uint32_t    size;           /**<Size of blob in bytes */
+    uint32_t    crc;            /**<CRC-32 of size, sequence and blob */
+    uint8_t     seq;            /**<Sequence number of slot */
+    uint8_t     res[3];         /**<Reserved */
+} fm25_blob_hdr_t;
+
+/**
+ *     A/B blob
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_blob_cfg_t cfg;        /**<Configuration */
+    fm25_blob_hdr_t hdr[2];     /**<Slot headers */
+    uint8_t         seq;        /**<Sequence marker */
+    uint8_t         active;     /**<Slot of current blob */
+    bool            is_blob;    /**<Valid blob exists */
+    bool            is_open;    /**<Open guard */
+} fm25_blob_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_blob_open    (fm25_blob_t * const p_blob, const fm25_blob_cfg_t * const p_cfg);
+fm25_status_t fm25_blob_commit  (fm25_blob_t * const p_blob, const uint8_t * const p_data, const uint32_t size);
+fm25_status_t fm25_blob_load    (fm25_blob_t * const p_blob, uint8_t * const p_data, const uint32_t buf_size, uint32_t * const p_size);
+fm25_status_t fm25_blob_read    (fm25_blob_t * const p_blob, const uint32_t offset, const uint32_t size, uint8_t * const p_data);
+fm25_status_t fm25_blob_get_size(const fm25_blob_t * const p_blob, uint32_t * const p_size);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_BLOB_H_
@@ -0,0 +1,667 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_cache.c
+*@brief     Write-back RAM cache for FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_CACHE
+* @{ <!-- BEGIN GROUP -->
+*
+*     Fully associative write-back cache in front of FM25 API.
+*
+*     Lines are placed into user supplied arena. Writes are absorbed by
+*     cached lines and tracked per byte in dirty bitmap of line, thus
+*     repeated writes of same data cost single device write at flush.
+*     Flush writes dirty ranges of all lines in address order through
+*     vectored write, contiguous ranges are streamed inside single
+*     command.
+*
+*     Least recently used line is evicted on allocation. Read misses are
+*     served directly from device without allocation.
+*
+*     All accesses to cached memory must go through cache API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_cache.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of vectored write segments per flush call
+ */
+#define FM25_CACHE_IOV_NUM              ( 8U )
+
+/**
+ *     Longest clean gap written together with surrounding dirty ranges
+ *
+ * @note    Cached clean bytes are valid, writing them is cheaper than
+ *          starting new command.
+ */
+#define FM25_CACHE_GAP_MAX              ( 8U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t             fm25_cache_now          (const fm25_cache_t * const p_cache);
+static uint32_t             fm25_cache_arena_pad    (const void * const p_arena);
+static void                 fm25_cache_mark         (uint32_t * const p_dirty, const uint32_t first, const uint32_t num);
+static bool                 fm25_cache_is_dirty     (const uint32_t * const p_dirty, const uint32_t idx);
+static fm25_cache_line_t *  fm25_cache_lookup       (fm25_cache_t * const p_cache, const uint32_t tag);
+static fm25_status_t        fm25_cache_alloc        (fm25_cache_t * const p_cache, const uint32_t tag, const bool is_fill, fm25_cache_line_t ** const pp_line);
+static fm25_status_t        fm25_cache_write_back   (fm25_cache_t * const p_cache, fm25_cache_line_t * const p_only);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get current timestamp
+*
+* @param[in]    p_cache - Pointer to cache
+* @return       now     - Current timestamp, 0 without timestamp source
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_cache_now(const fm25_cache_t * const p_cache)
+{
+    return (( NULL != p_cache->cfg.pf_get_tick ) ? p_cache->cfg.pf_get_tick() : 0U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get padding in front of line headers
+*
+* @param[in]    p_arena - Pointer to arena
+* @return       pad     - Bytes up to first address aligned to "FM25_CACHE_ALIGN"
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_cache_arena_pad(const void * const p_arena)
+{
+    return (uint32_t)(( FM25_CACHE_ALIGN - ((uintptr_t) p_arena % FM25_CACHE_ALIGN )) % FM25_CACHE_ALIGN );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Mark range of line as dirty
+*
+* @param[in]    p_dirty - Dirty bitmap of line
+* @param[in]    first   - Offset of first byte inside line
+* @param[in]    num     - Number of bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_cache_mark(uint32_t * const p_dirty, const uint32_t first, const uint32_t num)
+{
+    uint32_t idx    = first;
+    uint32_t left   = num;
+
+    while ( left > 0U )
+    {
+        const uint32_t bit = ( idx & 31U );
+        const uint32_t cnt = (( 32U - bit ) < left ) ? ( 32U - bit ) : left;
+
+        p_dirty[ idx >> 5U ] |= (( 32U == cnt ) ? 0xFFFFFFFFUL : ((( 1UL << cnt ) - 1UL ) << bit ));
+
+        idx     += cnt;
+        left    -= cnt;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check if byte of line is dirty
+*
+* @param[in]    p_dirty     - Dirty bitmap of line
+* @param[in]    idx         - Offset of byte inside line
+* @return       is_dirty    - True if byte has unflushed write
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_cache_is_dirty(const uint32_t * const p_dirty, const uint32_t idx)
+{
+    return ( 0UL != ( p_dirty[ idx >> 5U ] & ( 1UL << ( idx & 31U ))));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Find cached line
+*
+* @param[in]    p_cache - Pointer to cache
+* @param[in]    tag     - Device address of line
+* @return       p_line  - Cached line, NULL on miss
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_cache_line_t * fm25_cache_lookup(fm25_cache_t * const p_cache, const uint32_t tag)
+{
+    fm25_cache_line_t * p_line = NULL;
+
+    for ( uint32_t i = 0U; i < p_cache->line_num; i++ )
+    {
+        if  (   ( true == p_cache->p_line[i].is_valid )
+            &&  ( tag == p_cache->p_line[i].tag ))
+        {
+            p_line = &p_cache->p_line[i];
+            break;
+        }
+    }
+
+    return p_line;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Allocate line
+*
+* @note     Free line is taken first, otherwise least recently used one.
+*           Dirty victim is written back before reuse.
+*
+* @param[in]    p_cache - Pointer to cache
+* @param[in]    tag     - Device address of line
+* @param[in]    is_fill - Read line content from device
+* @param[out]   pp_line - Allocated line
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_cache_alloc(fm25_cache_t * const p_cache, const uint32_t tag, const bool is_fill, fm25_cache_line_t ** const pp_line)
+{
+    fm25_status_t       status  = eFM25_OK;
+    fm25_cache_line_t * p_line  = &p_cache->p_line[0];
+
+    for ( uint32_t i = 0U; i < p_cache->line_num; i++ )
+    {
+        if ( false == p_cache->p_line[i].is_valid )
+        {
+            p_line = &p_cache->p_line[i];
+            break;
+        }
+
+        if (( p_cache->lru - p_cache->p_line[i].lru ) > ( p_cache->lru - p_line->lru ))
+        {
+            p_line = &p_cache->p_line[i];
+        }
+    }
+
+    if (( true == p_line->is_valid ) && ( true == p_line->is_dirty ))
+    {
+        status = fm25_cache_write_back( p_cache, p_line );
+        p_cache->stats.evict++;
+    }
+
+    if ( eFM25_OK == status )
+    {
+        p_line->is_valid = false;
+
+        if ( true == is_fill )
+        {
+            status = fm25_read( p_cache->cfg.dev, tag, p_cache->cfg.line_size, p_line->p_data );
+        }
+
+        if ( eFM25_OK == status )
+        {
+            p_line->tag         = tag;
+            p_line->is_valid    = true;
+            p_line->is_dirty    = false;
+        }
+    }
+
+    *pp_line = p_line;
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write dirty ranges back to device
+*
+* @note     Lines are visited in ascending address order and their dirty
+*           ranges are passed to vectored write in batches, thus ranges
+*           contiguous across lines share single command.
+*
+* @param[in]    p_cache - Pointer to cache
+* @param[in]    p_only  - Write back only this line, NULL for all lines
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_cache_write_back(fm25_cache_t * const p_cache, fm25_cache_line_t * const p_only)
+{
+    fm25_status_t       status      = eFM25_OK;
+    fm25_iov_t          iov[FM25_CACHE_IOV_NUM];
+    uint32_t            iov_num     = 0U;
+    bool                is_first    = true;
+    uint32_t            last_tag    = 0U;
+    fm25_cache_line_t * p_line      = p_only;
+    const uint32_t      line_size   = p_cache->cfg.line_size;
+
+    do
+    {
+        // Next dirty line in address order
+        if ( NULL == p_only )
+        {
+            p_line = NULL;
+
+            for ( uint32_t i = 0U; i < p_cache->line_num; i++ )
+            {
+                fm25_cache_line_t * const p_cand = &p_cache->p_line[i];
+
+                if  (   ( true == p_cand->is_valid )
+                    &&  ( true == p_cand->is_dirty )
+                    &&  (( true == is_first ) || ( p_cand->tag > last_tag ))
+                    &&  (( NULL == p_line ) || ( p_cand->tag < p_line->tag )))
+                {
+                    p_line = p_cand;
+                }
+            }
+        }
+
+        if ( NULL != p_line )
+        {
+            uint32_t idx = 0U;
+
+            while ( idx < line_size )
+            {
+                if ( false == fm25_cache_is_dirty( p_line->p_dirty, idx ))
+                {
+                    idx++;
+                    continue;
+                }
+
+                // Dirty range with short clean gaps
+                const uint32_t  start   = idx;
+                uint32_t        end     = idx + 1U;
+
+                for ( idx = end; ( idx < line_size ) && (( idx - end ) <= FM25_CACHE_GAP_MAX ); idx++ )
+                {
+                    if ( true == fm25_cache_is_dirty( p_line->p_dirty, idx ))
+                    {
+                        end = idx + 1U;
+                    }
+                }
+
+                idx = end;
+
+                if ( FM25_CACHE_IOV_NUM == iov_num )
+                {
+                    status |= fm25_writev( p_cache->cfg.dev, iov, iov_num );
+                    iov_num = 0U;
+                }
+
+                iov[iov_num] = (fm25_iov_t) { .addr = p_line->tag + start, .size = end - start, .p_data = &p_line->p_data[start] };
+                iov_num++;
+
+                p_cache->stats.flush_seg++;
+                p_cache->stats.flush_bytes += ( end - start );
+            }
+
+            last_tag = p_line->tag;
+            is_first = false;
+        }
+
+    } while (( NULL == p_only ) && ( NULL != p_line ));
+
+    if ( iov_num > 0U )
+    {
+        status |= fm25_writev( p_cache->cfg.dev, iov, iov_num );
+    }
+
+    // Failed lines stay dirty and are written again by next flush
+    if ( eFM25_OK == status )
+    {
+        for ( uint32_t i = 0U; i < p_cache->line_num; i++ )
+        {
+            fm25_cache_line_t * const p_clean = &p_cache->p_line[i];
+
+            if (( NULL == p_only ) || ( p_only == p_clean ))
+            {
+                memset( p_clean->p_dirty, 0, ( line_size / 8U ));
+                p_clean->is_dirty = false;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_CACHE
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 write-back cache API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Initialize write-back cache
+*
+* @note     Arena is split into as many lines as fit after padding to
+*           aligned line headers, see "FM25_CACHE_ARENA_SIZE()".
+*
+* @param[out]   p_cache - Pointer to cache
+* @param[in]    p_cfg   - Pointer to cache configuration
+* @return       status  - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_cache_init(fm25_cache_t * const p_cache, const fm25_cache_cfg_t * const p_cfg)
+{
+    fm25_status_t   status      = eFM25_OK;
+    uint32_t        mem_size    = 0U;
+
+    FM25_ASSERT( NULL != p_cache );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_cache )
+        ||  ( NULL == p_cfg )
+        ||  ( NULL == p_cfg->p_arena )
+        ||  ( p_cfg->line_size < 32U )
+        ||  ( p_cfg->line_size > 512U )
+        ||  ( 0U != ( p_cfg->line_size & ( p_cfg->line_size - 1U )))
+        ||  ( eFM25_OK != fm25_get_size( p_cfg->dev, &mem_size ))
+        ||  ( p_cfg->line_size > mem_size )
+        ||  ( p_cfg->arena_size < ( fm25_cache_arena_pad( p_cfg->p_arena ) + FM25_CACHE_LINE_COST( p_cfg->line_size ))))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        memset( p_cache, 0, sizeof( fm25_cache_t ));
+
+        const uint32_t pad = fm25_cache_arena_pad( p_cfg->p_arena );
+
+        p_cache->cfg        = *p_cfg;
+        p_cache->line_num   = (( p_cfg->arena_size - pad ) / FM25_CACHE_LINE_COST( p_cfg->line_size ));
+        p_cache->p_line     = (fm25_cache_line_t*) &((uint8_t*) p_cfg->p_arena )[pad];
+
+        // Arena layout: line headers, dirty bitmaps, line data
+        uint32_t * const    p_dirty = (uint32_t*) &p_cache->p_line[p_cache->line_num];
+        uint8_t * const     p_data  = (uint8_t*) &p_dirty[ p_cache->line_num * ( p_cfg->line_size / 32U )];
+
+        for ( uint32_t i = 0U; i < p_cache->line_num; i++ )
+        {
+            p_cache->p_line[i] = (fm25_cache_line_t) { 0 };
+            p_cache->p_line[i].p_dirty  = &p_dirty[ i * ( p_cfg->line_size / 32U )];
+            p_cache->p_line[i].p_data   = &p_data[ i * p_cfg->line_size ];
+
+            memset( p_cache->p_line[i].p_dirty, 0, ( p_cfg->line_size / 8U ));
+        }
+
+        p_cache->is_init = true;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write through cache
+*
+* @note     Line fully covered by write is allocated without reading it
+*           from device.
+*
+* @param[in]    p_cache - Pointer to cache
+* @param[in]    addr    - Start address of write
+* @param[in]    size    - Size of bytes to write
+* @param[in]    p_data  - Pointer to write data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_cache_write(fm25_cache_t * const p_cache, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    fm25_status_t   status      = eFM25_OK;
+    uint32_t        mem_size    = 0U;
+
+    if (( NULL == p_cache ) || ( false == p_cache->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (   ( NULL == p_data )
+            ||  ( 0U == size )
+            ||  ( eFM25_OK != fm25_get_size( p_cache->cfg.dev, &mem_size ))
+            ||  ( addr >= mem_size )
+            ||  ( size > ( mem_size - addr )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        const uint32_t  line_size   = p_cache->cfg.line_size;
+        uint32_t        done        = 0U;
+
+        while (( done < size ) && ( eFM25_OK == status ))
+        {
+            const uint32_t      cur     = addr + done;
+            const uint32_t      tag     = cur & ~( line_size - 1U );
+            const uint32_t      off     = cur - tag;
+            const uint32_t      num     = (( line_size - off ) < ( size - done )) ? ( line_size - off ) : ( size - done );
+            fm25_cache_line_t * p_line  = fm25_cache_lookup( p_cache, tag );
+
+            if ( NULL != p_line )
+            {
+                p_cache->stats.wr_hit++;
+            }
+            else
+            {
+                p_cache->stats.wr_miss++;
+                status = fm25_cache_alloc( p_cache, tag, ( num < line_size ), &p_line );
+            }
+
+            if ( eFM25_OK == status )
+            {
+                memcpy( &p_line->p_data[off], &p_data[done], num );
+                fm25_cache_mark( p_line->p_dirty, off, num );
+
+                if ( false == p_line->is_dirty )
+                {
+                    p_line->is_dirty    = true;
+                    p_line->dirty_tick  = fm25_cache_now( p_cache );
+                }
+
+                p_line->lru = ++p_cache->lru;
+            }
+
+            done += num;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read through cache
+*
+* @note     Cached lines are served from RAM, contiguous misses are read
+*           from device as single read without allocation.
+*
+* @param[in]    p_cache - Pointer to cache
+* @param[in]    addr    - Start address of read
+* @param[in]    size    - Size of bytes to read
+* @param[out]   p_data  - Pointer to read data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_cache_read(fm25_cache_t * const p_cache, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_cache ) || ( false == p_cache->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_data ) || ( 0U == size ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        const uint32_t  line_size   = p_cache->cfg.line_size;
+        uint32_t        done        = 0U;
+        uint32_t        miss_start  = 0U;
+        uint32_t        miss_num    = 0U;
+
+        while ( done < size )
+        {
+            const uint32_t      cur     = addr + done;
+            const uint32_t      tag     = cur & ~( line_size - 1U );
+            const uint32_t      off     = cur - tag;
+            const uint32_t      num     = (( line_size - off ) < ( size - done )) ? ( line_size - off ) : ( size - done );
+            fm25_cache_line_t * p_line  = fm25_cache_lookup( p_cache, tag );
+
+            if ( NULL != p_line )
+            {
+                p_cache->stats.rd_hit++;
+
+                // Pending misses first
+                if ( miss_num > 0U )
+                {
+                    status |= fm25_read( p_cache->cfg.dev, addr + miss_start, miss_num, &p_data[miss_start] );
+                    miss_num = 0U;
+                }
+
+                memcpy( &p_data[done], &p_line->p_data[off], num );
+                p_line->lru = ++p_cache->lru;
+            }
+            else
+            {
+                p_cache->stats.rd_miss++;
+
+                if ( 0U == miss_num )
+                {
+                    miss_start = done;
+                }
+
+                miss_num += num;
+            }
+
+            done += num;
+        }
+
+        if ( miss_num > 0U )
+        {
+            status |= fm25_read( p_cache->cfg.dev, addr + miss_start, miss_num, &p_data[miss_start] );
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Flush all dirty data to device
+*
+* @param[in]    p_cache - Pointer to cache
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_cache_flush(fm25_cache_t * const p_cache)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_cache ) || ( false == p_cache->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        status = fm25_cache_write_back( p_cache, NULL );
+        p_cache->stats.flush++;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Apply deadline flush policy
+*
+* @note     Shall be called periodically. All dirty data is flushed
+*           once oldest unflushed write is older than configured
+*           deadline.
+*
+* @param[in]    p_cache - Pointer to cache
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_cache_process(fm25_cache_t * const p_cache)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_cache ) || ( false == p_cache->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( 0U != p_cache->cfg.deadline ) && ( NULL != p_cache->cfg.pf_get_tick ))
+    {
+        const uint32_t  now         = fm25_cache_now( p_cache );
+        bool            is_expired  = false;
+
+        for ( uint32_t i = 0U; ( i < p_cache->line_num ) && ( false == is_expired ); i++ )
+        {
+            is_expired =    ( true == p_cache->p_line[i].is_dirty )
+                        &&  (( now - p_cache->p_line[i].dirty_tick ) >= p_cache->cfg.deadline );
+        }
+
+        if ( true == is_expired )
+        {
+            status = fm25_cache_flush( p_cache );
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get cache statistics
+*
+* @param[in]    p_cache - Pointer to cache
+* @param[out]   p_stats - Pointer to statistics
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_cache_get_stats(const fm25_cache_t * const p_cache, fm25_cache_stats_t * const p_stats)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL != p_cache ) && ( NULL != p_stats ))
+    {
+        *p_stats = p_cache->stats;
+    }
+    else
+    {
+        status = eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,134 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_cache.h
+*@brief     Write-back RAM cache for FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_CACHE
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_CACHE_H_
+#define FM25_CACHE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Alignment of line headers inside arena
+ *
+ * @note    Headers hold pointers, thus they start at first address of
+ *          arena aligned to pointer size. Power of 2 size of pointer and
+ *          "uint32_t" is multiple of alignment of both.
+ */
+#define FM25_CACHE_ALIGN                ((uint32_t)(( sizeof( void* ) > sizeof( uint32_t )) ? sizeof( void* ) : sizeof( uint32_t )))
+
+/**
+ *     Arena size taken by single line
+ *
+ * @note    Each line takes header, dirty bitmap (one bit per byte) and data.
+ */
+#define FM25_CACHE_LINE_COST(line_size)                 ( sizeof(fm25_cache_line_t) + ((line_size) / 8U ) + (line_size))
+
+/**
+ *     Arena size needed for given number of lines
+ *
+ * @note    Includes padding in front of line headers for arena of any
+ *          alignment.
+ */
+#define FM25_CACHE_ARENA_SIZE(line_num, line_size)      (( FM25_CACHE_ALIGN - 1U ) + ((line_num) * FM25_CACHE_LINE_COST( line_size )))
+
+/**
+ *     Cache configuration
+ */
+typedef struct
+{
+    fm25_dev_t      dev;                    /**<Device handle */
+    void *          p_arena;                /**<Line table storage, any alignment */
+    uint32_t        arena_size;             /**<Size of line table storage in bytes */
+    uint32_t        line_size;              /**<Size of line in bytes, power of 2 (32-512) */
+    uint32_t        deadline;               /**<Maximum age of dirty data in ticks, 0 for explicit flush only */
+    uint32_t        (*pf_get_tick)(void);   /**<Timestamp source, NULL disables deadline flush */
+} fm25_cache_cfg_t;
+
+/**
+ *     Cache statistics
+ */
+typedef struct
+{
+    uint32_t    rd_hit;         /**<Number of line reads served from cache */
+    uint32_t    rd_miss;        /**<Number of line reads served from device */
+    uint32_t    wr_hit;         /**<Number of line writes absorbed by cached line */
+    uint32_t    wr_miss;        /**<Number of line writes that allocated line */
+    uint32_t    evict;          /**<Number of dirty lines written back on eviction */
+    uint32_t    flush;          /**<Number of flushes */
+    uint32_t    flush_seg;      /**<Number of dirty ranges written back */
+    uint32_t    flush_bytes;    /**<Number of bytes written back */
+} fm25_cache_stats_t;
+
+/**
+ *     Cache line
+ *
+ * @note    Treat as opaque!
+ */
+typedef struct
+{
+    uint8_t *   p_data;         /**<Line data */
+    uint32_t *  p_dirty;        /**<Dirty bitmap, one bit per byte */
+    uint32_t    tag;            /**<Device address of line */
+    uint32_t    lru;            /**<Last use stamp */
+    uint32_t    dirty_tick;     /**<Timestamp of oldest unflushed write */
+    bool        is_valid;       /**<Line holds device data */
+    bool        is_dirty;       /**<Line has unflushed writes */
+} fm25_cache_line_t;
+
+/**
+ *     Write-back cache
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_cache_cfg_t    cfg;        /**<Configuration */
+    fm25_cache_stats_t  stats;      /**<Statistics */
+    fm25_cache_line_t * p_line;     /**<Line table */
+    uint32_t            line_num;   /**<Number of lines */
+    uint32_t            lru;        /**<Use stamp counter */
+    bool                is_init;    /**<Initialization guard */
+} fm25_cache_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_cache_init       (fm25_cache_t * const p_cache, const fm25_cache_cfg_t * const p_cfg);
+fm25_status_t fm25_cache_write      (fm25_cache_t * const p_cache, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+fm25_status_t fm25_cache_read       (fm25_cache_t * const p_cache, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+fm25_status_t fm25_cache_flush      (fm25_cache_t * const p_cache);
+fm25_status_t fm25_cache_process    (fm25_cache_t * const p_cache);
+fm25_status_t fm25_cache_get_stats  (const fm25_cache_t * const p_cache, fm25_cache_stats_t * const p_stats);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_CACHE_H_
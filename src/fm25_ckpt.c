@@ -0,0 +1,578 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_ckpt.c
+*@brief     Delta checkpoint of application state on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_CKPT
+* @{ <!-- BEGIN GROUP -->
+*
+*     Checkpoint writes only parts of application state that changed
+*     since last checkpoint. Changes are found against RAM image of last
+*     committed state, compared word by word, or against CRC-32 of each
+*     "FM25_CKPT_BLOCK_SIZE" block when RAM is scarce.
+*
+*     Changed runs separated by unchanged run not longer than configured
+*     gap are merged, as rewriting few unchanged bytes is cheaper than
+*     framing of another write command. Resulting runs are written by
+*     single vectored write.
+*
+*     Checkpoint is not atomic, interrupted one leaves mix of old and new
+*     state on device. Use A/B blob when atomic update is needed.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_ckpt.h"
+#include "fm25_crc.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static bool         fm25_ckpt_is_valid_cfg  (const fm25_ckpt_cfg_t * const p_cfg);
+static uint32_t     fm25_ckpt_block_hash    (const fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state, const uint32_t block);
+static uint32_t     fm25_ckpt_next_change   (fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state, uint32_t off);
+static uint32_t     fm25_ckpt_next_same     (fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state, uint32_t off);
+static void         fm25_ckpt_gap_add       (fm25_ckpt_t * const p_ckpt, uint32_t gap);
+static uint32_t     fm25_ckpt_diff          (fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state);
+static void         fm25_ckpt_set_base      (fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check checkpoint configuration
+*
+* @param[in]    p_cfg       - Pointer to checkpoint configuration
+* @return       is_valid    - True if state fits into device and storage is given
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_ckpt_is_valid_cfg(const fm25_ckpt_cfg_t * const p_cfg)
+{
+    uint32_t mem_size = 0U;
+
+    return  (   ( NULL != p_cfg )
+            &&  ( eFM25_OK == fm25_get_size( p_cfg->dev, &mem_size ))
+            &&  ( p_cfg->size > 0U )
+            &&  ( p_cfg->addr < mem_size )
+            &&  ( p_cfg->size <= ( mem_size - p_cfg->addr ))
+            &&  (( NULL == p_cfg->p_base ) != ( NULL == p_cfg->p_hash ))
+            &&  ( NULL != p_cfg->p_iov )
+            &&  ( p_cfg->iov_num > 0U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Calculate hash of state block
+*
+* @note     Last block can be shorter than "FM25_CKPT_BLOCK_SIZE".
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[in]    p_state - Pointer to state
+* @param[in]    block   - Block number
+* @return       hash    - CRC-32 of block
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_ckpt_block_hash(const fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state, const uint32_t block)
+{
+    const uint32_t off  = ( block * FM25_CKPT_BLOCK_SIZE );
+    const uint32_t size = (( p_ckpt->cfg.size - off ) > FM25_CKPT_BLOCK_SIZE ) ? FM25_CKPT_BLOCK_SIZE : ( p_ckpt->cfg.size - off );
+
+    return fm25_crc32( FM25_CRC32_INIT, &p_state[off], size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Find next changed byte of state
+*
+* @note     Baseline is compared 8 bytes at once until first differing
+*           word. In hash mode changed block is reported from its start
+*           and its stored hash is updated.
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[in]    p_state - Pointer to new state
+* @param[in]    off     - Offset to start search from
+* @return       off     - Offset of next change, size of state if none
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_ckpt_next_change(fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state, uint32_t off)
+{
+    const uint32_t size = p_ckpt->cfg.size;
+
+    if ( NULL != p_ckpt->cfg.p_base )
+    {
+        const uint8_t * const   p_base      = p_ckpt->cfg.p_base;
+        bool                    is_same     = true;
+        uint64_t                word_new    = 0U;
+        uint64_t                word_base   = 0U;
+
+        while   (   ( true == is_same )
+                &&  (( size - off ) >= sizeof( uint64_t )))
+        {
+            memcpy( &word_new, &p_state[off], sizeof( uint64_t ));
+            memcpy( &word_base, &p_base[off], sizeof( uint64_t ));
+
+            if ( word_new == word_base )
+            {
+                off += sizeof( uint64_t );
+            }
+            else
+            {
+                is_same = false;
+            }
+        }
+
+        while   (   ( off < size )
+                &&  ( p_state[off] == p_base[off] ))
+        {
+            off++;
+        }
+    }
+    else
+    {
+        uint32_t    block       = ( off / FM25_CKPT_BLOCK_SIZE );
+        bool        is_same     = true;
+
+        while   (   ( true == is_same )
+                &&  (( block * FM25_CKPT_BLOCK_SIZE ) < size ))
+        {
+            const uint32_t hash = fm25_ckpt_block_hash( p_ckpt, p_state, block );
+
+            if ( hash == p_ckpt->cfg.p_hash[block] )
+            {
+                block++;
+            }
+            else
+            {
+                p_ckpt->cfg.p_hash[block]   = hash;
+                is_same                     = false;
+            }
+        }
+
+        off = (( block * FM25_CKPT_BLOCK_SIZE ) < size ) ? ( block * FM25_CKPT_BLOCK_SIZE ) : size;
+    }
+
+    return off;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Find next unchanged byte of state
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[in]    p_state - Pointer to new state
+* @param[in]    off     - Offset of change to start search from
+* @return       off     - Offset of end of change, size of state if change lasts to the end
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_ckpt_next_same(fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state, uint32_t off)
+{
+    const uint32_t size = p_ckpt->cfg.size;
+
+    if ( NULL != p_ckpt->cfg.p_base )
+    {
+        while   (   ( off < size )
+                &&  ( p_state[off] != p_ckpt->cfg.p_base[off] ))
+        {
+            off++;
+        }
+    }
+    else
+    {
+        // Block at offset is already known to be changed
+        uint32_t    block       = (( off / FM25_CKPT_BLOCK_SIZE ) + 1U );
+        bool        is_change   = true;
+
+        while   (   ( true == is_change )
+                &&  (( block * FM25_CKPT_BLOCK_SIZE ) < size ))
+        {
+            const uint32_t hash = fm25_ckpt_block_hash( p_ckpt, p_state, block );
+
+            if ( hash != p_ckpt->cfg.p_hash[block] )
+            {
+                p_ckpt->cfg.p_hash[block] = hash;
+                block++;
+            }
+            else
+            {
+                is_change = false;
+            }
+        }
+
+        off = (( block * FM25_CKPT_BLOCK_SIZE ) < size ) ? ( block * FM25_CKPT_BLOCK_SIZE ) : size;
+    }
+
+    return off;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Count unchanged run between changes into gap histogram
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[in]    gap     - Length of unchanged run in bytes, not 0
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_ckpt_gap_add(fm25_ckpt_t * const p_ckpt, uint32_t gap)
+{
+    uint32_t bucket = 0U;
+
+    while   (   ( gap > 1U )
+            &&  ( bucket < ( FM25_CKPT_GAP_NUM - 1U )))
+    {
+        gap >>= 1U;
+        bucket++;
+    }
+
+    p_ckpt->stats.gap[bucket]++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Build write segments of changed runs
+*
+* @note     Runs exceeding segment storage are merged into last segment.
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[in]    p_state - Pointer to new state
+* @return       iov_num - Number of write segments
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_ckpt_diff(fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state)
+{
+    fm25_iov_t * const  p_iov   = p_ckpt->cfg.p_iov;
+    const uint32_t      size    = p_ckpt->cfg.size;
+    uint32_t            iov_num = 0U;
+    uint32_t            off     = fm25_ckpt_next_change( p_ckpt, p_state, 0U );
+
+    while ( off < size )
+    {
+        const uint32_t  start       = off;
+        uint32_t        end         = fm25_ckpt_next_same( p_ckpt, p_state, start );
+        bool            is_merge    = true;
+
+        off = fm25_ckpt_next_change( p_ckpt, p_state, end );
+
+        while   (   ( true == is_merge )
+                &&  ( off < size ))
+        {
+            fm25_ckpt_gap_add( p_ckpt, ( off - end ));
+
+            if (( off - end ) <= p_ckpt->cfg.gap )
+            {
+                end = fm25_ckpt_next_same( p_ckpt, p_state, off );
+                off = fm25_ckpt_next_change( p_ckpt, p_state, end );
+            }
+            else
+            {
+                is_merge = false;
+            }
+        }
+
+        if ( iov_num < p_ckpt->cfg.iov_num )
+        {
+            p_iov[iov_num].addr     = ( p_ckpt->cfg.addr + start );
+            p_iov[iov_num].size     = ( end - start );
+            p_iov[iov_num].p_data   = (uint8_t*) &p_state[start];
+            iov_num++;
+        }
+
+        // Out of segments, extend last one
+        else
+        {
+            p_iov[iov_num - 1U].size = (( p_ckpt->cfg.addr + end ) - p_iov[iov_num - 1U].addr );
+        }
+    }
+
+    return iov_num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Take whole state as baseline
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[in]    p_state - Pointer to state
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_ckpt_set_base(fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state)
+{
+    if ( NULL != p_ckpt->cfg.p_base )
+    {
+        memcpy( p_ckpt->cfg.p_base, p_state, p_ckpt->cfg.size );
+    }
+    else
+    {
+        for ( uint32_t block = 0U; block < FM25_CKPT_HASH_NUM( p_ckpt->cfg.size ); block++ )
+        {
+            p_ckpt->cfg.p_hash[block] = fm25_ckpt_block_hash( p_ckpt, p_state, block );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_CKPT
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 checkpoint API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Initialize checkpoint and restore state
+*
+* @note     State is read from device by single read command and taken as
+*           baseline. Validity of restored state (e.g. blank device) is
+*           up to application.
+*
+* @param[out]   p_ckpt  - Pointer to checkpoint
+* @param[in]    p_cfg   - Pointer to checkpoint configuration
+* @param[out]   p_state - Pointer to state, NULL to skip restore and rewrite whole state at first checkpoint
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ckpt_init(fm25_ckpt_t * const p_ckpt, const fm25_ckpt_cfg_t * const p_cfg, uint8_t * const p_state)
+{
+    fm25_status_t status = eFM25_OK;
+
+    FM25_ASSERT( NULL != p_ckpt );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_ckpt )
+        ||  ( false == fm25_ckpt_is_valid_cfg( p_cfg )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        memset( p_ckpt, 0, sizeof( fm25_ckpt_t ));
+
+        p_ckpt->cfg     = *p_cfg;
+        p_ckpt->is_full = true;
+
+        if ( NULL != p_state )
+        {
+            status = fm25_read( p_cfg->dev, p_cfg->addr, p_cfg->size, p_state );
+
+            if ( eFM25_OK == status )
+            {
+                fm25_ckpt_set_base( p_ckpt, p_state );
+                p_ckpt->is_full = false;
+            }
+        }
+
+        p_ckpt->is_init = ( eFM25_OK == status );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Checkpoint state
+*
+* @note     Costs single vectored write with one write command per merged
+*           run of changes. Unchanged state costs no device access.
+*
+*           Failed checkpoint rewrites whole state at next one.
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[in]    p_state - Pointer to new state
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ckpt_commit(fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        iov_num = 0U;
+    uint32_t        written = 0U;
+
+    if (( NULL == p_ckpt ) || ( false == p_ckpt->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_state )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        if ( true == p_ckpt->is_full )
+        {
+            p_ckpt->cfg.p_iov[0].addr   = p_ckpt->cfg.addr;
+            p_ckpt->cfg.p_iov[0].size   = p_ckpt->cfg.size;
+            p_ckpt->cfg.p_iov[0].p_data = (uint8_t*) p_state;
+            iov_num = 1U;
+        }
+        else
+        {
+            iov_num = fm25_ckpt_diff( p_ckpt, p_state );
+        }
+
+        if ( iov_num > 0U )
+        {
+            // NOTE: Vectored write does not modify data
+            status = fm25_writev( p_ckpt->cfg.dev, p_ckpt->cfg.p_iov, iov_num );
+        }
+
+        if ( eFM25_OK == status )
+        {
+            if ( true == p_ckpt->is_full )
+            {
+                fm25_ckpt_set_base( p_ckpt, p_state );
+                p_ckpt->is_full = false;
+            }
+
+            // Hashes are already updated by diff
+            else if ( NULL != p_ckpt->cfg.p_base )
+            {
+                for ( uint32_t i = 0U; i < iov_num; i++ )
+                {
+                    const uint32_t off = ( p_ckpt->cfg.p_iov[i].addr - p_ckpt->cfg.addr );
+
+                    memcpy( &p_ckpt->cfg.p_base[off], &p_state[off], p_ckpt->cfg.p_iov[i].size );
+                }
+            }
+            else
+            {
+                // No action
+            }
+
+            for ( uint32_t i = 0U; i < iov_num; i++ )
+            {
+                written += p_ckpt->cfg.p_iov[i].size;
+            }
+
+            p_ckpt->stats.ckpt++;
+            p_ckpt->stats.run          += iov_num;
+            p_ckpt->stats.written      += written;
+            p_ckpt->stats.saved        += ( p_ckpt->cfg.size - written );
+            p_ckpt->stats.last_run      = iov_num;
+            p_ckpt->stats.last_written  = written;
+            p_ckpt->stats.last_saved    = ( p_ckpt->cfg.size - written );
+        }
+
+        // Device content unknown
+        else
+        {
+            p_ckpt->is_full = true;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Set run merge threshold
+*
+* @note     Gap histogram of statistics shows how merge threshold would
+*           split changes of typical checkpoint.
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[in]    gap     - Unchanged run in bytes merged into write rather than split
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ckpt_set_gap(fm25_ckpt_t * const p_ckpt, const uint32_t gap)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_ckpt ) || ( false == p_ckpt->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        p_ckpt->cfg.gap = gap;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get checkpoint statistics
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @param[out]   p_stats - Pointer to statistics
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ckpt_get_stats(const fm25_ckpt_t * const p_ckpt, fm25_ckpt_stats_t * const p_stats)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_ckpt ) || ( false == p_ckpt->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_stats )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        *p_stats = p_ckpt->stats;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Reset checkpoint statistics
+*
+* @param[in]    p_ckpt  - Pointer to checkpoint
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ckpt_reset_stats(fm25_ckpt_t * const p_ckpt)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_ckpt ) || ( false == p_ckpt->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        memset( &p_ckpt->stats, 0, sizeof( fm25_ckpt_stats_t ));
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
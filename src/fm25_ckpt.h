@@ -0,0 +1,115 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_ckpt.h
+*@brief     Delta checkpoint of application state on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_CKPT
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_CKPT_H_
+#define FM25_CKPT_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of hashed block in bytes
+ */
+#define FM25_CKPT_BLOCK_SIZE            ( 64U )
+
+/**
+ *     Number of hashes needed for state of given size
+ */
+#define FM25_CKPT_HASH_NUM(size)        ((( size ) + FM25_CKPT_BLOCK_SIZE - 1U ) / FM25_CKPT_BLOCK_SIZE )
+
+/**
+ *     Number of gap histogram buckets
+ *
+ * @note    Bucket 0 counts gaps of 1 byte, bucket n of 2^n up to
+ *          2^(n+1) - 1 bytes. Last bucket collects all longer ones.
+ */
+#define FM25_CKPT_GAP_NUM               ( 12U )
+
+/**
+ *     Checkpoint configuration
+ *
+ * @note    Exactly one of "p_base" and "p_hash" shall be given. Baseline
+ *          image finds changes with byte resolution, hashes trade that
+ *          for 4 bytes of RAM per "FM25_CKPT_BLOCK_SIZE" bytes of state.
+ */
+typedef struct
+{
+    fm25_dev_t      dev;            /**<Device handle */
+    uint32_t        addr;           /**<Device address of state */
+    uint32_t        size;           /**<Size of state in bytes */
+    uint8_t *       p_base;         /**<Last committed image, "size" bytes, or NULL */
+    uint32_t *      p_hash;         /**<CRC-32 per block, "FM25_CKPT_HASH_NUM(size)" words, or NULL */
+    fm25_iov_t *    p_iov;          /**<Write segment storage */
+    uint32_t        iov_num;        /**<Number of write segments, at least 1 */
+    uint32_t        gap;            /**<Unchanged run in bytes merged into write rather than split */
+} fm25_ckpt_cfg_t;
+
+/**
+ *     Checkpoint statistics
+ */
+typedef struct
+{
+    uint32_t    ckpt;                       /**<Number of checkpoints */
+    uint32_t    run;                        /**<Number of write commands */
+    uint32_t    written;                    /**<Number of bytes written */
+    uint32_t    saved;                      /**<Number of bytes not written compared to full rewrite */
+    uint32_t    last_run;                   /**<Number of write commands of last checkpoint */
+    uint32_t    last_written;               /**<Number of bytes written by last checkpoint */
+    uint32_t    last_saved;                 /**<Number of bytes saved by last checkpoint */
+    uint32_t    gap[FM25_CKPT_GAP_NUM];     /**<Log2 histogram of unchanged runs between changes */
+} fm25_ckpt_stats_t;
+
+/**
+ *     Checkpoint
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_ckpt_cfg_t     cfg;        /**<Configuration */
+    fm25_ckpt_stats_t   stats;      /**<Statistics */
+    bool                is_full;    /**<Next checkpoint rewrites whole state */
+    bool                is_init;    /**<Init guard */
+} fm25_ckpt_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ckpt_init        (fm25_ckpt_t * const p_ckpt, const fm25_ckpt_cfg_t * const p_cfg, uint8_t * const p_state);
+fm25_status_t fm25_ckpt_commit      (fm25_ckpt_t * const p_ckpt, const uint8_t * const p_state);
+fm25_status_t fm25_ckpt_set_gap     (fm25_ckpt_t * const p_ckpt, const uint32_t gap);
+fm25_status_t fm25_ckpt_get_stats   (const fm25_ckpt_t * const p_ckpt, fm25_ckpt_stats_t * const p_stats);
+fm25_status_t fm25_ckpt_reset_stats (fm25_ckpt_t * const p_ckpt);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_CKPT_H_
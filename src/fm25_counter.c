@@ -0,0 +1,353 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_counter.c
+*@brief     Torn write tolerant persistent counters on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_COUNTER
+* @{ <!-- BEGIN GROUP -->
+*
+*     Counter is stored as two copies. Each copy holds value with most
+*     significant byte first, followed by complement of value with least
+*     significant byte first:
+*
+*         [v3 v2 v1 v0 ~v0 ~v1 ~v2 ~v3]
+*
+*     Low order value bytes and their complements are neighbours, thus
+*     small increment rewrites only few bytes in the middle of copy by
+*     single write command. All changed value bytes are written before
+*     any changed complement byte, so copy torn at any byte fails the
+*     complement check, unless nothing changed yet.
+*
+*     Update always rewrites older copy and leaves newer one intact.
+*     Interrupted update costs at most that update, as newer copy still
+*     holds previous value. Copies are ordered by serial number
+*     arithmetic, thus counter may wrap around.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_counter.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of single copy in bytes
+ */
+#define FM25_COUNTER_COPY_SIZE(width)   ( 2U * ( width ))
+
+/**
+ *     Value mask of counter width
+ */
+#define FM25_COUNTER_MASK(width)        (( FM25_COUNTER_WIDTH_MAX == ( width )) ? 0xFFFFFFFFUL : (( 1UL << ( 8U * ( width ))) - 1UL ))
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static bool             fm25_counter_is_valid_arg   (fm25_dev_t dev, const uint32_t addr, const uint8_t width);
+static void             fm25_counter_encode         (const uint32_t value, const uint8_t width, uint8_t * const p_copy);
+static bool             fm25_counter_decode         (const uint8_t * const p_copy, const uint8_t width, uint32_t * const p_value);
+static fm25_status_t    fm25_counter_load           (fm25_dev_t dev, const uint32_t addr, const uint8_t width, uint8_t * const p_buf, uint8_t * const p_copy, uint32_t * const p_value);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check counter location
+*
+* @param[in]    dev         - Device handle
+* @param[in]    addr        - Device address of counter
+* @param[in]    width       - Width of counter value in bytes, 1 to "FM25_COUNTER_WIDTH_MAX"
+* @return       is_valid    - True if counter fits into device
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_counter_is_valid_arg(fm25_dev_t dev, const uint32_t addr, const uint8_t width)
+{
+    uint32_t mem_size = 0U;
+
+    return  (   ( width > 0U )
+            &&  ( width <= FM25_COUNTER_WIDTH_MAX )
+            &&  ( eFM25_OK == fm25_get_size( dev, &mem_size ))
+            &&  ( addr < mem_size )
+            &&  ( FM25_COUNTER_SIZE( width ) <= ( mem_size - addr )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Encode counter copy
+*
+* @param[in]    value   - Counter value
+* @param[in]    width   - Width of counter value in bytes
+* @param[out]   p_copy  - Pointer to copy image
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_counter_encode(const uint32_t value, const uint8_t width, uint8_t * const p_copy)
+{
+    for ( uint8_t i = 0U; i < width; i++ )
+    {
+        p_copy[i]           = (uint8_t)( value >> ( 8U * ( width - 1U - i )));
+        p_copy[width + i]   = (uint8_t) ~( value >> ( 8U * i ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Decode counter copy
+*
+* @param[in]    p_copy      - Pointer to copy image
+* @param[in]    width       - Width of counter value in bytes
+* @param[out]   p_value     - Counter value
+* @return       is_valid    - True if complement matches value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_counter_decode(const uint8_t * const p_copy, const uint8_t width, uint32_t * const p_value)
+{
+    bool        is_valid    = true;
+    uint32_t    value       = 0U;
+
+    for ( uint8_t i = 0U; i < width; i++ )
+    {
+        value = (( value << 8U ) | p_copy[i] );
+    }
+
+    for ( uint8_t i = 0U; i < width; i++ )
+    {
+        if ( p_copy[width + i] != (uint8_t) ~( value >> ( 8U * i )))
+        {
+            is_valid = false;
+        }
+    }
+
+    *p_value = value;
+
+    return is_valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Load counter and select newer copy
+*
+* @note     Both copies are read by single read command.
+*
+* @param[in]    dev         - Device handle
+* @param[in]    addr        - Device address of counter
+* @param[in]    width       - Width of counter value in bytes
+* @param[out]   p_buf       - Pointer to image of both copies, "FM25_COUNTER_SIZE(width)" bytes
+* @param[out]   p_copy      - Newer valid copy, 0 or 1
+* @param[out]   p_value     - Counter value
+* @return       status      - Status of operation, "eFM25_ERROR" if no copy is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_counter_load(fm25_dev_t dev, const uint32_t addr, const uint8_t width, uint8_t * const p_buf, uint8_t * const p_copy, uint32_t * const p_value)
+{
+    fm25_status_t   status      = eFM25_OK;
+    uint32_t        value[2]    = { 0U, 0U };
+    bool            is_valid[2] = { false, false };
+
+    status = fm25_read( dev, addr, FM25_COUNTER_SIZE( width ), p_buf );
+
+    if ( eFM25_OK == status )
+    {
+        is_valid[0] = fm25_counter_decode( &p_buf[0], width, &value[0] );
+        is_valid[1] = fm25_counter_decode( &p_buf[FM25_COUNTER_COPY_SIZE( width )], width, &value[1] );
+
+        if (( true == is_valid[0] ) && ( true == is_valid[1] ))
+        {
+            const uint32_t diff = (( value[1] - value[0] ) & FM25_COUNTER_MASK( width ));
+
+            *p_copy = (( 0U != diff ) && ( diff <= ( FM25_COUNTER_MASK( width ) >> 1U ))) ? 1U : 0U;
+        }
+        else if ( true == is_valid[0] )
+        {
+            *p_copy = 0U;
+        }
+        else if ( true == is_valid[1] )
+        {
+            *p_copy = 1U;
+        }
+        else
+        {
+            status = eFM25_ERROR;
+        }
+
+        *p_value = value[*p_copy & 1U];
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_COUNTER
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 counter API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Set counter value
+*
+* @note     Both copies are written by single write command. Counter shall
+*           be set once before first use.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    addr    - Device address of counter
+* @param[in]    width   - Width of counter value in bytes, 1 to "FM25_COUNTER_WIDTH_MAX"
+* @param[in]    value   - Counter value, truncated to width
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_counter_set(fm25_dev_t dev, const uint32_t addr, const uint8_t width, const uint32_t value)
+{
+    fm25_status_t   status = eFM25_OK;
+    uint8_t         buf[FM25_COUNTER_SIZE( FM25_COUNTER_WIDTH_MAX )];
+
+    if ( false == fm25_counter_is_valid_arg( dev, addr, width ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        fm25_counter_encode(( value & FM25_COUNTER_MASK( width )), width, &buf[0] );
+        fm25_counter_encode(( value & FM25_COUNTER_MASK( width )), width, &buf[FM25_COUNTER_COPY_SIZE( width )] );
+
+        status = fm25_write( dev, addr, FM25_COUNTER_SIZE( width ), buf );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get counter value
+*
+* @param[in]    dev     - Device handle
+* @param[in]    addr    - Device address of counter
+* @param[in]    width   - Width of counter value in bytes, 1 to "FM25_COUNTER_WIDTH_MAX"
+* @param[out]   p_value - Counter value
+* @return       status  - Status of operation, "eFM25_ERROR" if counter was never set
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_counter_get(fm25_dev_t dev, const uint32_t addr, const uint8_t width, uint32_t * const p_value)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint8_t         copy    = 0U;
+    uint8_t         buf[FM25_COUNTER_SIZE( FM25_COUNTER_WIDTH_MAX )];
+
+    if  (   ( NULL == p_value )
+        ||  ( false == fm25_counter_is_valid_arg( dev, addr, width )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_counter_load( dev, addr, width, buf, &copy, p_value );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Add to counter
+*
+* @note     Costs single read of both copies and single write of bytes of
+*           older copy that differ from new value, two bytes per changed
+*           value byte. Increment by 1 usually writes two bytes.
+*
+* @param[in]    dev     - Device handle
+* @param[in]    addr    - Device address of counter
+* @param[in]    width   - Width of counter value in bytes, 1 to "FM25_COUNTER_WIDTH_MAX"
+* @param[in]    delta   - Value to add, up to half of counter range
+* @param[out]   p_value - New counter value, optional
+* @return       status  - Status of operation, "eFM25_ERROR" if counter was never set
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_counter_add(fm25_dev_t dev, const uint32_t addr, const uint8_t width, const uint32_t delta, uint32_t * const p_value)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint8_t         copy    = 0U;
+    uint32_t        value   = 0U;
+    uint8_t         buf[FM25_COUNTER_SIZE( FM25_COUNTER_WIDTH_MAX )];
+    uint8_t         image[FM25_COUNTER_COPY_SIZE( FM25_COUNTER_WIDTH_MAX )];
+
+    if  (   ( false == fm25_counter_is_valid_arg( dev, addr, width ))
+        ||  ( delta > ( FM25_COUNTER_MASK( width ) >> 1U )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_counter_load( dev, addr, width, buf, &copy, &value );
+
+        if ( eFM25_OK == status )
+        {
+            const uint8_t   older       = ( copy ^ 1U );
+            const uint8_t * p_older     = &buf[older * FM25_COUNTER_COPY_SIZE( width )];
+            uint32_t        first       = FM25_COUNTER_COPY_SIZE( width );
+            uint32_t        last        = 0U;
+
+            value = (( value + delta ) & FM25_COUNTER_MASK( width ));
+
+            fm25_counter_encode( value, width, image );
+
+            // Span of changed bytes
+            for ( uint32_t i = 0U; i < FM25_COUNTER_COPY_SIZE( width ); i++ )
+            {
+                if ( image[i] != p_older[i] )
+                {
+                    first   = ( i < first ) ? i : first;
+                    last    = i;
+                }
+            }
+
+            if ( first <= last )
+            {
+                status = fm25_write( dev, ( addr + ( older * FM25_COUNTER_COPY_SIZE( width )) + first ), (( last - first ) + 1U ), &image[first] );
+            }
+        }
+
+        if  (   ( eFM25_OK == status )
+            &&  ( NULL != p_value ))
+        {
+            *p_value = value;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
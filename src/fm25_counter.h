@@ -0,0 +1,60 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_counter.h
+*@brief     Torn write tolerant persistent counters on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_COUNTER
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_COUNTER_H_
+#define FM25_COUNTER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Maximum width of counter value in bytes
+ */
+#define FM25_COUNTER_WIDTH_MAX          ( 4U )
+
+/**
+ *     Size of counter on device in bytes
+ *
+ * @note    Two copies, each holds value and its complement.
+ */
+#define FM25_COUNTER_SIZE(width)        ( 4U * ( width ))
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_counter_set  (fm25_dev_t dev, const uint32_t addr, const uint8_t width, const uint32_t value);
+fm25_status_t fm25_counter_get  (fm25_dev_t dev, const uint32_t addr, const uint8_t width, uint32_t * const p_value);
+fm25_status_t fm25_counter_add  (fm25_dev_t dev, const uint32_t addr, const uint8_t width, const uint32_t delta, uint32_t * const p_value);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_COUNTER_H_
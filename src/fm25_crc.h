@@ -0,0 +1,56 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_crc.h
+*@brief     CRC calculation for FM25 FRAM data structures
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_CRC
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_CRC_H_
+#define FM25_CRC_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Initial value of CRC-32 calculation
+ *
+ * @note    Result of "fm25_crc32()" is passed as "crc" of next call in
+ *          order to calculate CRC of data in pieces.
+ */
+#define FM25_CRC32_INIT                 ( 0UL )
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+uint32_t        fm25_crc32          (const uint32_t crc, const uint8_t * const p_data, const uint32_t size);
+fm25_status_t   fm25_crc32_region   (fm25_dev_t dev, const uint32_t addr, const uint32_t size, uint32_t * const p_crc);
+fm25_status_t   fm25_compare        (fm25_dev_t dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, bool * const p_is_equal);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_CRC_H_
@@ -0,0 +1,922 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_kv.c
+*@brief     Key-value store on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_KV
+* @{ <!-- BEGIN GROUP -->
+*
+*     Hash table of string keys with values of bounded size.
+*
+*     Store region starts with header, followed by index of one 32-bit
+*     entry per bucket and value slot per bucket. Index entry holds hash
+*     of key stored in slot of the same bucket, collisions are resolved
+*     by linear probing. Slot holds hash, size, CRC-32 and key followed
+*     by value.
+*
+*     Values are overwritten in place, FRAM needs no erase. New key is
+*     written to slot before its index entry, thus interrupted insert
+*     leaves key absent. Header keeps additive checksum of index, it is
+*     updated with each index change and checked at mount. On mismatch
+*     or torn header write index is rebuilt from slots.
+*
+*     With RAM copy of index, lookup costs single read of slot.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_kv.h"
+#include "fm25_crc.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Store marker, "F5KV"
+ */
+#define FM25_KV_MAGIC                   ( 0x564B3546UL )
+
+/**
+ *     Index entries of empty and deleted bucket
+ */
+#define FM25_KV_EMPTY                   ( 0x00000000UL )
+#define FM25_KV_TOMB                    ( 0xFFFFFFFFUL )
+
+/**
+ *     Number of index entries read at once without RAM copy of index
+ */
+#define FM25_KV_CHUNK_NUM               ( 8U )
+
+/**
+ *     Slot record header
+ */
+typedef struct
+{
+    uint32_t    hash;                       /**<Hash of key, 0 for invalid slot */
+    uint16_t    size;                       /**<Size of value in bytes */
+    uint16_t    res;                        /**<Reserved */
+    uint32_t    crc;                        /**<CRC-32 of hash, size, key and value */
+    char        key[FM25_KV_KEY_SIZE];      /**<Key, zero padded */
+} fm25_kv_rec_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t         fm25_kv_hash        (const char * const p_key, char * const p_padded);
+static uint32_t         fm25_kv_mix         (const uint32_t idx, const uint32_t entry);
+static uint32_t         fm25_kv_hdr_crc     (const fm25_kv_hdr_t * const p_hdr);
+static uint32_t         fm25_kv_rec_crc     (const fm25_kv_rec_t * const p_rec, const uint8_t * const p_data);
+static uint32_t         fm25_kv_idx_addr    (const fm25_kv_t * const p_kv, const uint32_t idx);
+static uint32_t         fm25_kv_slot_addr   (const fm25_kv_t * const p_kv, const uint32_t idx);
+static bool             fm25_kv_is_valid_cfg(const fm25_kv_cfg_t * const p_cfg);
+static void             fm25_kv_layout      (fm25_kv_t * const p_kv, const fm25_kv_cfg_t * const p_cfg);
+static fm25_status_t    fm25_kv_read_entry  (fm25_kv_t * const p_kv, const uint32_t idx, uint32_t * const p_entry);
+static fm25_status_t    fm25_kv_write_entry (fm25_kv_t * const p_kv, const uint32_t idx, const uint32_t entry);
+static fm25_status_t    fm25_kv_set_entry   (fm25_kv_t * const p_kv, const uint32_t idx, const uint32_t old, const uint32_t entry);
+static fm25_status_t    fm25_kv_load        (fm25_kv_t * const p_kv, uint32_t * const p_sum);
+static fm25_status_t    fm25_kv_find        (fm25_kv_t * const p_kv, const char * const p_key, const uint32_t hash, fm25_kv_rec_t * const p_rec, uint8_t * const p_data, const uint32_t buf_size, uint32_t * const p_idx, uint32_t * const p_free, bool * const p_is_found);
+static fm25_status_t    fm25_kv_check_slot  (fm25_kv_t * const p_kv, const uint32_t idx, fm25_kv_rec_t * const p_rec, bool * const p_is_valid);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Hash key
+*
+* @note     FNV-1a. Hash values of empty and deleted bucket are remapped.
+*
+* @param[in]    p_key       - Key, zero terminated
+* @param[out]   p_padded    - Key, zero padded to "FM25_KV_KEY_SIZE"
+* @return       hash        - Hash of key, 0 for invalid key
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_kv_hash(const char * const p_key, char * const p_padded)
+{
+    uint32_t hash   = 2166136261UL;
+    uint32_t len    = 0U;
+
+    memset( p_padded, 0, FM25_KV_KEY_SIZE );
+
+    while (( len < FM25_KV_KEY_SIZE ) && ( '\0' != p_key[len] ))
+    {
+        p_padded[len] = p_key[len];
+
+        hash ^= (uint8_t) p_key[len];
+        hash *= 16777619UL;
+        len++;
+    }
+
+    if (( FM25_KV_EMPTY == hash ) || ( FM25_KV_TOMB == hash ))
+    {
+        hash = 1UL;
+    }
+
+    // Key must fit together with terminator
+    if (( 0U == len ) || ( FM25_KV_KEY_SIZE == len ))
+    {
+        hash = 0UL;
+    }
+
+    return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Contribution of index entry to index checksum
+*
+* @note     Bucket number is mixed in, thus swapped entries are detected.
+*
+* @param[in]    idx     - Bucket number
+* @param[in]    entry   - Index entry
+* @return       mix     - Contribution to checksum
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_kv_mix(const uint32_t idx, const uint32_t entry)
+{
+    return (( entry ^ ( idx * 0x9E3779B9UL )) * 0x85EBCA6BUL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Calculate CRC of header
+*
+* @param[in]    p_hdr   - Pointer to header
+* @return       crc     - CRC-32 of all fields but CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_kv_hdr_crc(const fm25_kv_hdr_t * const p_hdr)
+{
+    return fm25_crc32( FM25_CRC32_INIT, (const uint8_t*) p_hdr, ( sizeof( fm25_kv_hdr_t ) - sizeof( uint32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Calculate CRC of slot record
+*
+* @param[in]    p_rec   - Pointer to record header
+* @param[in]    p_data  - Pointer to value
+* @return       crc     - CRC-32 of hash, size, key and value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_kv_rec_crc(const fm25_kv_rec_t * const p_rec, const uint8_t * const p_data)
+{
+    uint32_t crc = FM25_CRC32_INIT;
+
+    crc = fm25_crc32( crc, (const uint8_t*) p_rec, ( 2U * sizeof( uint32_t )));
+    crc = fm25_crc32( crc, (const uint8_t*) p_rec->key, FM25_KV_KEY_SIZE );
+    crc = fm25_crc32( crc, p_data, p_rec->size );
+
+    return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get address of index entry
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    idx     - Bucket number
+* @return       addr    - Device address of index entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_kv_idx_addr(const fm25_kv_t * const p_kv, const uint32_t idx)
+{
+    return ( p_kv->cfg.addr + sizeof( fm25_kv_hdr_t ) + ( idx * sizeof( uint32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get address of value slot
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    idx     - Bucket number
+* @return       addr    - Device address of slot
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_kv_slot_addr(const fm25_kv_t * const p_kv, const uint32_t idx)
+{
+    return ( p_kv->slot_addr + ( idx * p_kv->slot_size ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check store configuration
+*
+* @param[in]    p_cfg       - Pointer to store configuration
+* @return       is_valid    - True if store fits into device and RAM index
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_kv_is_valid_cfg(const fm25_kv_cfg_t * const p_cfg)
+{
+    uint32_t mem_size = 0U;
+
+    return  (   ( NULL != p_cfg )
+            &&  ( eFM25_OK == fm25_get_size( p_cfg->dev, &mem_size ))
+            &&  ( p_cfg->addr < mem_size )
+            &&  ( p_cfg->size <= ( mem_size - p_cfg->addr ))
+            &&  ( p_cfg->value_max > 0U )
+            &&  ( p_cfg->value_max <= UINT16_MAX )
+            &&  ( p_cfg->size > sizeof( fm25_kv_hdr_t ))
+            &&  ( FM25_KV_BUCKET_NUM( p_cfg->size, p_cfg->value_max ) > 0U )
+            &&  (   ( NULL == p_cfg->p_index )
+                ||  ( p_cfg->index_size >= ( FM25_KV_BUCKET_NUM( p_cfg->size, p_cfg->value_max ) * sizeof( uint32_t )))));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Take configuration and compute region layout
+*
+* @param[out]   p_kv    - Pointer to store
+* @param[in]    p_cfg   - Pointer to store configuration
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_kv_layout(fm25_kv_t * const p_kv, const fm25_kv_cfg_t * const p_cfg)
+{
+    const uint32_t bucket_num = FM25_KV_BUCKET_NUM( p_cfg->size, p_cfg->value_max );
+
+    memset( p_kv, 0, sizeof( fm25_kv_t ));
+
+    p_kv->cfg               = *p_cfg;
+    p_kv->hdr.bucket_num    = bucket_num;
+    p_kv->slot_size         = ( FM25_KV_REC_SIZE + p_cfg->value_max );
+    p_kv->slot_addr         = ( p_cfg->addr + sizeof( fm25_kv_hdr_t ) + ( bucket_num * sizeof( uint32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read index entry
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    idx     - Bucket number
+* @param[out]   p_entry - Index entry
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_kv_read_entry(fm25_kv_t * const p_kv, const uint32_t idx, uint32_t * const p_entry)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if ( NULL != p_kv->cfg.p_index )
+    {
+        *p_entry = p_kv->cfg.p_index[idx];
+    }
+    else
+    {
+        status = fm25_read( p_kv->cfg.dev, fm25_kv_idx_addr( p_kv, idx ), sizeof( uint32_t ), (uint8_t*) p_entry );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Write index entry without checksum update
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    idx     - Bucket number
+* @param[in]    entry   - Index entry
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_kv_write_entry(fm25_kv_t * const p_kv, const uint32_t idx, const uint32_t entry)
+{
+    fm25_status_t status = eFM25_OK;
+
+    status = fm25_write( p_kv->cfg.dev, fm25_kv_idx_addr( p_kv, idx ), sizeof( uint32_t ), (const uint8_t*) &entry );
+
+    if  (   ( eFM25_OK == status )
+        &&  ( NULL != p_kv->cfg.p_index ))
+    {
+        p_kv->cfg.p_index[idx] = entry;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Change index entry and update checksum in header
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    idx     - Bucket number
+* @param[in]    old     - Current index entry
+* @param[in]    entry   - New index entry
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_kv_set_entry(fm25_kv_t * const p_kv, const uint32_t idx, const uint32_t old, const uint32_t entry)
+{
+    fm25_status_t status = eFM25_OK;
+
+    status = fm25_kv_write_entry( p_kv, idx, entry );
+
+    if ( eFM25_OK == status )
+    {
+        p_kv->hdr.idx_sum   = ( p_kv->hdr.idx_sum - fm25_kv_mix( idx, old ) + fm25_kv_mix( idx, entry ));
+        p_kv->hdr.crc       = fm25_kv_hdr_crc( &p_kv->hdr );
+
+        status = fm25_write( p_kv->cfg.dev, p_kv->cfg.addr, sizeof( fm25_kv_hdr_t ), (const uint8_t*) &p_kv->hdr );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Stream index and calculate its checksum
+*
+* @note     With RAM copy index is loaded by single read, otherwise it is
+*           streamed in chunks.
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[out]   p_sum   - Checksum of index
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_kv_load(fm25_kv_t * const p_kv, uint32_t * const p_sum)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        sum     = 0U;
+    uint32_t        chunk[FM25_KV_CHUNK_NUM];
+
+    if ( NULL != p_kv->cfg.p_index )
+    {
+        status = fm25_read( p_kv->cfg.dev, fm25_kv_idx_addr( p_kv, 0U ), ( p_kv->hdr.bucket_num * sizeof( uint32_t )), (uint8_t*) p_kv->cfg.p_index );
+
+        for ( uint32_t i = 0U; i < p_kv->hdr.bucket_num; i++ )
+        {
+            sum += fm25_kv_mix( i, p_kv->cfg.p_index[i] );
+        }
+    }
+    else
+    {
+        for ( uint32_t i = 0U; ( i < p_kv->hdr.bucket_num ) && ( eFM25_OK == status ); i += FM25_KV_CHUNK_NUM )
+        {
+            const uint32_t num = (( p_kv->hdr.bucket_num - i ) > FM25_KV_CHUNK_NUM ) ? FM25_KV_CHUNK_NUM : ( p_kv->hdr.bucket_num - i );
+
+            status = fm25_read( p_kv->cfg.dev, fm25_kv_idx_addr( p_kv, i ), ( num * sizeof( uint32_t )), (uint8_t*) chunk );
+
+            for ( uint32_t j = 0U; j < num; j++ )
+            {
+                sum += fm25_kv_mix(( i + j ), chunk[j] );
+            }
+        }
+    }
+
+    *p_sum = sum;
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Find key
+*
+* @note     Record of each bucket with matching hash is read together with
+*           value as single read command, thus lookup with RAM copy of
+*           index costs single read.
+*
+* @param[in]    p_kv        - Pointer to store
+* @param[in]    p_key       - Key, zero padded
+* @param[in]    hash        - Hash of key
+* @param[out]   p_rec       - Record of found key
+* @param[out]   p_data      - Value of found key, NULL to skip value
+* @param[in]    buf_size    - Size of value buffer
+* @param[out]   p_idx       - Bucket of found key
+* @param[out]   p_free      - First free bucket on probe path, "bucket_num" if none
+* @param[out]   p_is_found  - True if key is found
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_kv_find(fm25_kv_t * const p_kv, const char * const p_key, const uint32_t hash, fm25_kv_rec_t * const p_rec, uint8_t * const p_data, const uint32_t buf_size, uint32_t * const p_idx, uint32_t * const p_free, bool * const p_is_found)
+{
+    fm25_status_t   status      = eFM25_OK;
+    const uint32_t  bucket_num  = p_kv->hdr.bucket_num;
+    const uint32_t  val_size    = ( buf_size < p_kv->cfg.value_max ) ? buf_size : p_kv->cfg.value_max;
+    uint32_t        idx         = ( hash % bucket_num );
+    bool            is_end      = false;
+
+    *p_free     = bucket_num;
+    *p_is_found = false;
+
+    for ( uint32_t n = 0U; ( n < bucket_num ) && ( false == is_end ) && ( eFM25_OK == status ); n++ )
+    {
+        uint32_t entry = FM25_KV_EMPTY;
+
+        status = fm25_kv_read_entry( p_kv, idx, &entry );
+
+        if (( FM25_KV_EMPTY == entry ) || ( FM25_KV_TOMB == entry ))
+        {
+            if ( bucket_num == *p_free )
+            {
+                *p_free = idx;
+            }
+
+            // Deleted bucket does not end probe path
+            is_end = ( FM25_KV_EMPTY == entry );
+        }
+        else if ( hash == entry )
+        {
+            fm25_iov_t iov[2] =
+            {
+                { .addr = fm25_kv_slot_addr( p_kv, idx ), .size = FM25_KV_REC_SIZE, .p_data = (uint8_t*) p_rec },
+                { .addr = ( fm25_kv_slot_addr( p_kv, idx ) + FM25_KV_REC_SIZE ), .size = val_size, .p_data = p_data },
+            };
+
+            status |= fm25_readv( p_kv->cfg.dev, iov, ((( NULL != p_data ) && ( val_size > 0U )) ? 2U : 1U ));
+
+            if  (   ( eFM25_OK == status )
+                &&  ( hash == p_rec->hash )
+                &&  ( 0 == memcmp( p_rec->key, p_key, FM25_KV_KEY_SIZE )))
+            {
+                *p_idx      = idx;
+                *p_is_found = true;
+                is_end      = true;
+            }
+        }
+        else
+        {
+            // Other key
+        }
+
+        idx = ((( idx + 1U ) < bucket_num ) ? ( idx + 1U ) : 0U );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check value slot
+*
+* @note     Value is streamed through small stack buffer.
+*
+* @param[in]    p_kv        - Pointer to store
+* @param[in]    idx         - Bucket number
+* @param[out]   p_rec       - Record header of slot
+* @param[out]   p_is_valid  - True if slot holds record with valid CRC
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_kv_check_slot(fm25_kv_t * const p_kv, const uint32_t idx, fm25_kv_rec_t * const p_rec, bool * const p_is_valid)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        crc     = FM25_CRC32_INIT;
+    uint32_t        done    = 0U;
+    uint8_t         chunk[32];
+
+    status = fm25_read( p_kv->cfg.dev, fm25_kv_slot_addr( p_kv, idx ), FM25_KV_REC_SIZE, (uint8_t*) p_rec );
+
+    *p_is_valid =   (   ( eFM25_OK == status )
+                    &&  ( FM25_KV_EMPTY != p_rec->hash )
+                    &&  ( FM25_KV_TOMB != p_rec->hash )
+                    &&  ( p_rec->size <= p_kv->cfg.value_max ));
+
+    if ( true == *p_is_valid )
+    {
+        crc = fm25_crc32( crc, (const uint8_t*) p_rec, ( 2U * sizeof( uint32_t )));
+        crc = fm25_crc32( crc, (const uint8_t*) p_rec->key, FM25_KV_KEY_SIZE );
+
+        while (( done < p_rec->size ) && ( eFM25_OK == status ))
+        {
+            const uint32_t num = (( p_rec->size - done ) > sizeof( chunk )) ? sizeof( chunk ) : ( p_rec->size - done );
+
+            status = fm25_read( p_kv->cfg.dev, ( fm25_kv_slot_addr( p_kv, idx ) + FM25_KV_REC_SIZE + done ), num, chunk );
+
+            crc     = fm25_crc32( crc, chunk, num );
+            done   += num;
+        }
+
+        *p_is_valid = (( eFM25_OK == status ) && ( crc == p_rec->crc ));
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_KV
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 key-value store API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Format store region
+*
+* @note     Whole region is cleared, thus stale slots can not reappear
+*           by index rebuild.
+*
+* @param[out]   p_kv    - Pointer to store
+* @param[in]    p_cfg   - Pointer to store configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_kv_format(fm25_kv_t * const p_kv, const fm25_kv_cfg_t * const p_cfg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    FM25_ASSERT( NULL != p_kv );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_kv )
+        ||  ( false == fm25_kv_is_valid_cfg( p_cfg )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        fm25_kv_layout( p_kv, p_cfg );
+
+        status = fm25_fill( p_cfg->dev, p_cfg->addr, p_cfg->size, 0U, 1U );
+
+        if ( NULL != p_cfg->p_index )
+        {
+            memset( p_cfg->p_index, 0, ( p_kv->hdr.bucket_num * sizeof( uint32_t )));
+        }
+
+        p_kv->hdr.magic     = FM25_KV_MAGIC;
+        p_kv->hdr.value_max = p_cfg->value_max;
+
+        for ( uint32_t i = 0U; i < p_kv->hdr.bucket_num; i++ )
+        {
+            p_kv->hdr.idx_sum += fm25_kv_mix( i, FM25_KV_EMPTY );
+        }
+
+        p_kv->hdr.crc = fm25_kv_hdr_crc( &p_kv->hdr );
+
+        status |= fm25_write( p_cfg->dev, p_cfg->addr, sizeof( fm25_kv_hdr_t ), (const uint8_t*) &p_kv->hdr );
+
+        p_kv->is_mount = ( eFM25_OK == status );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Mount store
+*
+* @note     Index is streamed once and its checksum compared against
+*           header. On mismatch index is rebuilt from slots, which takes
+*           single pass over slot area. Header with valid geometry but
+*           bad CRC is left by interrupted checksum update and is
+*           rebuilt the same way.
+*
+* @param[out]   p_kv    - Pointer to store
+* @param[in]    p_cfg   - Pointer to store configuration
+* @return       status  - "eFM25_ERROR_INIT" if region holds no store
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_kv_mount(fm25_kv_t * const p_kv, const fm25_kv_cfg_t * const p_cfg)
+{
+    fm25_status_t   status  = eFM25_OK;
+    fm25_kv_hdr_t   hdr     = { 0 };
+    uint32_t        sum     = 0U;
+
+    FM25_ASSERT( NULL != p_kv );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_kv )
+        ||  ( false == fm25_kv_is_valid_cfg( p_cfg )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        fm25_kv_layout( p_kv, p_cfg );
+
+        status = fm25_read( p_cfg->dev, p_cfg->addr, sizeof( fm25_kv_hdr_t ), (uint8_t*) &hdr );
+
+        if  (   ( eFM25_OK == status )
+            &&  (   ( FM25_KV_MAGIC != hdr.magic )
+                ||  ( p_kv->hdr.bucket_num != hdr.bucket_num )
+                ||  ( p_cfg->value_max != hdr.value_max )))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+
+        if ( eFM25_OK == status )
+        {
+            p_kv->hdr       = hdr;
+            p_kv->is_mount  = true;
+
+            status = fm25_kv_load( p_kv, &sum );
+        }
+
+        // Index out of sync with checksum or torn header write
+        if  (   ( eFM25_OK == status )
+            &&  (   ( sum != p_kv->hdr.idx_sum )
+                ||  ( fm25_kv_hdr_crc( &hdr ) != hdr.crc )))
+        {
+            status = fm25_kv_rebuild( p_kv );
+
+            p_kv->is_rebuilt = true;
+        }
+
+        p_kv->is_mount = ( eFM25_OK == status );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Set value of key
+*
+* @note     Existing key is overwritten in place by single write command.
+*           New key costs slot write, index entry write and header write.
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    p_key   - Key, zero terminated, shorter than "FM25_KV_KEY_SIZE"
+* @param[in]    p_data  - Pointer to value
+* @param[in]    size    - Size of value in bytes
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_kv_set(fm25_kv_t * const p_kv, const char * const p_key, const uint8_t * const p_data, const uint32_t size)
+{
+    fm25_status_t   status      = eFM25_OK;
+    fm25_kv_rec_t   rec         = { 0 };
+    char            key[FM25_KV_KEY_SIZE];
+    uint32_t        hash        = 0U;
+    uint32_t        idx         = 0U;
+    uint32_t        free_idx    = 0U;
+    bool            is_found    = false;
+
+    if (( NULL == p_kv ) || ( false == p_kv->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (   ( NULL == p_key )
+            ||  ( NULL == p_data )
+            ||  ( size > p_kv->cfg.value_max )
+            ||  ( 0U == ( hash = fm25_kv_hash( p_key, key ))))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_kv_find( p_kv, key, hash, &rec, NULL, 0U, &idx, &free_idx, &is_found );
+
+        if ( false == is_found )
+        {
+            // Store full
+            if ( p_kv->hdr.bucket_num == free_idx )
+            {
+                status |= eFM25_ERROR;
+            }
+
+            idx = free_idx;
+        }
+
+        if ( eFM25_OK == status )
+        {
+            rec.hash    = hash;
+            rec.size    = (uint16_t) size;
+            rec.res     = 0U;
+            memcpy( rec.key, key, FM25_KV_KEY_SIZE );
+            rec.crc     = fm25_kv_rec_crc( &rec, p_data );
+
+            // NOTE: Vectored write does not modify data
+            const fm25_iov_t iov[2] =
+            {
+                { .addr = fm25_kv_slot_addr( p_kv, idx ), .size = FM25_KV_REC_SIZE, .p_data = (uint8_t*) &rec },
+                { .addr = ( fm25_kv_slot_addr( p_kv, idx ) + FM25_KV_REC_SIZE ), .size = size, .p_data = (uint8_t*) p_data },
+            };
+
+            status = fm25_writev( p_kv->cfg.dev, iov, (( size > 0U ) ? 2U : 1U ));
+        }
+
+        // Publish new key once slot is written
+        if  (   ( eFM25_OK == status )
+            &&  ( false == is_found ))
+        {
+            uint32_t old = FM25_KV_EMPTY;
+
+            status = fm25_kv_read_entry( p_kv, idx, &old );
+            status |= fm25_kv_set_entry( p_kv, idx, old, hash );
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get value of key
+*
+* @param[in]    p_kv        - Pointer to store
+* @param[in]    p_key       - Key, zero terminated
+* @param[out]   p_data      - Pointer to value buffer
+* @param[in]    buf_size    - Size of value buffer in bytes
+* @param[out]   p_size      - Size of value, 0 if key is not found
+* @return       status      - Status of operation, "eFM25_ERROR" on CRC mismatch
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_kv_get(fm25_kv_t * const p_kv, const char * const p_key, uint8_t * const p_data, const uint32_t buf_size, uint32_t * const p_size)
+{
+    fm25_status_t   status      = eFM25_OK;
+    fm25_kv_rec_t   rec         = { 0 };
+    char            key[FM25_KV_KEY_SIZE];
+    uint32_t        hash        = 0U;
+    uint32_t        idx         = 0U;
+    uint32_t        free_idx    = 0U;
+    bool            is_found    = false;
+
+    if (( NULL == p_kv ) || ( false == p_kv->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (   ( NULL == p_key )
+            ||  ( NULL == p_data )
+            ||  ( NULL == p_size )
+            ||  ( 0U == ( hash = fm25_kv_hash( p_key, key ))))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        *p_size = 0U;
+
+        status = fm25_kv_find( p_kv, key, hash, &rec, p_data, buf_size, &idx, &free_idx, &is_found );
+
+        if  (   ( eFM25_OK == status )
+            &&  ( true == is_found ))
+        {
+            if  (   ( rec.size > buf_size )
+                ||  ( rec.size > p_kv->cfg.value_max )
+                ||  ( fm25_kv_rec_crc( &rec, p_data ) != rec.crc ))
+            {
+                status = eFM25_ERROR;
+            }
+            else
+            {
+                *p_size = rec.size;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Delete key
+*
+* @note     Deleting missing key is not an error.
+*
+* @param[in]    p_kv    - Pointer to store
+* @param[in]    p_key   - Key, zero terminated
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_kv_delete(fm25_kv_t * const p_kv, const char * const p_key)
+{
+    fm25_status_t   status      = eFM25_OK;
+    fm25_kv_rec_t   rec         = { 0 };
+    char            key[FM25_KV_KEY_SIZE];
+    uint32_t        hash        = 0U;
+    uint32_t        idx         = 0U;
+    uint32_t        free_idx    = 0U;
+    bool            is_found    = false;
+
+    if (( NULL == p_kv ) || ( false == p_kv->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (   ( NULL == p_key )
+            ||  ( 0U == ( hash = fm25_kv_hash( p_key, key ))))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_kv_find( p_kv, key, hash, &rec, NULL, 0U, &idx, &free_idx, &is_found );
+
+        if  (   ( eFM25_OK == status )
+            &&  ( true == is_found ))
+        {
+            const uint32_t invalid = FM25_KV_EMPTY;
+
+            // Invalidate slot first, thus interrupted delete cannot leave
+            // valid slot behind tombstone to reappear by index rebuild
+            status = fm25_write( p_kv->cfg.dev, fm25_kv_slot_addr( p_kv, idx ), sizeof( uint32_t ), (const uint8_t*) &invalid );
+
+            if ( eFM25_OK == status )
+            {
+                status = fm25_kv_set_entry( p_kv, idx, hash, FM25_KV_TOMB );
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Rebuild index from slots
+*
+* @note     Each bucket gets hash of its slot when slot CRC is valid.
+*           Empty buckets on probe path of valid slot are marked deleted,
+*           thus each key stays reachable from its home bucket.
+*
+* @param[in]    p_kv    - Pointer to store
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_kv_rebuild(fm25_kv_t * const p_kv)
+{
+    fm25_status_t   status      = eFM25_OK;
+    fm25_kv_rec_t   rec         = { 0 };
+    uint32_t        bucket_num  = 0U;
+    bool            is_valid    = false;
+
+    if (( NULL == p_kv ) || ( false == p_kv->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        bucket_num = p_kv->hdr.bucket_num;
+
+        // Index entries from slots
+        for ( uint32_t i = 0U; ( i < bucket_num ) && ( eFM25_OK == status ); i++ )
+        {
+            status = fm25_kv_check_slot( p_kv, i, &rec, &is_valid );
+            status |= fm25_kv_write_entry( p_kv, i, (( true == is_valid ) ? rec.hash : FM25_KV_EMPTY ));
+        }
+
+        // Close gaps on probe paths
+        for ( uint32_t i = 0U; ( i < bucket_num ) && ( eFM25_OK == status ); i++ )
+        {
+            uint32_t entry = FM25_KV_EMPTY;
+
+            status = fm25_kv_read_entry( p_kv, i, &entry );
+
+            if (( FM25_KV_EMPTY != entry ) && ( FM25_KV_TOMB != entry ))
+            {
+                for ( uint32_t j = ( entry % bucket_num ); ( j != i ) && ( eFM25_OK == status ); j = ((( j + 1U ) < bucket_num ) ? ( j + 1U ) : 0U ))
+                {
+                    uint32_t gap = FM25_KV_EMPTY;
+
+                    status = fm25_kv_read_entry( p_kv, j, &gap );
+
+                    if (( eFM25_OK == status ) && ( FM25_KV_EMPTY == gap ))
+                    {
+                        status = fm25_kv_write_entry( p_kv, j, FM25_KV_TOMB );
+                    }
+                }
+            }
+        }
+
+        // New checksum
+        if ( eFM25_OK == status )
+        {
+            status = fm25_kv_load( p_kv, &p_kv->hdr.idx_sum );
+        }
+
+        if ( eFM25_OK == status )
+        {
+            p_kv->hdr.crc = fm25_kv_hdr_crc( &p_kv->hdr );
+
+            status = fm25_write( p_kv->cfg.dev, p_kv->cfg.addr, sizeof( fm25_kv_hdr_t ), (const uint8_t*) &p_kv->hdr );
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
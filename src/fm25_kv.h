@@ -0,0 +1,110 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_kv.h
+*@brief     Key-value store on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_KV
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_KV_H_
+#define FM25_KV_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of key storage in bytes, terminator included
+ */
+#define FM25_KV_KEY_SIZE                ( 16U )
+
+/**
+ *     Size of record header in bytes, key included
+ */
+#define FM25_KV_REC_SIZE                ( 12U + FM25_KV_KEY_SIZE )
+
+/**
+ *     Number of buckets of store region
+ *
+ * @note    Each bucket takes index entry and value slot.
+ */
+#define FM25_KV_BUCKET_NUM(size, value_max)     ((( size ) - sizeof( fm25_kv_hdr_t )) / ( sizeof( uint32_t ) + FM25_KV_REC_SIZE + ( value_max )))
+
+/**
+ *     Store configuration
+ */
+typedef struct
+{
+    fm25_dev_t  dev;            /**<Device handle */
+    uint32_t    addr;           /**<Start address of store region */
+    uint32_t    size;           /**<Size of store region in bytes */
+    uint32_t    value_max;      /**<Maximum size of value in bytes */
+    uint32_t *  p_index;        /**<RAM copy of index, one entry per bucket, NULL to disable */
+    uint32_t    index_size;     /**<Size of RAM copy of index in bytes */
+} fm25_kv_cfg_t;
+
+/**
+ *     Store header
+ *
+ * @note    Treat as opaque!
+ */
+typedef struct
+{
+    uint32_t    magic;          /**<Store marker */
+    uint32_t    bucket_num;     /**<Number of buckets */
+    uint32_t    value_max;      /**<Maximum size of value */
+    uint32_t    idx_sum;        /**<Checksum of index */
+    uint32_t    crc;            /**<CRC-32 of preceding fields */
+} fm25_kv_hdr_t;
+
+/**
+ *     Key-value store
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_kv_cfg_t   cfg;        /**<Configuration */
+    fm25_kv_hdr_t   hdr;        /**<Header */
+    uint32_t        slot_addr;  /**<Address of first value slot */
+    uint32_t        slot_size;  /**<Size of value slot in bytes */
+    bool            is_rebuilt; /**<Index was rebuilt at mount */
+    bool            is_mount;   /**<Mount guard */
+} fm25_kv_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_kv_format    (fm25_kv_t * const p_kv, const fm25_kv_cfg_t * const p_cfg);
+fm25_status_t fm25_kv_mount     (fm25_kv_t * const p_kv, const fm25_kv_cfg_t * const p_cfg);
+fm25_status_t fm25_kv_set       (fm25_kv_t * const p_kv, const char * const p_key, const uint8_t * const p_data, const uint32_t size);
+fm25_status_t fm25_kv_get       (fm25_kv_t * const p_kv, const char * const p_key, uint8_t * const p_data, const uint32_t buf_size, uint32_t * const p_size);
+fm25_status_t fm25_kv_delete    (fm25_kv_t * const p_kv, const char * const p_key);
+fm25_status_t fm25_kv_rebuild   (fm25_kv_t * const p_kv);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_KV_H_
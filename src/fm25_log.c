@@ -0,0 +1,853 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_log.c
+*@brief     Crash consistent ring log on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_LOG
+* @{ <!-- BEGIN GROUP -->
+*
+*     Append only log of variable length records in a ring.
+*
+*     Log region starts with two superblock copies followed by record
+*     ring. Each record is prefixed by header with sequence number, size
+*     and CRC-32 of header and payload. Superblock keeps head and tail of
+*     ring and is committed to older copy every "commit_num" appends, or
+*     before oldest records get overwritten.
+*
+*     Records appended after last commit are rolled forward at mount by
+*     following their headers from committed tail. Roll forward stops at
+*     first record with unexpected sequence number or bad CRC, at most
+*     "commit_num" records are checked, thus mount time is bounded.
+*
+*     Record crossing end of ring is written as two segments of single
+*     vectored write.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_log.h"
+#include "fm25_crc.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Superblock marker, "F25L"
+ */
+#define FM25_LOG_MAGIC                  ( 0x4C353246UL )
+
+/**
+ *     Size of payload chunk checked at once during roll forward
+ */
+#define FM25_LOG_CHUNK_SIZE             ( 32U )
+
+/**
+ *     Record header
+ */
+typedef struct
+{
+    uint32_t    seq;        /**<Sequence number */
+    uint32_t    size;       /**<Size of payload in bytes */
+    uint32_t    crc;        /**<CRC-32 of sequence number, size and payload */
+} fm25_log_hdr_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t         fm25_log_iov        (const fm25_log_t * const p_log, fm25_iov_t * const p_iov, const uint32_t off, uint8_t * const p_data, const uint32_t size);
+static uint32_t         fm25_log_wrap       (const fm25_log_t * const p_log, const uint32_t off, const uint32_t size);
+static uint32_t         fm25_log_used       (const fm25_log_t * const p_log);
+static uint32_t         fm25_log_sb_crc     (const fm25_log_sb_t * const p_sb);
+static bool             fm25_log_is_valid_sb(const fm25_log_t * const p_log, const fm25_log_sb_t * const p_sb);
+static bool             fm25_log_is_valid_cfg(const fm25_log_cfg_t * const p_cfg);
+static fm25_status_t    fm25_log_read_sb    (fm25_log_t * const p_log, const fm25_log_cfg_t * const p_cfg, bool * const p_is_sb);
+static fm25_status_t    fm25_log_commit     (fm25_log_t * const p_log);
+static fm25_status_t    fm25_log_read_hdr   (fm25_log_t * const p_log, const uint32_t off, const uint32_t seq, fm25_log_hdr_t * const p_hdr, bool * const p_is_valid);
+static fm25_status_t    fm25_log_check_rec  (fm25_log_t * const p_log, const uint32_t off, const fm25_log_hdr_t * const p_hdr, bool * const p_is_valid);
+static fm25_status_t    fm25_log_roll       (fm25_log_t * const p_log);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Map ring range to device segments
+*
+* @param[in]    p_log   - Pointer to log
+* @param[out]   p_iov   - Segments, room for two
+* @param[in]    off     - Ring offset
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of range in bytes
+* @return       num     - Number of segments, 2 when range crosses end of ring
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_log_iov(const fm25_log_t * const p_log, fm25_iov_t * const p_iov, const uint32_t off, uint8_t * const p_data, const uint32_t size)
+{
+    const uint32_t  base    = ( p_log->cfg.addr + ( 2U * FM25_LOG_SB_SIZE ));
+    const uint32_t  first   = (( p_log->ring_size - off ) < size ) ? ( p_log->ring_size - off ) : size;
+    uint32_t        num     = 1U;
+
+    p_iov[0] = (fm25_iov_t) { .addr = ( base + off ), .size = first, .p_data = p_data };
+
+    if ( first < size )
+    {
+        p_iov[1] = (fm25_iov_t) { .addr = base, .size = ( size - first ), .p_data = &p_data[first] };
+        num = 2U;
+    }
+
+    return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Advance ring offset
+*
+* @param[in]    p_log   - Pointer to log
+* @param[in]    off     - Ring offset
+* @param[in]    size    - Number of bytes to advance
+* @return       off     - Advanced ring offset
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_log_wrap(const fm25_log_t * const p_log, const uint32_t off, const uint32_t size)
+{
+    return ((( p_log->ring_size - off ) > size ) ? ( off + size ) : ( size - ( p_log->ring_size - off )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get number of bytes taken by records
+*
+* @param[in]    p_log   - Pointer to log
+* @return       used    - Bytes taken by records, headers included
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_log_used(const fm25_log_t * const p_log)
+{
+    uint32_t used = 0U;
+
+    if ( p_log->sb.tail_seq != p_log->sb.head_seq )
+    {
+        used = ( p_log->sb.tail > p_log->sb.head )
+             ? ( p_log->sb.tail - p_log->sb.head )
+             : ( p_log->ring_size - p_log->sb.head + p_log->sb.tail );
+    }
+
+    return used;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Calculate CRC of superblock
+*
+* @param[in]    p_sb    - Pointer to superblock
+* @return       crc     - CRC-32 of all fields but CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_log_sb_crc(const fm25_log_sb_t * const p_sb)
+{
+    return fm25_crc32( FM25_CRC32_INIT, (const uint8_t*) p_sb, ( FM25_LOG_SB_SIZE - sizeof( uint32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check superblock copy
+*
+* @param[in]    p_log       - Pointer to log
+* @param[in]    p_sb        - Pointer to superblock
+* @return       is_valid    - True if superblock belongs to this log region
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_log_is_valid_sb(const fm25_log_t * const p_log, const fm25_log_sb_t * const p_sb)
+{
+    return  (   ( FM25_LOG_MAGIC == p_sb->magic )
+            &&  ( p_log->cfg.size == p_sb->size )
+            &&  ( p_sb->head < p_log->ring_size )
+            &&  ( p_sb->tail < p_log->ring_size )
+            &&  ( fm25_log_sb_crc( p_sb ) == p_sb->crc ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check log configuration
+*
+* @param[in]    p_cfg       - Pointer to log configuration
+* @return       is_valid    - True if log region fits into device
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_log_is_valid_cfg(const fm25_log_cfg_t * const p_cfg)
+{
+    uint32_t mem_size = 0U;
+
+    return  (   ( NULL != p_cfg )
+            &&  ( eFM25_OK == fm25_get_size( p_cfg->dev, &mem_size ))
+            &&  ( p_cfg->size >= FM25_LOG_SIZE_MIN )
+            &&  ( p_cfg->addr < mem_size )
+            &&  ( p_cfg->size <= ( mem_size - p_cfg->addr ))
+            &&  ( p_cfg->commit_num > 0U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Take configuration and load newer valid superblock
+*
+* @param[out]   p_log   - Pointer to log
+* @param[in]    p_cfg   - Pointer to log configuration
+* @param[out]   p_is_sb - True if valid superblock is found
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_log_read_sb(fm25_log_t * const p_log, const fm25_log_cfg_t * const p_cfg, bool * const p_is_sb)
+{
+    fm25_status_t   status  = eFM25_OK;
+    fm25_log_sb_t   sb[2];
+
+    memset( p_log, 0, sizeof( fm25_log_t ));
+
+    p_log->cfg          = *p_cfg;
+    p_log->ring_size    = ( p_cfg->size - ( 2U * FM25_LOG_SB_SIZE ));
+
+    // Both copies are adjacent
+    status = fm25_read( p_cfg->dev, p_cfg->addr, sizeof( sb ), (uint8_t*) sb );
+
+    if ( eFM25_OK == status )
+    {
+        const bool is_valid_0 = fm25_log_is_valid_sb( p_log, &sb[0] );
+        const bool is_valid_1 = fm25_log_is_valid_sb( p_log, &sb[1] );
+
+        if (( true == is_valid_0 ) && ( true == is_valid_1 ))
+        {
+            // Generation may wrap around
+            p_log->sb = ((int32_t)( sb[1].gen - sb[0].gen ) > 0 ) ? sb[1] : sb[0];
+        }
+        else if ( true == is_valid_0 )
+        {
+            p_log->sb = sb[0];
+        }
+        else if ( true == is_valid_1 )
+        {
+            p_log->sb = sb[1];
+        }
+        else
+        {
+            // No valid copy
+        }
+
+        *p_is_sb = (( true == is_valid_0 ) || ( true == is_valid_1 ));
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Commit superblock
+*
+* @note     Written to copy not holding current superblock, thus one
+*           valid copy survives power loss during write.
+*
+* @param[in]    p_log   - Pointer to log
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_log_commit(fm25_log_t * const p_log)
+{
+    fm25_status_t status = eFM25_OK;
+
+    p_log->sb.gen++;
+    p_log->sb.crc = fm25_log_sb_crc( &p_log->sb );
+
+    status = fm25_write( p_log->cfg.dev, ( p_log->cfg.addr + (( p_log->sb.gen & 1U ) * FM25_LOG_SB_SIZE )), FM25_LOG_SB_SIZE, (const uint8_t*) &p_log->sb );
+
+    if ( eFM25_OK == status )
+    {
+        p_log->pending = 0U;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read record header
+*
+* @param[in]    p_log       - Pointer to log
+* @param[in]    off         - Ring offset of record
+* @param[in]    seq         - Expected sequence number
+* @param[out]   p_hdr       - Pointer to header
+* @param[out]   p_is_valid  - True if header has expected sequence number and fits into ring
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_log_read_hdr(fm25_log_t * const p_log, const uint32_t off, const uint32_t seq, fm25_log_hdr_t * const p_hdr, bool * const p_is_valid)
+{
+    fm25_status_t   status  = eFM25_OK;
+    fm25_iov_t      iov[2];
+
+    const uint32_t iov_num = fm25_log_iov( p_log, iov, off, (uint8_t*) p_hdr, FM25_LOG_HDR_SIZE );
+
+    status = fm25_readv( p_log->cfg.dev, iov, iov_num );
+
+    *p_is_valid =   (   ( eFM25_OK == status )
+                    &&  ( seq == p_hdr->seq )
+                    &&  ( p_hdr->size > 0U )
+                    &&  ( p_hdr->size <= ( p_log->ring_size - FM25_LOG_HDR_SIZE )));
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check CRC of record
+*
+* @note     Payload is streamed through small stack buffer.
+*
+* @param[in]    p_log       - Pointer to log
+* @param[in]    off         - Ring offset of record
+* @param[in]    p_hdr       - Pointer to header of record
+* @param[out]   p_is_valid  - True if CRC matches
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_log_check_rec(fm25_log_t * const p_log, const uint32_t off, const fm25_log_hdr_t * const p_hdr, bool * const p_is_valid)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint32_t        crc     = fm25_crc32( FM25_CRC32_INIT, (const uint8_t*) p_hdr, ( 2U * sizeof( uint32_t )));
+    uint32_t        cur     = fm25_log_wrap( p_log, off, FM25_LOG_HDR_SIZE );
+    uint32_t        left    = p_hdr->size;
+    uint8_t         chunk[FM25_LOG_CHUNK_SIZE];
+    fm25_iov_t      iov[2];
+
+    while (( left > 0U ) && ( eFM25_OK == status ))
+    {
+        const uint32_t num      = ( left > FM25_LOG_CHUNK_SIZE ) ? FM25_LOG_CHUNK_SIZE : left;
+        const uint32_t iov_num  = fm25_log_iov( p_log, iov, cur, chunk, num );
+
+        status = fm25_readv( p_log->cfg.dev, iov, iov_num );
+
+        crc     = fm25_crc32( crc, chunk, num );
+        cur     = fm25_log_wrap( p_log, cur, num );
+        left   -= num;
+    }
+
+    *p_is_valid = (( eFM25_OK == status ) && ( crc == p_hdr->crc ));
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Roll forward records appended after last commit
+*
+* @param[in]    p_log   - Pointer to log
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_log_roll(fm25_log_t * const p_log)
+{
+    fm25_status_t   status      = eFM25_OK;
+    bool            is_valid    = true;
+    fm25_log_hdr_t  hdr         = { 0 };
+
+    while   (   ( eFM25_OK == status )
+            &&  ( true == is_valid )
+            &&  ( p_log->recovered < p_log->cfg.commit_num ))
+    {
+        status = fm25_log_read_hdr( p_log, p_log->sb.tail, p_log->sb.tail_seq, &hdr, &is_valid );
+
+        // Record must not overlap oldest one
+        is_valid &= (( FM25_LOG_HDR_SIZE + hdr.size ) <= ( p_log->ring_size - fm25_log_used( p_log )));
+
+        if ( true == is_valid )
+        {
+            status |= fm25_log_check_rec( p_log, p_log->sb.tail, &hdr, &is_valid );
+        }
+
+        if ( true == is_valid )
+        {
+            p_log->sb.tail = fm25_log_wrap( p_log, p_log->sb.tail, ( FM25_LOG_HDR_SIZE + hdr.size ));
+            p_log->sb.tail_seq++;
+            p_log->recovered++;
+        }
+    }
+
+    // Make recovered records part of superblock
+    if  (   ( eFM25_OK == status )
+        &&  ( p_log->recovered > 0U ))
+    {
+        status = fm25_log_commit( p_log );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_LOG
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 ring log API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Format log region
+*
+* @note     Both superblock copies are written. Sequence numbers and
+*           generation continue from previous log in the same region, so
+*           stale records are never mistaken for new ones.
+*
+* @param[out]   p_log   - Pointer to log
+* @param[in]    p_cfg   - Pointer to log configuration
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_format(fm25_log_t * const p_log, const fm25_log_cfg_t * const p_cfg)
+{
+    fm25_status_t   status  = eFM25_OK;
+    bool            is_sb   = false;
+
+    FM25_ASSERT( NULL != p_log );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_log )
+        ||  ( false == fm25_log_is_valid_cfg( p_cfg )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_log_read_sb( p_log, p_cfg, &is_sb );
+
+        if ( eFM25_OK == status )
+        {
+            const uint32_t seq = ( true == is_sb ) ? ( p_log->sb.tail_seq + p_cfg->commit_num ) : 0U;
+
+            p_log->sb.magic     = FM25_LOG_MAGIC;
+            p_log->sb.size      = p_cfg->size;
+            p_log->sb.head      = 0U;
+            p_log->sb.tail      = 0U;
+            p_log->sb.head_seq  = seq;
+            p_log->sb.tail_seq  = seq;
+
+            // Write both copies
+            status = fm25_log_commit( p_log );
+            status |= fm25_log_commit( p_log );
+        }
+
+        p_log->is_mount = ( eFM25_OK == status );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Mount log
+*
+* @note     Newer valid superblock is loaded and records appended after
+*           its commit are rolled forward. At most "commit_num" records
+*           are checked.
+*
+* @param[out]   p_log   - Pointer to log
+* @param[in]    p_cfg   - Pointer to log configuration
+* @return       status  - "eFM25_ERROR_INIT" if region holds no log
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_mount(fm25_log_t * const p_log, const fm25_log_cfg_t * const p_cfg)
+{
+    fm25_status_t   status  = eFM25_OK;
+    bool            is_sb   = false;
+
+    FM25_ASSERT( NULL != p_log );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL == p_log )
+        ||  ( false == fm25_log_is_valid_cfg( p_cfg )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        status = fm25_log_read_sb( p_log, p_cfg, &is_sb );
+
+        if (( eFM25_OK == status ) && ( false == is_sb ))
+        {
+            status = eFM25_ERROR_INIT;
+        }
+
+        if ( eFM25_OK == status )
+        {
+            status = fm25_log_roll( p_log );
+        }
+
+        p_log->is_mount = ( eFM25_OK == status );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Append record
+*
+* @note     Oldest records are dropped when ring is full, superblock is
+*           committed before their space is reused. Header and payload
+*           are written by single vectored write.
+*
+* @param[in]    p_log   - Pointer to log
+* @param[in]    p_data  - Pointer to record payload
+* @param[in]    size    - Size of record payload in bytes
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_append(fm25_log_t * const p_log, const uint8_t * const p_data, const uint32_t size)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_log ) || ( false == p_log->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (   ( NULL == p_data )
+            ||  ( 0U == size )
+            ||  ( size > ( p_log->ring_size - FM25_LOG_HDR_SIZE )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        const uint32_t  need        = ( FM25_LOG_HDR_SIZE + size );
+        bool            is_dropped  = false;
+        fm25_log_hdr_t  hdr         = { 0 };
+        fm25_iov_t      iov[4];
+        uint32_t        iov_num     = 0U;
+
+        // Make room
+        while   (   ( eFM25_OK == status )
+                &&  (( p_log->ring_size - fm25_log_used( p_log )) < need ))
+        {
+            bool is_valid = false;
+
+            status = fm25_log_read_hdr( p_log, p_log->sb.head, p_log->sb.head_seq, &hdr, &is_valid );
+
+            if ( false == is_valid )
+            {
+                status |= eFM25_ERROR;
+            }
+            else
+            {
+                p_log->sb.head = fm25_log_wrap( p_log, p_log->sb.head, ( FM25_LOG_HDR_SIZE + hdr.size ));
+                p_log->sb.head_seq++;
+                is_dropped = true;
+            }
+        }
+
+        if (( eFM25_OK == status ) && ( true == is_dropped ))
+        {
+            status = fm25_log_commit( p_log );
+        }
+
+        if ( eFM25_OK == status )
+        {
+            hdr.seq     = p_log->sb.tail_seq;
+            hdr.size    = size;
+            hdr.crc     = fm25_crc32( fm25_crc32( FM25_CRC32_INIT, (const uint8_t*) &hdr, ( 2U * sizeof( uint32_t ))), p_data, size );
+
+            // NOTE: Vectored write does not modify data
+            iov_num = fm25_log_iov( p_log, iov, p_log->sb.tail, (uint8_t*) &hdr, FM25_LOG_HDR_SIZE );
+            iov_num += fm25_log_iov( p_log, &iov[iov_num], fm25_log_wrap( p_log, p_log->sb.tail, FM25_LOG_HDR_SIZE ), (uint8_t*) p_data, size );
+
+            status = fm25_writev( p_log->cfg.dev, iov, iov_num );
+        }
+
+        if ( eFM25_OK == status )
+        {
+            p_log->sb.tail = fm25_log_wrap( p_log, p_log->sb.tail, need );
+            p_log->sb.tail_seq++;
+            p_log->pending++;
+
+            if ( p_log->pending >= p_log->cfg.commit_num )
+            {
+                status = fm25_log_commit( p_log );
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Drop oldest records
+*
+* @param[in]    p_log   - Pointer to log
+* @param[in]    rec_num - Number of records to drop
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_drop(fm25_log_t * const p_log, const uint32_t rec_num)
+{
+    fm25_status_t   status  = eFM25_OK;
+    fm25_log_hdr_t  hdr     = { 0 };
+
+    if (( NULL == p_log ) || ( false == p_log->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( rec_num > ( p_log->sb.tail_seq - p_log->sb.head_seq ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        for ( uint32_t i = 0U; ( i < rec_num ) && ( eFM25_OK == status ); i++ )
+        {
+            bool is_valid = false;
+
+            status = fm25_log_read_hdr( p_log, p_log->sb.head, p_log->sb.head_seq, &hdr, &is_valid );
+
+            if ( false == is_valid )
+            {
+                status |= eFM25_ERROR;
+            }
+            else
+            {
+                p_log->sb.head = fm25_log_wrap( p_log, p_log->sb.head, ( FM25_LOG_HDR_SIZE + hdr.size ));
+                p_log->sb.head_seq++;
+            }
+        }
+
+        if ( rec_num > 0U )
+        {
+            status |= fm25_log_commit( p_log );
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Commit pending appends
+*
+* @param[in]    p_log   - Pointer to log
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_sync(fm25_log_t * const p_log)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_log ) || ( false == p_log->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( p_log->pending > 0U )
+    {
+        status = fm25_log_commit( p_log );
+    }
+    else
+    {
+        // Nothing to commit
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get log usage
+*
+* @param[in]    p_log   - Pointer to log
+* @param[out]   p_info  - Pointer to usage
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_get_info(const fm25_log_t * const p_log, fm25_log_info_t * const p_info)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_log ) || ( false == p_log->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if ( NULL == p_info )
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        p_info->rec_num     = ( p_log->sb.tail_seq - p_log->sb.head_seq );
+        p_info->used        = fm25_log_used( p_log );
+        p_info->free        = ( p_log->ring_size - p_info->used );
+        p_info->recovered   = p_log->recovered;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Start iteration at oldest record
+*
+* @note     Only record header is read, payload is accessed by
+*           "fm25_log_iter_read()".
+*
+* @param[in]    p_log       - Pointer to log
+* @param[out]   p_it        - Pointer to iterator
+* @param[out]   p_is_rec    - False if log is empty
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_iter_first(fm25_log_t * const p_log, fm25_log_iter_t * const p_it, bool * const p_is_rec)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL == p_log ) || ( false == p_log->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_it ) || ( NULL == p_is_rec ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        p_it->off   = p_log->sb.head;
+        p_it->seq   = p_log->sb.head_seq;
+        p_it->size  = 0U;
+
+        status = fm25_log_iter_next( p_log, p_it, p_is_rec );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Advance iteration to next record
+*
+* @param[in]    p_log       - Pointer to log
+* @param[in]    p_it        - Pointer to iterator
+* @param[out]   p_is_rec    - False past newest record
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_iter_next(fm25_log_t * const p_log, fm25_log_iter_t * const p_it, bool * const p_is_rec)
+{
+    fm25_status_t   status      = eFM25_OK;
+    fm25_log_hdr_t  hdr         = { 0 };
+    bool            is_valid    = false;
+
+    if (( NULL == p_log ) || ( false == p_log->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_it ) || ( NULL == p_is_rec ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        // Skip current record, none right after first
+        if ( p_it->size > 0U )
+        {
+            p_it->off = fm25_log_wrap( p_log, p_it->off, ( FM25_LOG_HDR_SIZE + p_it->size ));
+            p_it->seq++;
+        }
+
+        *p_is_rec = ( p_it->seq != p_log->sb.tail_seq );
+
+        if ( true == *p_is_rec )
+        {
+            status = fm25_log_read_hdr( p_log, p_it->off, p_it->seq, &hdr, &is_valid );
+
+            if ( false == is_valid )
+            {
+                *p_is_rec = false;
+                status |= eFM25_ERROR;
+            }
+            else
+            {
+                p_it->size = hdr.size;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Read part of record payload
+*
+* @note     Payload can be read in pieces directly into destination,
+*           without staging whole record in RAM.
+*
+* @param[in]    p_log   - Pointer to log
+* @param[in]    p_it    - Pointer to iterator at record
+* @param[in]    offset  - Offset inside record payload
+* @param[in]    size    - Size of bytes to read
+* @param[out]   p_data  - Pointer to read data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_iter_read(fm25_log_t * const p_log, const fm25_log_iter_t * const p_it, const uint32_t offset, const uint32_t size, uint8_t * const p_data)
+{
+    fm25_status_t   status  = eFM25_OK;
+    fm25_iov_t      iov[2];
+
+    if (( NULL == p_log ) || ( false == p_log->is_mount ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (   ( NULL == p_it )
+            ||  ( NULL == p_data )
+            ||  ( 0U == size )
+            ||  ( offset >= p_it->size )
+            ||  ( size > ( p_it->size - offset )))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        const uint32_t off      = fm25_log_wrap( p_log, p_it->off, ( FM25_LOG_HDR_SIZE + offset ));
+        const uint32_t iov_num  = fm25_log_iov( p_log, iov, off, p_data, size );
+
+        status = fm25_readv( p_log->cfg.dev, iov, iov_num );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,130 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_log.h
+*@brief     Crash consistent ring log on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_LOG
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_LOG_H_
+#define FM25_LOG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of superblock and record header in bytes
+ */
+#define FM25_LOG_SB_SIZE                ( sizeof( fm25_log_sb_t ))
+#define FM25_LOG_HDR_SIZE               ( 12U )
+
+/**
+ *     Smallest log region in bytes
+ */
+#define FM25_LOG_SIZE_MIN               (( 2U * FM25_LOG_SB_SIZE ) + FM25_LOG_HDR_SIZE + 1U )
+
+/**
+ *     Log configuration
+ */
+typedef struct
+{
+    fm25_dev_t  dev;            /**<Device handle */
+    uint32_t    addr;           /**<Start address of log region */
+    uint32_t    size;           /**<Size of log region in bytes, superblocks included */
+    uint32_t    commit_num;     /**<Number of appends between superblock commits, bounds recovery at mount */
+} fm25_log_cfg_t;
+
+/**
+ *     Superblock
+ *
+ * @note    Two copies are kept and written alternately, newer valid
+ *          copy is used at mount. Treat as opaque!
+ */
+typedef struct
+{
+    uint32_t    magic;          /**<Superblock marker */
+    uint32_t    size;           /**<Size of log region */
+    uint32_t    gen;            /**<Generation, incremented by each commit */
+    uint32_t    head;           /**<Ring offset of oldest record */
+    uint32_t    tail;           /**<Ring offset of next record */
+    uint32_t    head_seq;       /**<Sequence number of oldest record */
+    uint32_t    tail_seq;       /**<Sequence number of next record */
+    uint32_t    crc;            /**<CRC-32 of preceding fields */
+} fm25_log_sb_t;
+
+/**
+ *     Log usage
+ */
+typedef struct
+{
+    uint32_t    rec_num;        /**<Number of records */
+    uint32_t    used;           /**<Bytes taken by records, headers included */
+    uint32_t    free;           /**<Bytes available for records, headers included */
+    uint32_t    recovered;      /**<Number of records recovered at mount */
+} fm25_log_info_t;
+
+/**
+ *     Record iterator
+ */
+typedef struct
+{
+    uint32_t    off;            /**<Ring offset of record */
+    uint32_t    seq;            /**<Sequence number of record */
+    uint32_t    size;           /**<Size of record payload in bytes */
+} fm25_log_iter_t;
+
+/**
+ *     Ring log
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_log_cfg_t  cfg;        /**<Configuration */
+    fm25_log_sb_t   sb;         /**<Current superblock */
+    uint32_t        ring_size;  /**<Size of record ring in bytes */
+    uint32_t        pending;    /**<Appends since last commit */
+    uint32_t        recovered;  /**<Records recovered at mount */
+    bool            is_mount;   /**<Mount guard */
+} fm25_log_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_log_format       (fm25_log_t * const p_log, const fm25_log_cfg_t * const p_cfg);
+fm25_status_t fm25_log_mount        (fm25_log_t * const p_log, const fm25_log_cfg_t * const p_cfg);
+fm25_status_t fm25_log_append       (fm25_log_t * const p_log, const uint8_t * const p_data, const uint32_t size);
+fm25_status_t fm25_log_drop         (fm25_log_t * const p_log, const uint32_t rec_num);
+fm25_status_t fm25_log_sync         (fm25_log_t * const p_log);
+fm25_status_t fm25_log_get_info     (const fm25_log_t * const p_log, fm25_log_info_t * const p_info);
+fm25_status_t fm25_log_iter_first   (fm25_log_t * const p_log, fm25_log_iter_t * const p_it, bool * const p_is_rec);
+fm25_status_t fm25_log_iter_next    (fm25_log_t * const p_log, fm25_log_iter_t * const p_it, bool * const p_is_rec);
+fm25_status_t fm25_log_iter_read    (fm25_log_t * const p_log, const fm25_log_iter_t * const p_it, const uint32_t offset, const uint32_t size, uint8_t * const p_data);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_LOG_H_
@@ -0,0 +1,237 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_par.c
+*@brief     Parameter table on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_PAR
+* @{ <!-- BEGIN GROUP -->
+*
+*     Fixed set of parameters declared once by "FM25_PAR_LIST" inside
+*     "fm25_par_cfg.h". Offsets, layout signature and typed accessors are
+*     generated at compile time, thus single parameter access costs one
+*     read or write of parameter size and no lookup.
+*
+*     Table is preceded by layout signature. Signature mismatch at init
+*     resets table to defaults.
+*
+*     Module is compiled only with "FM25_CFG_PAR_EN" set to 1, thus
+*     "fm25_par_cfg.h" is not needed otherwise.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_par.h"
+#include "../../fm25_cfg.h"
+
+#if ( 1 == FM25_CFG_PAR_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // Definitions
+    ////////////////////////////////////////////////////////////////////////////////
+
+    /**
+     *     Table code generators
+     */
+    #define FM25_PAR_DEFAULT(name, type, def, min, max)     .name = ( def ),
+    #define FM25_PAR_PACK(name, type, def, min, max)        memcpy( image.name, &p_par->name, sizeof( type ));
+    #define FM25_PAR_UNPACK(name, type, def, min, max)      memcpy( &p_par->name, image.name, sizeof( type ));
+    #define FM25_PAR_CHECK(name, type, def, min, max)       && FM25_PAR_IN_RANGE( p_par->name, (type)( min ), (type)( max ))
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // Variables
+    ////////////////////////////////////////////////////////////////////////////////
+
+    /**
+     *     Default parameter values
+     */
+    static const fm25_par_t g_fm25_par_default =
+    {
+        FM25_PAR_LIST( FM25_PAR_DEFAULT )
+    };
+
+#endif // ( 1 == FM25_CFG_PAR_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_PAR
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 parameter table API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 == FM25_CFG_PAR_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Initialize parameter table
+    *
+    * @note     Table with layout signature other than current one is reset
+    *           to defaults.
+    *
+    * @param[in]    dev             - Device handle
+    * @param[out]   p_is_default    - True if table was reset to defaults, optional
+    * @return       status          - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_par_init(fm25_dev_t dev, bool * const p_is_default)
+    {
+        fm25_status_t   status      = eFM25_OK;
+        uint32_t        mem_size    = 0U;
+        uint32_t        sig         = 0U;
+        bool            is_default  = false;
+
+        status = fm25_get_size( dev, &mem_size );
+
+        if  (   ( eFM25_OK == status )
+            &&  (   ( FM25_PAR_CFG_ADDR >= mem_size )
+                ||  ( FM25_PAR_SIZE > ( mem_size - FM25_PAR_CFG_ADDR ))))
+        {
+            status = eFM25_ERROR;
+        }
+
+        if ( eFM25_OK == status )
+        {
+            status = fm25_read( dev, FM25_PAR_CFG_ADDR, FM25_PAR_SIG_SIZE, (uint8_t*) &sig );
+        }
+
+        if  (   ( eFM25_OK == status )
+            &&  ( FM25_PAR_SIG != sig ))
+        {
+            status      = fm25_par_default( dev );
+            is_default  = true;
+        }
+
+        if ( NULL != p_is_default )
+        {
+            *p_is_default = is_default;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Reset parameter table to defaults
+    *
+    * @note     Signature is written after parameters, thus interrupted reset
+    *           is repeated at next init.
+    *
+    * @param[in]    dev     - Device handle
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_par_default(fm25_dev_t dev)
+    {
+        fm25_status_t   status  = eFM25_OK;
+        const uint32_t  sig     = FM25_PAR_SIG;
+
+        status = fm25_par_store( dev, &g_fm25_par_default );
+
+        if ( eFM25_OK == status )
+        {
+            status = fm25_write( dev, FM25_PAR_CFG_ADDR, FM25_PAR_SIG_SIZE, (const uint8_t*) &sig );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Load whole parameter table
+    *
+    * @note     Table is read by single read command into packed image on
+    *           stack and unpacked into parameter structure.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[out]   p_par   - Pointer to parameter values
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_par_load(fm25_dev_t dev, fm25_par_t * const p_par)
+    {
+        fm25_status_t       status  = eFM25_OK;
+        fm25_par_image_t    image;
+
+        FM25_ASSERT( NULL != p_par );
+
+        if ( NULL == p_par )
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            status = fm25_read( dev, ( FM25_PAR_CFG_ADDR + FM25_PAR_SIG_SIZE ), sizeof( fm25_par_image_t ), (uint8_t*) &image );
+
+            if ( eFM25_OK == status )
+            {
+                FM25_PAR_LIST( FM25_PAR_UNPACK )
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Store whole parameter table
+    *
+    * @note     All values are range checked first, table is then written by
+    *           single write command.
+    *
+    * @param[in]    dev     - Device handle
+    * @param[in]    p_par   - Pointer to parameter values
+    * @return       status  - Status of operation, "eFM25_ERROR" if any value is out of range
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_par_store(fm25_dev_t dev, const fm25_par_t * const p_par)
+    {
+        fm25_status_t       status  = eFM25_OK;
+        fm25_par_image_t    image;
+
+        FM25_ASSERT( NULL != p_par );
+
+        if  (   ( NULL == p_par )
+            ||  ( false == ( true FM25_PAR_LIST( FM25_PAR_CHECK ))))
+        {
+            status = eFM25_ERROR;
+        }
+        else
+        {
+            FM25_PAR_LIST( FM25_PAR_PACK )
+
+            status = fm25_write( dev, ( FM25_PAR_CFG_ADDR + FM25_PAR_SIG_SIZE ), sizeof( fm25_par_image_t ), (const uint8_t*) &image );
+        }
+
+        return status;
+    }
+
+#endif // ( 1 == FM25_CFG_PAR_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
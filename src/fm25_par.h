@@ -0,0 +1,149 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_par.h
+*@brief     Parameter table on FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_PAR
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_PAR_H_
+#define FM25_PAR_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "fm25.h"
+#include "../../fm25_cfg.h"
+
+#if ( 1 == FM25_CFG_PAR_EN )
+    #include "../../fm25_par_cfg.h"
+#endif
+
+#if ( 1 == FM25_CFG_PAR_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // Definitions
+    ////////////////////////////////////////////////////////////////////////////////
+
+    /**
+     *     Parameter values
+     */
+    #define FM25_PAR_MEMBER(name, type, def, min, max)          type name;
+
+    typedef struct
+    {
+        FM25_PAR_LIST( FM25_PAR_MEMBER )
+    } fm25_par_t;
+
+    /**
+     *     Packed image of parameter table
+     *
+     * @note    Members are byte arrays, thus image has no padding and
+     *          member offsets are device offsets of parameters.
+     */
+    #define FM25_PAR_IMAGE_MEMBER(name, type, def, min, max)    uint8_t name[sizeof( type )];
+
+    typedef struct
+    {
+        FM25_PAR_LIST( FM25_PAR_IMAGE_MEMBER )
+    } fm25_par_image_t;
+
+    /**
+     *     Table layout on device: [signature][packed parameters]
+     */
+    #define FM25_PAR_SIG_SIZE               ( sizeof( uint32_t ))
+    #define FM25_PAR_SIZE                   ( FM25_PAR_SIG_SIZE + sizeof( fm25_par_image_t ))
+
+    /**
+     *     Device address of parameter
+     */
+    #define FM25_PAR_ADDR(name)             ((uint32_t)( FM25_PAR_CFG_ADDR + FM25_PAR_SIG_SIZE + offsetof( fm25_par_image_t, name )))
+
+    /**
+     *     Kind of parameter type: 0 - unsigned, 1 - signed, 2 - floating point
+     */
+    #define FM25_PAR_KIND(type)             (( 0 != (type) 0.5 ) ? 2U : ((( type ) -1 < ( type ) 1 ) ? 1U : 0U ))
+
+    /**
+     *     Layout signature
+     *
+     * @note    Constant expression of table version, offset, size and kind
+     *          of each parameter. Evaluated at compile time. "FM25_PAR_SIG_OF()"
+     *          gives signature of any packed image built by X-macro list.
+     */
+    #define FM25_PAR_SIG_TERM(image, name, type)                \
+        + ((uint32_t)(( offsetof( image, name ) + 1U ) * 0x9E3779B1UL ) * (uint32_t)( sizeof( type ) + ( 16U * FM25_PAR_KIND( type ))))
+
+    #define FM25_PAR_SIG_OF(ver, image, terms)  ((uint32_t)((uint32_t)(( ver ) * 0x01000193UL ) + (uint32_t) sizeof( image ) terms ))
+
+    #define FM25_PAR_SIG_ITEM(name, type, def, min, max)        FM25_PAR_SIG_TERM( fm25_par_image_t, name, type )
+
+    #define FM25_PAR_SIG                    FM25_PAR_SIG_OF( FM25_PAR_CFG_VER, fm25_par_image_t, FM25_PAR_LIST( FM25_PAR_SIG_ITEM ))
+
+    /**
+     *     Range check
+     *
+     * @note    Written without "<=" and ">=" in order to avoid always true
+     *          comparison of unsigned parameter with zero.
+     */
+    #define FM25_PAR_IN_RANGE(val, min, max)    \
+        (((( min ) < ( val )) || (( min ) == ( val ))) && ((( val ) < ( max )) || (( val ) == ( max ))))
+
+    /**
+     *     Typed accessors
+     *
+     * @note    Each accessor is single read or write of parameter size.
+     *          Setter rejects value out of range with "eFM25_ERROR".
+     */
+    #define FM25_PAR_ACCESSORS(name, type, def, min, max)                                       \
+        static inline fm25_status_t fm25_par_get_##name(fm25_dev_t dev, type * const p_val)     \
+        {                                                                                       \
+            return fm25_read( dev, FM25_PAR_ADDR( name ), sizeof( type ), (uint8_t*) p_val );   \
+        }                                                                                       \
+                                                                                                \
+        static inline fm25_status_t fm25_par_set_##name(fm25_dev_t dev, const type val)         \
+        {                                                                                       \
+            fm25_status_t status = eFM25_ERROR;                                                 \
+                                                                                                \
+            if ( FM25_PAR_IN_RANGE( val, (type)( min ), (type)( max )))                         \
+            {                                                                                   \
+                status = fm25_write( dev, FM25_PAR_ADDR( name ), sizeof( type ), (const uint8_t*) &val ); \
+            }                                                                                   \
+                                                                                                \
+            return status;                                                                      \
+        }
+
+    FM25_PAR_LIST( FM25_PAR_ACCESSORS )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // Functions Prototypes
+    ////////////////////////////////////////////////////////////////////////////////
+    fm25_status_t fm25_par_init     (fm25_dev_t dev, bool * const p_is_default);
+    fm25_status_t fm25_par_default  (fm25_dev_t dev);
+    fm25_status_t fm25_par_load     (fm25_dev_t dev, fm25_par_t * const p_par);
+    fm25_status_t fm25_par_store    (fm25_dev_t dev, const fm25_par_t * const p_par);
+
+#endif // ( 1 == FM25_CFG_PAR_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_PAR_H_
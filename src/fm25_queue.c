@@ -0,0 +1,686 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_queue.c
+*@brief     I/O request queue for FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_QUEUE
+* @{ <!-- BEGIN GROUP -->
+*
+*     Request queue in front of FM25 API.
+*
+*     Requests are served in priority order. Request waiting longer than
+*     latency budget of its priority is served first regardless of
+*     priority. Queued requests of same direction that are contiguous or
+*     overlapping with served request are merged into single device
+*     transaction, thus saving write enable, command and address framing
+*     of each merged request.
+*
+*     Requests touching same memory with at least one write among them
+*     are never reordered, overlapping writes are applied in submission
+*     order.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_queue.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Request "a" was submitted before request "b"
+ *
+ * @note    Wrap-around safe comparison of sequence numbers.
+ */
+#define FM25_QUEUE_IS_OLDER(a,b)        ((int32_t)((uint32_t)((a)->seq - (b)->seq)) < 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t        fm25_queue_submit       (fm25_queue_t * const p_queue, fm25_queue_req_t * const p_req);
+static bool                 fm25_queue_is_overlap   (const fm25_queue_req_t * const p_a, const uint32_t lo, const uint32_t hi);
+static bool                 fm25_queue_is_conflict  (const fm25_queue_t * const p_queue, const fm25_queue_req_t * const p_req);
+static fm25_queue_req_t *   fm25_queue_select       (fm25_queue_t * const p_queue, const uint32_t now);
+static uint32_t             fm25_queue_merge        (fm25_queue_t * const p_queue, const fm25_queue_req_t * const p_first, uint32_t * const p_lo, uint32_t * const p_hi);
+static fm25_status_t        fm25_queue_execute      (fm25_queue_t * const p_queue, fm25_queue_req_t * const p_first, const uint32_t num, const uint32_t lo, const uint32_t hi);
+static void                 fm25_queue_complete     (fm25_queue_t * const p_queue, const fm25_status_t status, const uint32_t now);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Append request to queue of its priority
+*
+* @param[in]    p_queue - Pointer to queue
+* @param[in]    p_req   - Pointer to prepared request
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_queue_submit(fm25_queue_t * const p_queue, fm25_queue_req_t * const p_req)
+{
+    const uint32_t tick = ( NULL != p_queue->cfg.pf_get_tick ) ? p_queue->cfg.pf_get_tick() : 0U;
+
+    p_req->p_next   = NULL;
+    p_req->tick     = tick;
+    p_req->in_batch = false;
+
+    FM25_ENTER_CRITICAL();
+
+    p_req->seq = p_queue->seq++;
+
+    if ( NULL == p_queue->p_head[p_req->prio] )
+    {
+        p_queue->p_head[p_req->prio] = p_req;
+    }
+    else
+    {
+        p_queue->p_tail[p_req->prio]->p_next = p_req;
+    }
+
+    p_queue->p_tail[p_req->prio] = p_req;
+
+    p_queue->stats.req++;
+    p_queue->stats.depth++;
+
+    if ( p_queue->stats.depth > p_queue->stats.depth_max )
+    {
+        p_queue->stats.depth_max = p_queue->stats.depth;
+    }
+
+    // NOTE: Wake-up takes bus lock, thus it is left to driver task
+    p_queue->is_wake = true;
+
+    FM25_EXIT_CRITICAL();
+
+    return eFM25_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check if request overlaps memory range
+*
+* @param[in]    p_a         - Pointer to request
+* @param[in]    lo          - Start of range
+* @param[in]    hi          - End of range (exclusive)
+* @return       is_overlap  - True if ranges share at least one byte
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_queue_is_overlap(const fm25_queue_req_t * const p_a, const uint32_t lo, const uint32_t hi)
+{
+    return (( p_a->addr < hi ) && (( p_a->addr + p_a->size ) > lo ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Check if request must wait for older request
+*
+* @note     Older request outside of current transaction touching same
+*           memory, where at least one of them is write, must be
+*           served first.
+*
+* @param[in]    p_queue     - Pointer to queue
+* @param[in]    p_req       - Pointer to request
+* @return       is_conflict - True if request can not be served now
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fm25_queue_is_conflict(const fm25_queue_t * const p_queue, const fm25_queue_req_t * const p_req)
+{
+    bool is_conflict = false;
+
+    for ( uint32_t prio = 0U; ( prio < FM25_QUEUE_PRIO_NUM ) && ( false == is_conflict ); prio++ )
+    {
+        for ( const fm25_queue_req_t * p_old = p_queue->p_head[prio]; NULL != p_old; p_old = p_old->p_next )
+        {
+            if  (   ( false == p_old->in_batch )
+                &&  ( FM25_QUEUE_IS_OLDER( p_old, p_req ))
+                &&  (( NULL != p_old->p_tx ) || ( NULL != p_req->p_tx ))
+                &&  ( true == fm25_queue_is_overlap( p_old, p_req->addr, p_req->addr + p_req->size )))
+            {
+                is_conflict = true;
+                break;
+            }
+        }
+    }
+
+    return is_conflict;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Select request to serve
+*
+* @note     Oldest request that exceeded latency budget by most ticks wins,
+*           otherwise oldest request of highest priority. Selected request
+*           is replaced by older conflicting request if there is any.
+*
+* @param[in]    p_queue - Pointer to queue
+* @param[in]    now     - Current timestamp
+* @return       p_req   - Request to serve, NULL if queue is empty
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_queue_req_t * fm25_queue_select(fm25_queue_t * const p_queue, const uint32_t now)
+{
+    fm25_queue_req_t *  p_sel   = NULL;
+    uint32_t            overrun = 0U;
+
+    // Requests over latency budget
+    if ( NULL != p_queue->cfg.pf_get_tick )
+    {
+        for ( uint32_t prio = 0U; prio < FM25_QUEUE_PRIO_NUM; prio++ )
+        {
+            fm25_queue_req_t * const p_req = p_queue->p_head[prio];
+
+            if  (   ( NULL != p_req )
+                &&  ( 0U != p_queue->cfg.budget[prio] )
+                &&  (( now - p_req->tick ) >= p_queue->cfg.budget[prio] ))
+            {
+                const uint32_t req_overrun = (( now - p_req->tick ) - p_queue->cfg.budget[prio] );
+
+                if (( NULL == p_sel ) || ( req_overrun > overrun ))
+                {
+                    p_sel   = p_req;
+                    overrun = req_overrun;
+                }
+            }
+        }
+    }
+
+    // Highest priority
+    for ( uint32_t prio = 0U; ( prio < FM25_QUEUE_PRIO_NUM ) && ( NULL == p_sel ); prio++ )
+    {
+        p_sel = p_queue->p_head[prio];
+    }
+
+    // Keep order of requests touching same memory
+    while (( NULL != p_sel ) && ( true == fm25_queue_is_conflict( p_queue, p_sel )))
+    {
+        fm25_queue_req_t * p_old = NULL;
+
+        for ( uint32_t prio = 0U; prio < FM25_QUEUE_PRIO_NUM; prio++ )
+        {
+            for ( fm25_queue_req_t * p_req = p_queue->p_head[prio]; NULL != p_req; p_req = p_req->p_next )
+            {
+                if  (   ( FM25_QUEUE_IS_OLDER( p_req, p_sel ))
+                    &&  (( NULL != p_req->p_tx ) || ( NULL != p_sel->p_tx ))
+                    &&  ( true == fm25_queue_is_overlap( p_req, p_sel->addr, p_sel->addr + p_sel->size ))
+                    &&  (( NULL == p_old ) || ( FM25_QUEUE_IS_OLDER( p_req, p_old ))))
+                {
+                    p_old = p_req;
+                }
+            }
+        }
+
+        p_sel = p_old;
+    }
+
+    return p_sel;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Merge neighbouring requests into transaction
+*
+* @note     Requests of same direction that touch or overlap memory range of
+*           transaction are merged as long as merged range fits into merge
+*           buffer.
+*
+* @param[in]    p_queue - Pointer to queue
+* @param[in]    p_first - First request of transaction
+* @param[out]   p_lo    - Start of transaction range
+* @param[out]   p_hi    - End of transaction range (exclusive)
+* @return       num     - Number of requests in transaction
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t fm25_queue_merge(fm25_queue_t * const p_queue, const fm25_queue_req_t * const p_first, uint32_t * const p_lo, uint32_t * const p_hi)
+{
+    uint32_t    num         = 1U;
+    bool        is_merged   = true;
+
+    *p_lo = p_first->addr;
+    *p_hi = p_first->addr + p_first->size;
+
+    while (( NULL != p_queue->cfg.p_buf ) && ( true == is_merged ))
+    {
+        is_merged = false;
+
+        for ( uint32_t prio = 0U; prio < FM25_QUEUE_PRIO_NUM; prio++ )
+        {
+            for ( fm25_queue_req_t * p_req = p_queue->p_head[prio]; NULL != p_req; p_req = p_req->p_next )
+            {
+                const uint32_t lo = ( p_req->addr < *p_lo ) ? p_req->addr : *p_lo;
+                const uint32_t hi = (( p_req->addr + p_req->size ) > *p_hi ) ? ( p_req->addr + p_req->size ) : *p_hi;
+
+                if  (   ( false == p_req->in_batch )
+                    &&  (( NULL == p_req->p_tx ) == ( NULL == p_first->p_tx ))
+                    &&  ( p_req->addr <= *p_hi )
+                    &&  (( p_req->addr + p_req->size ) >= *p_lo )
+                    &&  (( hi - lo ) <= p_queue->cfg.buf_size )
+                    &&  ( false == fm25_queue_is_conflict( p_queue, p_req )))
+                {
+                    p_req->in_batch = true;
+                    *p_lo           = lo;
+                    *p_hi           = hi;
+                    is_merged       = true;
+                    num++;
+                }
+            }
+        }
+    }
+
+    return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Execute transaction
+*
+* @note     Single request transaction is transferred directly from/to
+*           request buffer. Merged writes are assembled in merge buffer in
+*           submission order, merged reads are scattered from it.
+*
+* @param[in]    p_queue - Pointer to queue
+* @param[in]    p_first - First request of transaction
+* @param[in]    num     - Number of requests in transaction
+* @param[in]    lo      - Start of transaction range
+* @param[in]    hi      - End of transaction range (exclusive)
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_queue_execute(fm25_queue_t * const p_queue, fm25_queue_req_t * const p_first, const uint32_t num, const uint32_t lo, const uint32_t hi)
+{
+    fm25_status_t   status  = eFM25_OK;
+    uint8_t * const p_buf   = p_queue->cfg.p_buf;
+
+    if ( 1U == num )
+    {
+        if ( NULL != p_first->p_tx )
+        {
+            status = fm25_write( p_queue->cfg.dev, p_first->addr, p_first->size, p_first->p_tx );
+        }
+        else
+        {
+            status = fm25_read( p_queue->cfg.dev, p_first->addr, p_first->size, p_first->p_rx );
+        }
+    }
+    else if ( NULL != p_first->p_tx )
+    {
+        const fm25_queue_req_t * p_prev = NULL;
+
+        // Apply writes in submission order
+        for ( uint32_t n = 0U; n < num; n++ )
+        {
+            const fm25_queue_req_t * p_next = NULL;
+
+            for ( uint32_t prio = 0U; prio < FM25_QUEUE_PRIO_NUM; prio++ )
+            {
+                for ( const fm25_queue_req_t * p_req = p_queue->p_head[prio]; NULL != p_req; p_req = p_req->p_next )
+                {
+                    if  (   ( true == p_req->in_batch )
+                        &&  (( NULL == p_prev ) || ( FM25_QUEUE_IS_OLDER( p_prev, p_req )))
+                        &&  (( NULL == p_next ) || ( FM25_QUEUE_IS_OLDER( p_req, p_next ))))
+                    {
+                        p_next = p_req;
+                    }
+                }
+            }
+
+            memcpy( &p_buf[ p_next->addr - lo ], p_next->p_tx, p_next->size );
+            p_prev = p_next;
+        }
+
+        status = fm25_write( p_queue->cfg.dev, lo, ( hi - lo ), p_buf );
+    }
+    else
+    {
+        status = fm25_read( p_queue->cfg.dev, lo, ( hi - lo ), p_buf );
+
+        for ( uint32_t prio = 0U; ( prio < FM25_QUEUE_PRIO_NUM ) && ( eFM25_OK == status ); prio++ )
+        {
+            for ( fm25_queue_req_t * p_req = p_queue->p_head[prio]; NULL != p_req; p_req = p_req->p_next )
+            {
+                if ( true == p_req->in_batch )
+                {
+                    memcpy( p_req->p_rx, &p_buf[ p_req->addr - lo ], p_req->size );
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Remove requests of transaction and report completion
+*
+* @param[in]    p_queue - Pointer to queue
+* @param[in]    status  - Status of transaction
+* @param[in]    now     - Timestamp of transaction
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fm25_queue_complete(fm25_queue_t * const p_queue, const fm25_status_t status, const uint32_t now)
+{
+    for ( uint32_t prio = 0U; prio < FM25_QUEUE_PRIO_NUM; prio++ )
+    {
+        fm25_queue_req_t * p_prev   = NULL;
+        fm25_queue_req_t * p_req    = p_queue->p_head[prio];
+
+        while ( NULL != p_req )
+        {
+            fm25_queue_req_t * const p_next = p_req->p_next;
+
+            if ( true == p_req->in_batch )
+            {
+                FM25_ENTER_CRITICAL();
+
+                if ( NULL == p_prev )
+                {
+                    p_queue->p_head[prio] = p_req->p_next;
+                }
+                else
+                {
+                    p_prev->p_next = p_req->p_next;
+                }
+
+                if ( p_queue->p_tail[prio] == p_req )
+                {
+                    p_queue->p_tail[prio] = p_prev;
+                }
+
+                p_queue->stats.depth--;
+
+                FM25_EXIT_CRITICAL();
+
+                if  (   ( NULL != p_queue->cfg.pf_get_tick )
+                    &&  ( 0U != p_queue->cfg.budget[prio] )
+                    &&  (( now - p_req->tick ) > p_queue->cfg.budget[prio] ))
+                {
+                    p_queue->stats.late++;
+                }
+
+                if ( eFM25_OK != status )
+                {
+                    p_queue->stats.err++;
+                }
+
+                p_req->in_batch = false;
+
+                if ( NULL != p_req->pf_cb )
+                {
+                    p_req->pf_cb( p_req, status, p_req->p_arg );
+                }
+            }
+            else
+            {
+                p_prev = p_req;
+            }
+
+            p_req = p_next;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_QUEUE
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 request queue API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Initialize request queue
+*
+* @param[out]   p_queue - Pointer to queue
+* @param[in]    p_cfg   - Pointer to queue configuration
+* @return       status  - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_queue_init(fm25_queue_t * const p_queue, const fm25_queue_cfg_t * const p_cfg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    FM25_ASSERT( NULL != p_queue );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if (( NULL != p_queue ) && ( NULL != p_cfg ) && ( NULL != p_cfg->dev ))
+    {
+        memset( p_queue, 0, sizeof( fm25_queue_t ));
+
+        p_queue->cfg        = *p_cfg;
+        p_queue->is_init    = true;
+    }
+    else
+    {
+        status = eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Queue write request
+*
+* @param[in]    p_queue - Pointer to queue
+* @param[in]    p_req   - Request storage, valid until completion
+* @param[in]    prio    - Priority, 0 is the most urgent
+* @param[in]    addr    - Start address of write
+* @param[in]    size    - Size of bytes to write
+* @param[in]    p_data  - Pointer to write data, valid until completion
+* @param[in]    pf_cb   - Completion callback, can be NULL
+* @param[in]    p_arg   - Callback argument
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_queue_write(fm25_queue_t * const p_queue, fm25_queue_req_t * const p_req, const uint8_t prio, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_fm25_queue_cb_t pf_cb, void * const p_arg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if  (   ( NULL == p_queue )
+        ||  ( false == p_queue->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_req ) || ( NULL == p_data ) || ( 0U == size ) || ( prio >= FM25_QUEUE_PRIO_NUM ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        p_req->p_tx     = p_data;
+        p_req->p_rx     = NULL;
+        p_req->addr     = addr;
+        p_req->size     = size;
+        p_req->prio     = prio;
+        p_req->pf_cb    = pf_cb;
+        p_req->p_arg    = p_arg;
+
+        status = fm25_queue_submit( p_queue, p_req );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Queue read request
+*
+* @param[in]    p_queue - Pointer to queue
+* @param[in]    p_req   - Request storage, valid until completion
+* @param[in]    prio    - Priority, 0 is the most urgent
+* @param[in]    addr    - Start address of read
+* @param[in]    size    - Size of bytes to read
+* @param[out]   p_data  - Pointer to read data, valid until completion
+* @param[in]    pf_cb   - Completion callback, can be NULL
+* @param[in]    p_arg   - Callback argument
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_queue_read(fm25_queue_t * const p_queue, fm25_queue_req_t * const p_req, const uint8_t prio, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_fm25_queue_cb_t pf_cb, void * const p_arg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if  (   ( NULL == p_queue )
+        ||  ( false == p_queue->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_req ) || ( NULL == p_data ) || ( 0U == size ) || ( prio >= FM25_QUEUE_PRIO_NUM ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        p_req->p_tx     = NULL;
+        p_req->p_rx     = p_data;
+        p_req->addr     = addr;
+        p_req->size     = size;
+        p_req->prio     = prio;
+        p_req->pf_cb    = pf_cb;
+        p_req->p_arg    = p_arg;
+
+        status = fm25_queue_submit( p_queue, p_req );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Process queued requests
+*
+* @note     Serves all pending requests, one transaction at a time.
+*           Requests submitted meanwhile are scheduled by their priority
+*           before next transaction. Shall be called from single driver
+*           task.
+*
+*           Wake-up of sleeping device is started first so that recovery
+*           time overlaps request selection and merging.
+*
+* @param[in]    p_queue - Pointer to queue
+* @return       status  - Status of operation, errors of all transactions combined
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_queue_process(fm25_queue_t * const p_queue)
+{
+    fm25_status_t       status  = eFM25_OK;
+    fm25_queue_req_t *  p_first = NULL;
+
+    if  (   ( NULL == p_queue )
+        ||  ( false == p_queue->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        #if ( 1 == FM25_CFG_SLEEP_EN )
+            bool is_wake = false;
+
+            FM25_ENTER_CRITICAL();
+
+            is_wake             = p_queue->is_wake;
+            p_queue->is_wake    = false;
+
+            FM25_EXIT_CRITICAL();
+
+            // NOTE: Failed wake-up is reported by first transaction
+            if ( true == is_wake )
+            {
+                (void) fm25_wake( p_queue->cfg.dev );
+            }
+        #endif
+
+        for (;;)
+        {
+            const uint32_t now = ( NULL != p_queue->cfg.pf_get_tick ) ? p_queue->cfg.pf_get_tick() : 0U;
+
+            p_first = fm25_queue_select( p_queue, now );
+
+            if ( NULL == p_first )
+            {
+                break;
+            }
+
+            uint32_t lo = 0U;
+            uint32_t hi = 0U;
+
+            p_first->in_batch = true;
+
+            const uint32_t num = fm25_queue_merge( p_queue, p_first, &lo, &hi );
+            const fm25_status_t trans_status = fm25_queue_execute( p_queue, p_first, num, lo, hi );
+
+            p_queue->stats.trans++;
+            p_queue->stats.merged += ( num - 1U );
+
+            fm25_queue_complete( p_queue, trans_status, now );
+
+            status |= trans_status;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get queue statistics
+*
+* @note     Merge rate is "merged / req", device transactions saved by
+*           merging equal "merged".
+*
+* @param[in]    p_queue - Pointer to queue
+* @param[out]   p_stats - Pointer to statistics
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_queue_get_stats(const fm25_queue_t * const p_queue, fm25_queue_stats_t * const p_stats)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL != p_queue ) && ( NULL != p_stats ))
+    {
+        *p_stats = p_queue->stats;
+    }
+    else
+    {
+        status = eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,130 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_queue.h
+*@brief     I/O request queue for FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_QUEUE
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_QUEUE_H_
+#define FM25_QUEUE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of request priorities
+ *
+ * @note    Priority 0 is the most urgent one.
+ */
+#define FM25_QUEUE_PRIO_NUM             ( 4U )
+
+/**
+ *     Queued request
+ */
+typedef struct fm25_queue_req_s fm25_queue_req_t;
+
+/**
+ *     Request completion callback
+ */
+typedef void (*pf_fm25_queue_cb_t)(fm25_queue_req_t * const p_req, const fm25_status_t status, void * const p_arg);
+
+/**
+ *     Queued request
+ *
+ * @note    Storage is provided by caller and must stay valid until
+ *          completion callback is called. Treat as opaque!
+ */
+struct fm25_queue_req_s
+{
+    fm25_queue_req_t *      p_next;     /**<Next request of same priority */
+    const uint8_t *         p_tx;       /**<Write data */
+    uint8_t *               p_rx;       /**<Read data */
+    uint32_t                addr;       /**<Start address */
+    uint32_t                size;       /**<Size of payload */
+    uint32_t                seq;        /**<Submission sequence number */
+    uint32_t                tick;       /**<Submission timestamp */
+    pf_fm25_queue_cb_t      pf_cb;      /**<Completion callback */
+    void *                  p_arg;      /**<Callback argument */
+    uint8_t                 prio;       /**<Priority */
+    bool                    in_batch;   /**<Request is part of current transaction */
+};
+
+/**
+ *     Queue configuration
+ */
+typedef struct
+{
+    fm25_dev_t      dev;                            /**<Device handle */
+    uint8_t *       p_buf;                          /**<Merge buffer, NULL disables merging */
+    uint32_t        buf_size;                       /**<Size of merge buffer */
+    uint32_t        budget[FM25_QUEUE_PRIO_NUM];    /**<Latency budget per priority in ticks, 0 for no budget */
+    uint32_t        (*pf_get_tick)(void);           /**<Timestamp source, NULL disables latency budgets */
+} fm25_queue_cfg_t;
+
+/**
+ *     Queue statistics
+ */
+typedef struct
+{
+    uint32_t    req;            /**<Number of submitted requests */
+    uint32_t    trans;          /**<Number of device transactions */
+    uint32_t    merged;         /**<Number of requests merged into other transaction */
+    uint32_t    late;           /**<Number of requests served after latency budget */
+    uint32_t    err;            /**<Number of failed requests */
+    uint32_t    depth;          /**<Current queue depth */
+    uint32_t    depth_max;      /**<Maximum queue depth */
+} fm25_queue_stats_t;
+
+/**
+ *     Request queue
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_queue_cfg_t    cfg;                                /**<Configuration */
+    fm25_queue_stats_t  stats;                              /**<Statistics */
+    fm25_queue_req_t *  p_head[FM25_QUEUE_PRIO_NUM];        /**<Oldest request per priority */
+    fm25_queue_req_t *  p_tail[FM25_QUEUE_PRIO_NUM];        /**<Newest request per priority */
+    uint32_t            seq;                                /**<Sequence number of next request */
+    bool                is_wake;                            /**<Device wake-up pending, issued by driver task */
+    bool                is_init;                            /**<Initialization guard */
+} fm25_queue_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_queue_init       (fm25_queue_t * const p_queue, const fm25_queue_cfg_t * const p_cfg);
+fm25_status_t fm25_queue_write      (fm25_queue_t * const p_queue, fm25_queue_req_t * const p_req, const uint8_t prio, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_fm25_queue_cb_t pf_cb, void * const p_arg);
+fm25_status_t fm25_queue_read       (fm25_queue_t * const p_queue, fm25_queue_req_t * const p_req, const uint8_t prio, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_fm25_queue_cb_t pf_cb, void * const p_arg);
+fm25_status_t fm25_queue_process    (fm25_queue_t * const p_queue);
+fm25_status_t fm25_queue_get_stats  (const fm25_queue_t * const p_queue, fm25_queue_stats_t * const p_stats);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_QUEUE_H_
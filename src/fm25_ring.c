@@ -0,0 +1,372 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_ring.c
+*@brief     Lock-free submission ring for FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_RING
+* @{ <!-- BEGIN GROUP -->
+*
+*     Bounded multi-producer, single-consumer ring in front of FM25 API.
+*
+*     Tasks and interrupts post requests without blocking and without
+*     critical section. Position is claimed by compare-and-swap of head,
+*     request is then handed over to consumer by release store of slot
+*     sequence. Single driver task drains ring and executes requests by
+*     synchronous API, thus under interface lock.
+*
+*     Slot sequence of position "pos" equals:
+*       - pos                   - slot free for producer of "pos"
+*       - pos + 1               - request posted, ready for consumer
+*       - pos + slot_num        - slot served, free for next lap
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fm25_ring.h"
+#include "../../fm25_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_ring_post(fm25_ring_t * const p_ring, fm25_ring_req_t * const p_req);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Post request to ring
+*
+* @note     Lock-free, callable from any task or interrupt. Contended
+*           producer retries compare-and-swap only when other producer
+*           claimed the same position meanwhile.
+*
+* @param[in]    p_ring  - Pointer to ring
+* @param[in]    p_req   - Pointer to prepared request
+* @return       status  - Status of operation, "eFM25_ERROR_BUSY" on full ring
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fm25_status_t fm25_ring_post(fm25_ring_t * const p_ring, fm25_ring_req_t * const p_req)
+{
+    fm25_status_t       status  = eFM25_OK;
+    fm25_ring_slot_t *  p_slot  = NULL;
+    uint32_t            pos     = FM25_ATOMIC_LOAD( &p_ring->head );
+
+    p_req->tick = ( NULL != p_ring->cfg.pf_get_tick ) ? p_ring->cfg.pf_get_tick() : 0U;
+
+    for (;;)
+    {
+        p_slot = &p_ring->cfg.p_slot[ pos & ( p_ring->cfg.slot_num - 1U ) ];
+
+        const int32_t dif = (int32_t)( FM25_ATOMIC_LOAD( &p_slot->seq ) - pos );
+
+        if ( 0 == dif )
+        {
+            // Claim position, on failure "pos" is reloaded with current head
+            if ( true == FM25_ATOMIC_CAS( &p_ring->head, &pos, ( pos + 1U )))
+            {
+                break;
+            }
+        }
+        else if ( dif < 0 )
+        {
+            // Consumer did not serve this slot of previous lap yet
+            status = eFM25_ERROR_BUSY;
+            break;
+        }
+        else
+        {
+            // Other producer claimed position
+            pos = FM25_ATOMIC_LOAD( &p_ring->head );
+        }
+    }
+
+    if ( eFM25_OK == status )
+    {
+        p_slot->p_req = p_req;
+
+        // Hand over to consumer
+        FM25_ATOMIC_STORE( &p_slot->seq, ( pos + 1U ));
+
+        if ( NULL != p_ring->cfg.pf_notify )
+        {
+            p_ring->cfg.pf_notify();
+        }
+    }
+    else
+    {
+        FM25_ATOMIC_INC( &p_ring->stats.full );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_RING
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of FM25 submission ring API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Initialize submission ring
+*
+* @param[out]   p_ring  - Pointer to ring
+* @param[in]    p_cfg   - Pointer to ring configuration
+* @return       status  - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ring_init(fm25_ring_t * const p_ring, const fm25_ring_cfg_t * const p_cfg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    FM25_ASSERT( NULL != p_ring );
+    FM25_ASSERT( NULL != p_cfg );
+
+    if  (   ( NULL != p_ring )
+        &&  ( NULL != p_cfg )
+        &&  ( NULL != p_cfg->dev )
+        &&  ( NULL != p_cfg->p_slot )
+        &&  ( p_cfg->slot_num >= 2U )
+        &&  ( 0U == ( p_cfg->slot_num & ( p_cfg->slot_num - 1U ))))
+    {
+        memset( p_ring, 0, sizeof( fm25_ring_t ));
+
+        p_ring->cfg = *p_cfg;
+
+        for ( uint32_t i = 0U; i < p_cfg->slot_num; i++ )
+        {
+            p_cfg->p_slot[i].p_req  = NULL;
+            p_cfg->p_slot[i].seq    = i;
+        }
+
+        p_ring->is_init = true;
+    }
+    else
+    {
+        status = eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Post write request
+*
+* @param[in]    p_ring  - Pointer to ring
+* @param[in]    p_req   - Request storage, valid until completion
+* @param[in]    addr    - Start address of write
+* @param[in]    size    - Size of bytes to write
+* @param[in]    p_data  - Pointer to write data, valid until completion
+* @param[in]    pf_cb   - Completion callback, can be NULL
+* @param[in]    p_arg   - Callback argument
+* @return       status  - Status of operation, "eFM25_ERROR_BUSY" on full ring
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ring_write(fm25_ring_t * const p_ring, fm25_ring_req_t * const p_req, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_fm25_ring_cb_t pf_cb, void * const p_arg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if  (   ( NULL == p_ring )
+        ||  ( false == p_ring->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_req ) || ( NULL == p_data ) || ( 0U == size ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        p_req->p_tx     = p_data;
+        p_req->p_rx     = NULL;
+        p_req->addr     = addr;
+        p_req->size     = size;
+        p_req->pf_cb    = pf_cb;
+        p_req->p_arg    = p_arg;
+
+        status = fm25_ring_post( p_ring, p_req );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Post read request
+*
+* @param[in]    p_ring  - Pointer to ring
+* @param[in]    p_req   - Request storage, valid until completion
+* @param[in]    addr    - Start address of read
+* @param[in]    size    - Size of bytes to read
+* @param[out]   p_data  - Pointer to read data, valid until completion
+* @param[in]    pf_cb   - Completion callback, can be NULL
+* @param[in]    p_arg   - Callback argument
+* @return       status  - Status of operation, "eFM25_ERROR_BUSY" on full ring
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ring_read(fm25_ring_t * const p_ring, fm25_ring_req_t * const p_req, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_fm25_ring_cb_t pf_cb, void * const p_arg)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if  (   ( NULL == p_ring )
+        ||  ( false == p_ring->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else if (( NULL == p_req ) || ( NULL == p_data ) || ( 0U == size ))
+    {
+        status = eFM25_ERROR;
+    }
+    else
+    {
+        p_req->p_tx     = NULL;
+        p_req->p_rx     = p_data;
+        p_req->addr     = addr;
+        p_req->size     = size;
+        p_req->pf_cb    = pf_cb;
+        p_req->p_arg    = p_arg;
+
+        status = fm25_ring_post( p_ring, p_req );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Serve posted requests
+*
+* @note     Serves at most one ring lap of requests in post order, thus
+*           producers posting continuously can not keep driver task in
+*           the loop forever. Shall be called from single driver task.
+*
+* @param[in]    p_ring  - Pointer to ring
+* @return       status  - Status of operation, errors of all requests combined
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ring_process(fm25_ring_t * const p_ring)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if  (   ( NULL == p_ring )
+        ||  ( false == p_ring->is_init ))
+    {
+        status = eFM25_ERROR_INIT;
+    }
+    else
+    {
+        for ( uint32_t n = 0U; n < p_ring->cfg.slot_num; n++ )
+        {
+            const uint32_t      pos     = p_ring->tail;
+            fm25_ring_slot_t *  p_slot  = &p_ring->cfg.p_slot[ pos & ( p_ring->cfg.slot_num - 1U ) ];
+
+            // Nothing posted or producer still filling the slot
+            if (( pos + 1U ) != FM25_ATOMIC_LOAD( &p_slot->seq ))
+            {
+                break;
+            }
+
+            fm25_ring_req_t * const p_req = p_slot->p_req;
+
+            // Release slot for next lap before serving, request storage is owned by caller
+            FM25_ATOMIC_STORE( &p_slot->seq, ( pos + p_ring->cfg.slot_num ));
+            p_ring->tail++;
+
+            fm25_status_t req_status = eFM25_OK;
+
+            if ( NULL != p_req->p_tx )
+            {
+                req_status = fm25_write( p_ring->cfg.dev, p_req->addr, p_req->size, p_req->p_tx );
+            }
+            else
+            {
+                req_status = fm25_read( p_ring->cfg.dev, p_req->addr, p_req->size, p_req->p_rx );
+            }
+
+            p_ring->stats.done++;
+
+            if ( eFM25_OK != req_status )
+            {
+                p_ring->stats.err++;
+            }
+
+            if ( NULL != p_ring->cfg.pf_get_tick )
+            {
+                p_ring->stats.lat_last = p_ring->cfg.pf_get_tick() - p_req->tick;
+
+                if ( p_ring->stats.lat_last > p_ring->stats.lat_max )
+                {
+                    p_ring->stats.lat_max = p_ring->stats.lat_last;
+                }
+            }
+
+            if ( NULL != p_req->pf_cb )
+            {
+                p_req->pf_cb( p_req, req_status, p_req->p_arg );
+            }
+
+            status |= req_status;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get ring statistics
+*
+* @param[in]    p_ring  - Pointer to ring
+* @param[out]   p_stats - Pointer to statistics
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ring_get_stats(const fm25_ring_t * const p_ring, fm25_ring_stats_t * const p_stats)
+{
+    fm25_status_t status = eFM25_OK;
+
+    if (( NULL != p_ring ) && ( NULL != p_stats ))
+    {
+        *p_stats = p_ring->stats;
+    }
+    else
+    {
+        status = eFM25_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
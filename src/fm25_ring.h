@@ -0,0 +1,128 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fm25_ring.h
+*@brief     Lock-free submission ring for FM25 FRAM device
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FM25_RING
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FM25_RING_H_
+#define FM25_RING_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fm25.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Posted request
+ */
+typedef struct fm25_ring_req_s fm25_ring_req_t;
+
+/**
+ *     Request completion callback
+ *
+ * @note    Called from driver task context.
+ */
+typedef void (*pf_fm25_ring_cb_t)(fm25_ring_req_t * const p_req, const fm25_status_t status, void * const p_arg);
+
+/**
+ *     Posted request
+ *
+ * @note    Storage is provided by caller and must stay valid until
+ *          completion callback is called.
+ */
+struct fm25_ring_req_s
+{
+    const uint8_t *         p_tx;       /**<Write data */
+    uint8_t *               p_rx;       /**<Read data */
+    uint32_t                addr;       /**<Start address */
+    uint32_t                size;       /**<Size of payload */
+    uint32_t                tick;       /**<Post timestamp */
+    pf_fm25_ring_cb_t       pf_cb;      /**<Completion callback */
+    void *                  p_arg;      /**<Callback argument */
+};
+
+/**
+ *     Ring slot
+ *
+ * @note    Treat as opaque!
+ */
+typedef struct
+{
+    fm25_ring_req_t *       p_req;      /**<Posted request */
+    uint32_t                seq;        /**<Slot sequence, hand-over between producer and consumer */
+} fm25_ring_slot_t;
+
+/**
+ *     Ring configuration
+ */
+typedef struct
+{
+    fm25_dev_t          dev;                    /**<Device handle */
+    fm25_ring_slot_t *  p_slot;                 /**<Slot storage */
+    uint32_t            slot_num;               /**<Number of slots, power of 2 */
+    uint32_t            (*pf_get_tick)(void);   /**<Timestamp source, NULL disables latency statistics */
+    void                (*pf_notify)(void);     /**<Wake-up of driver task after post, can be NULL */
+} fm25_ring_cfg_t;
+
+/**
+ *     Ring statistics
+ */
+typedef struct
+{
+    uint32_t    done;           /**<Number of served requests */
+    uint32_t    err;            /**<Number of failed requests */
+    uint32_t    full;           /**<Number of posts rejected on full ring */
+    uint32_t    lat_last;       /**<Post to completion latency of last request in ticks */
+    uint32_t    lat_max;        /**<Maximum post to completion latency in ticks */
+} fm25_ring_stats_t;
+
+/**
+ *     Submission ring
+ *
+ * @note    Treat as opaque, use API functions only!
+ */
+typedef struct
+{
+    fm25_ring_cfg_t     cfg;        /**<Configuration */
+    fm25_ring_stats_t   stats;      /**<Statistics */
+    uint32_t            head;       /**<Next post position, shared by producers */
+    uint32_t            tail;       /**<Next serve position, owned by consumer */
+    bool                is_init;    /**<Initialization guard */
+} fm25_ring_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+fm25_status_t fm25_ring_init        (fm25_ring_t * const p_ring, const fm25_ring_cfg_t * const p_cfg);
+fm25_status_t fm25_ring_write       (fm25_ring_t * const p_ring, fm25_ring_req_t * const p_req, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_fm25_ring_cb_t pf_cb, void * const p_arg);
+fm25_status_t fm25_ring_read        (fm25_ring_t * const p_ring, fm25_ring_req_t * const p_req, const uint32_t addr, const uint32_t size, uint8_t * const p_data, pf_fm25_ring_cb_t pf_cb, void * const p_arg);
+fm25_status_t fm25_ring_process     (fm25_ring_t * const p_ring);
+fm25_status_t fm25_ring_get_stats   (const fm25_ring_t * const p_ring, fm25_ring_stats_t * const p_stats);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // FM25_RING_H_